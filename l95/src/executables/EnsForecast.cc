@@ -0,0 +1,18 @@
+/*
+ * (C) Copyright 2023 UCAR.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#include "lorenz95/L95Traits.h"
+#include "oops/generic/instantiateModelFactory.h"
+#include "oops/runs/EnsembleForecast.h"
+#include "oops/runs/Run.h"
+
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  oops::instantiateModelFactory<lorenz95::L95Traits>();
+  oops::EnsembleForecast<lorenz95::L95Traits> fc;
+  return run.execute(fc);
+}
@@ -31,7 +31,8 @@ ErrorCovarianceL95::ErrorCovarianceL95(const Resolution & geom, const oops::Vari
                                        const StateL95 &, const StateL95 &) :
   time_(params.date),
   sigmab_(params.standardDeviation),
-  rscale_(1.0/params.lengthScale)
+  rscale_(1.0/params.lengthScale),
+  single_(params.singlePrecision)
 {
 // Gaussian structure function
   resol_ = geom.npoints();
@@ -49,30 +50,43 @@ ErrorCovarianceL95::ErrorCovarianceL95(const Resolution & geom, const oops::Vari
   for (unsigned int jj = 0; jj < size_; ++jj) {
     bcoefs_[jj] = std::real(coefs[jj]);
   }
+  if (single_) {
+    bcoefsSingle_.assign(bcoefs_.begin(), bcoefs_.end());
+    gridSingle_.resize(resol_);
+    coefsSingle_.resize(resol_);
+  }
 }
 // -----------------------------------------------------------------------------
 ErrorCovarianceL95::~ErrorCovarianceL95() {}
 // -----------------------------------------------------------------------------
 void ErrorCovarianceL95::multiply(const IncrementL95 & dxin,
                                   IncrementL95 & dxout) const {
-  std::vector<std::complex<double> > coefs(resol_);
-  fft_.fwd(coefs, dxin.asVector());
-  for (unsigned int jj = 0; jj < size_; ++jj) {
-    coefs[jj] *= bcoefs_[jj];
+  if (single_) {
+    this->filterSingle(dxin, dxout, false);
+  } else {
+    std::vector<std::complex<double> > coefs(resol_);
+    fft_.fwd(coefs, dxin.asVector());
+    for (unsigned int jj = 0; jj < size_; ++jj) {
+      coefs[jj] *= bcoefs_[jj];
+    }
+    fft_.inv(dxout.asVector(), coefs);
   }
-  fft_.inv(dxout.asVector(), coefs);
   double var = sigmab_ * sigmab_;
   dxout *= var;
 }
 // -----------------------------------------------------------------------------
 void ErrorCovarianceL95::inverseMultiply(const IncrementL95 & dxin,
                                          IncrementL95 & dxout) const {
-  std::vector<std::complex<double> > coefs(resol_);
-  fft_.fwd(coefs, dxin.asVector());
-  for (unsigned int jj = 0; jj < size_; ++jj) {
-    coefs[jj] /= bcoefs_[jj];
+  if (single_) {
+    this->filterSingle(dxin, dxout, true);
+  } else {
+    std::vector<std::complex<double> > coefs(resol_);
+    fft_.fwd(coefs, dxin.asVector());
+    for (unsigned int jj = 0; jj < size_; ++jj) {
+      coefs[jj] /= bcoefs_[jj];
+    }
+    fft_.inv(dxout.asVector(), coefs);
   }
-  fft_.inv(dxout.asVector(), coefs);
   double vari = 1.0 / (sigmab_ * sigmab_);
   dxout *= vari;
 }
@@ -88,9 +102,27 @@ void ErrorCovarianceL95::randomize(IncrementL95 & dx) const {
   dx *= sigmab_;
 }
 // -----------------------------------------------------------------------------
+void ErrorCovarianceL95::filterSingle(const IncrementL95 & dxin, IncrementL95 & dxout,
+                                      const bool inverse) const {
+  const std::vector<double> & xin = dxin.asVector();
+  for (unsigned int jj = 0; jj < resol_; ++jj) gridSingle_[jj] = xin[jj];
+  fftSingle_.fwd(coefsSingle_, gridSingle_);
+  for (unsigned int jj = 0; jj < size_; ++jj) {
+    if (inverse) {
+      coefsSingle_[jj] /= bcoefsSingle_[jj];
+    } else {
+      coefsSingle_[jj] *= bcoefsSingle_[jj];
+    }
+  }
+  fftSingle_.inv(gridSingle_, coefsSingle_);
+  std::vector<double> & xout = dxout.asVector();
+  for (unsigned int jj = 0; jj < resol_; ++jj) xout[jj] = gridSingle_[jj];
+}
+// -----------------------------------------------------------------------------
 void ErrorCovarianceL95::print(std::ostream & os) const {
   os << "ErrorCovarianceL95: time = " << time_ << ", std dev = " << sigmab_
      << ", length scale = " << 1.0/rscale_;
+  if (single_) os << ", single precision";
 }
 // -----------------------------------------------------------------------------
 
@@ -12,6 +12,7 @@
 #define LORENZ95_ERRORCOVARIANCEL95_H_
 
 #include <unsupported/Eigen/FFT>
+#include <complex>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -22,6 +23,7 @@
 #include "oops/base/ModelSpaceCovarianceParametersBase.h"
 #include "oops/util/DateTime.h"
 #include "oops/util/ObjectCounter.h"
+#include "oops/util/parameters/Parameter.h"
 #include "oops/util/parameters/Parameters.h"
 #include "oops/util/parameters/RequiredParameter.h"
 #include "oops/util/Printable.h"
@@ -46,6 +48,8 @@ class ErrorCovarianceL95Parameters : public oops::ModelSpaceCovarianceParameters
   oops::RequiredParameter<util::DateTime> date{"date", this};
   oops::RequiredParameter<double> standardDeviation{"standard_deviation", this};
   oops::RequiredParameter<double> lengthScale{"length_scale", this};
+  /// Apply the covariance (and its inverse) in single precision.
+  oops::Parameter<bool> singlePrecision{"single precision", false, this};
 };
 
 /// Background error covariance matrix for Lorenz 95 model.
@@ -72,6 +76,7 @@ class ErrorCovarianceL95 : public util::Printable,
 
  private:
   void print(std::ostream &) const;
+  void filterSingle(const IncrementL95 &, IncrementL95 &, const bool) const;
   const util::DateTime time_;
   const double sigmab_;
   const double rscale_;
@@ -79,6 +84,12 @@ class ErrorCovarianceL95 : public util::Printable,
   unsigned int size_;
   std::vector<double> bcoefs_;
   mutable Eigen::FFT<double> fft_;
+  const bool single_;
+  std::vector<float> bcoefsSingle_;
+  mutable Eigen::FFT<float> fftSingle_;
+  // Workspace of filterSingle
+  mutable std::vector<float> gridSingle_;
+  mutable std::vector<std::complex<float> > coefsSingle_;
 };
 // -----------------------------------------------------------------------------
 }  // namespace lorenz95
@@ -132,6 +132,17 @@ void FieldL95::axpy(const double & zz, const FieldL95 & rhs) {
   for (int jj = 0; jj < resol_; ++jj) x_[jj] += zz * rhs.x_[jj];
 }
 // -----------------------------------------------------------------------------
+void FieldL95::multi_axpy(const std::vector<double> & zz,
+                          const std::vector<const FieldL95 *> & rhs) {
+  ASSERT(zz.size() == rhs.size());
+  for (size_t jv = 0; jv < rhs.size(); ++jv) ASSERT(rhs[jv]->resol_ == resol_);
+  for (int jj = 0; jj < resol_; ++jj) {
+    double xx = x_[jj];
+    for (size_t jv = 0; jv < rhs.size(); ++jv) xx += zz[jv] * rhs[jv]->x_[jj];
+    x_[jj] = xx;
+  }
+}
+// -----------------------------------------------------------------------------
 double FieldL95::dot_product_with(const FieldL95 & other) const {
   ASSERT(other.resol_ == resol_);
   double zz = 0.0;
@@ -139,11 +150,35 @@ double FieldL95::dot_product_with(const FieldL95 & other) const {
   return zz;
 }
 // -----------------------------------------------------------------------------
+std::vector<double> FieldL95::dot_products_with(
+                                   const std::vector<const FieldL95 *> & others) const {
+  for (size_t jv = 0; jv < others.size(); ++jv) ASSERT(others[jv]->resol_ == resol_);
+  std::vector<double> zz(others.size(), 0.0);
+  for (int jj = 0; jj < resol_; ++jj) {
+    for (size_t jv = 0; jv < others.size(); ++jv) zz[jv] += x_[jj] * others[jv]->x_[jj];
+  }
+  return zz;
+}
+// -----------------------------------------------------------------------------
 void FieldL95::schur(const FieldL95 & rhs) {
   ASSERT(rhs.resol_ == resol_);
   for (int jj = 0; jj < resol_; ++jj) x_[jj] *= rhs.x_[jj];
 }
 // -----------------------------------------------------------------------------
+void FieldL95::schur_accumul(const std::vector<const FieldL95 *> & xx,
+                             const std::vector<const FieldL95 *> & ww) {
+  ASSERT(xx.size() == ww.size());
+  for (size_t jv = 0; jv < xx.size(); ++jv) {
+    ASSERT(xx[jv]->resol_ == resol_);
+    ASSERT(ww[jv]->resol_ == resol_);
+  }
+  for (int jj = 0; jj < resol_; ++jj) {
+    double zz = x_[jj];
+    for (size_t jv = 0; jv < xx.size(); ++jv) zz += xx[jv]->x_[jj] * ww[jv]->x_[jj];
+    x_[jj] = zz;
+  }
+}
+// -----------------------------------------------------------------------------
 void FieldL95::random() {
   util::NormalDistribution<double> xx(resol_, 0.0, 1.0, 1);
   for (int jj = 0; jj < resol_; ++jj) x_[jj] = xx[jj];
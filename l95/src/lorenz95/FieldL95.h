@@ -74,8 +74,11 @@ class FieldL95 : public util::Printable,
   FieldL95 & operator*=(const double &);
   void diff(const FieldL95 &, const FieldL95 &);
   void axpy(const double &, const FieldL95 &);
+  void multi_axpy(const std::vector<double> &, const std::vector<const FieldL95 *> &);
   double dot_product_with(const FieldL95 &) const;
+  std::vector<double> dot_products_with(const std::vector<const FieldL95 *> &) const;
   void schur(const FieldL95 &);
+  void schur_accumul(const std::vector<const FieldL95 *> &, const std::vector<const FieldL95 *> &);
   void random();
   void generate(const Field95GenerateParameters &);
 
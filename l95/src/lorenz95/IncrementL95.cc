@@ -121,15 +121,41 @@ void IncrementL95::axpy(const double & zz, const IncrementL95 & rhs,
   fld_.axpy(zz, rhs.fld_);
 }
 // -----------------------------------------------------------------------------
+void IncrementL95::multi_axpy(const std::vector<double> & zz,
+                              const std::vector<const IncrementL95 *> & rhs) {
+  std::vector<const FieldL95 *> flds(rhs.size());
+  for (size_t jv = 0; jv < rhs.size(); ++jv) {
+    ASSERT(time_ == rhs[jv]->time_);
+    flds[jv] = &rhs[jv]->fld_;
+  }
+  fld_.multi_axpy(zz, flds);
+}
+// -----------------------------------------------------------------------------
 double IncrementL95::dot_product_with(const IncrementL95 & other) const {
   double zz = dot_product(fld_, other.fld_);
   return zz;
 }
 // -----------------------------------------------------------------------------
+std::vector<double> IncrementL95::dot_products_with(
+                                   const std::vector<const IncrementL95 *> & others) const {
+  std::vector<const FieldL95 *> flds(others.size());
+  for (size_t jv = 0; jv < others.size(); ++jv) flds[jv] = &others[jv]->fld_;
+  return fld_.dot_products_with(flds);
+}
+// -----------------------------------------------------------------------------
 void IncrementL95::schur_product_with(const IncrementL95 & rhs) {
   fld_.schur(rhs.fld_);
 }
 // -----------------------------------------------------------------------------
+void IncrementL95::schur_accumul(const std::vector<const IncrementL95 *> & dx,
+                                 const std::vector<const IncrementL95 *> & ww) {
+  std::vector<const FieldL95 *> flds(dx.size());
+  std::vector<const FieldL95 *> wgts(ww.size());
+  for (size_t jv = 0; jv < dx.size(); ++jv) flds[jv] = &dx[jv]->fld_;
+  for (size_t jv = 0; jv < ww.size(); ++jv) wgts[jv] = &ww[jv]->fld_;
+  fld_.schur_accumul(flds, wgts);
+}
+// -----------------------------------------------------------------------------
 void IncrementL95::random() {
   fld_.random();
 }
@@ -111,8 +111,12 @@ class IncrementL95 : public util::Printable,
   IncrementL95 & operator-=(const IncrementL95 &);
   IncrementL95 & operator*=(const double &);
   void axpy(const double &, const IncrementL95 &, const bool check = true);
+  void multi_axpy(const std::vector<double> &, const std::vector<const IncrementL95 *> &);
   double dot_product_with(const IncrementL95 &) const;
+  std::vector<double> dot_products_with(const std::vector<const IncrementL95 *> &) const;
   void schur_product_with(const IncrementL95 &);
+  void schur_accumul(const std::vector<const IncrementL95 *> &,
+                     const std::vector<const IncrementL95 *> &);
   void random();
 
 /// ATLAS
@@ -52,6 +52,7 @@ struct L95Traits {
   static std::string name() {return "Lorenz 95";}
   static std::string nameCovar() {return "L95Error";}
   static std::string nameCovar4D() {return "L95Error";}
+  static const bool threadSafeLocalUpdate = true;
 
   typedef lorenz95::Resolution             Geometry;
   typedef lorenz95::Iterator               GeometryIterator;
@@ -73,6 +74,7 @@ struct L95Traits {
 
 struct L95ObsTraits {
   static std::string name() {return "Lorenz 95 Obs";}
+  static const bool threadSafeLocalUpdate = true;
 
   typedef lorenz95::ObsTable               ObsSpace;
   typedef lorenz95::ObsVec1D               ObsVector;
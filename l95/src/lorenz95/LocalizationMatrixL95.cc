@@ -49,26 +49,40 @@ LocalizationMatrixL95::LocalizationMatrixL95(const Resolution & resol,
 }
 // -----------------------------------------------------------------------------
 void LocalizationMatrixL95::randomize(IncrementL95 & dx) const {
-  dx.random();
+  this->randomizeBatch({&dx});
+}
+// -----------------------------------------------------------------------------
+void LocalizationMatrixL95::multiply(IncrementL95 & dx) const {
+  this->multiplyBatch({&dx});
+}
+// -----------------------------------------------------------------------------
+void LocalizationMatrixL95::randomizeBatch(const std::vector<IncrementL95 *> & dxs) const {
+// One FFT set-up for all increments
   unsigned int size = resol_/2+1;
   Eigen::FFT<double> fft;
   std::vector<std::complex<double> > four(size);
-  fft.fwd(four, dx.asVector());
-  for (unsigned int jj = 0; jj < size; ++jj) {
-    four[jj] *= std::sqrt(coefs_[jj]);
+  for (IncrementL95 * dx : dxs) {
+    dx->random();
+    fft.fwd(four, dx->asVector());
+    for (unsigned int jj = 0; jj < size; ++jj) {
+      four[jj] *= std::sqrt(coefs_[jj]);
+    }
+    fft.inv(dx->asVector(), four);
   }
-  fft.inv(dx.asVector(), four);
 }
 // -----------------------------------------------------------------------------
-void LocalizationMatrixL95::multiply(IncrementL95 & dx) const {
+void LocalizationMatrixL95::multiplyBatch(const std::vector<IncrementL95 *> & dxs) const {
+// One FFT set-up for all increments
   unsigned int size = resol_/2+1;
   Eigen::FFT<double> fft;
   std::vector<std::complex<double> > four(size);
-  fft.fwd(four, dx.asVector());
-  for (unsigned int jj = 0; jj < size; ++jj) {
-    four[jj] *= coefs_[jj];
+  for (IncrementL95 * dx : dxs) {
+    fft.fwd(four, dx->asVector());
+    for (unsigned int jj = 0; jj < size; ++jj) {
+      four[jj] *= coefs_[jj];
+    }
+    fft.inv(dx->asVector(), four);
   }
-  fft.inv(dx.asVector(), four);
 }
 // -----------------------------------------------------------------------------
 void LocalizationMatrixL95::print(std::ostream & os) const {
@@ -37,6 +37,8 @@ class LocalizationMatrixL95: public oops::interface::LocalizationBase<lorenz95::
   LocalizationMatrixL95(const Resolution &, const oops::Variables &, const eckit::Configuration &);
   void randomize(IncrementL95 &) const override;
   void multiply(IncrementL95 &) const override;
+  void randomizeBatch(const std::vector<IncrementL95 *> &) const override;
+  void multiplyBatch(const std::vector<IncrementL95 *> &) const override;
 
  private:
   void print(std::ostream &) const override;
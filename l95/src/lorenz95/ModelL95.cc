@@ -8,6 +8,8 @@
  * does it submit to any jurisdiction.
  */
 
+#include <algorithm>
+#include <vector>
 
 #include "eckit/config/Configuration.h"
 
@@ -25,6 +27,35 @@ namespace lorenz95 {
 
 // -----------------------------------------------------------------------------
 static oops::interface::ModelMaker<L95Traits, ModelL95> makermodel_("L95");
+// -----------------------------------------------------------------------------
+#ifdef __INTEL_COMPILER
+#pragma optimize("", off)
+#endif
+namespace {
+/// Tendencies of nm members stored member-innermost: point jj of member jm is
+/// xx[(jj + 2) * nm + jm], with two periodic halo points before the nn grid points
+/// and one after them.
+void batchTendencies(double * xx, const double bias, double * dx, const int nn, const int nm,
+                     const double ff, const double dt) {
+  std::copy(xx + nn * nm, xx + (nn + 2) * nm, xx);
+  std::copy(xx + 2 * nm, xx + 3 * nm, xx + (nn + 2) * nm);
+  for (int jj = 0; jj < nn; ++jj) {
+    const double * xm2 = xx + jj * nm;
+    const double * xm1 = xm2 + nm;
+    const double * xj = xm1 + nm;
+    const double * xp1 = xj + nm;
+    double * dj = dx + jj * nm;
+#pragma omp simd
+    for (int jm = 0; jm < nm; ++jm) {
+      const double dxdt = -xm2[jm] * xm1[jm] + xm1[jm] * xp1[jm] - xj[jm] + ff - bias;
+      dj[jm] = dt * dxdt;
+    }
+  }
+}
+}  // namespace
+#ifdef __INTEL_COMPILER
+#pragma optimize("", on)
+#endif
 
 // -----------------------------------------------------------------------------
 
@@ -47,9 +78,52 @@ void ModelL95::initialize(StateL95 &) const {}
 void ModelL95::finalize(StateL95 &) const {}
 // -----------------------------------------------------------------------------
 void ModelL95::step(StateL95 & xx, const ModelBias & bias) const {
-  ModelTrajectory traj(false);
-  this->stepRK(xx.getField(), bias, traj);
-  xx.validTime() += tstep_;
+  const std::vector<StateL95 *> xs(1, &xx);
+  this->stepBatch(xs, bias);
+}
+// -----------------------------------------------------------------------------
+void ModelL95::stepBatch(const std::vector<StateL95 *> & xx, const ModelBias & bias) const {
+// Same Runge-Kutta steps as stepRK, for all members at once
+  const int nn = resol_.npoints();
+  const int nm = xx.size();
+
+// Workspace of the calling thread (batches are stepped concurrently), kept between steps:
+// initial state, intermediate state with its periodic halo, tendency and increment
+  static thread_local std::vector<double> work;
+  work.resize((4 * nn + 3) * nm);
+  double * z0 = work.data();
+  double * zz = z0 + nn * nm;
+  double * zi = zz + 2 * nm;
+  double * dz = zz + (nn + 3) * nm;
+  double * dx = dz + nn * nm;
+
+  for (int jm = 0; jm < nm; ++jm) {
+    const std::vector<double> & fld = xx[jm]->getField().asVector();
+    for (int jj = 0; jj < nn; ++jj) z0[jj * nm + jm] = fld[jj];
+  }
+
+  std::copy(z0, z0 + nn * nm, zi);
+  batchTendencies(zz, bias.bias(), dz, nn, nm, f_, dt_);
+  std::copy(dz, dz + nn * nm, dx);
+
+  for (int ji = 0; ji < nn * nm; ++ji) zi[ji] = z0[ji] + 0.5 * dz[ji];
+  batchTendencies(zz, bias.bias(), dz, nn, nm, f_, dt_);
+  for (int ji = 0; ji < nn * nm; ++ji) dx[ji] += 2.0 * dz[ji];
+
+  for (int ji = 0; ji < nn * nm; ++ji) zi[ji] = z0[ji] + 0.5 * dz[ji];
+  batchTendencies(zz, bias.bias(), dz, nn, nm, f_, dt_);
+  for (int ji = 0; ji < nn * nm; ++ji) dx[ji] += 2.0 * dz[ji];
+
+  for (int ji = 0; ji < nn * nm; ++ji) zi[ji] = z0[ji] + dz[ji];
+  batchTendencies(zz, bias.bias(), dz, nn, nm, f_, dt_);
+  for (int ji = 0; ji < nn * nm; ++ji) dx[ji] += dz[ji];
+
+  const double zt = 1.0/6.0;
+  for (int jm = 0; jm < nm; ++jm) {
+    std::vector<double> & fld = xx[jm]->getField().asVector();
+    for (int jj = 0; jj < nn; ++jj) fld[jj] += zt * dx[jj * nm + jm];
+    xx[jm]->validTime() += tstep_;
+  }
 }
 // -----------------------------------------------------------------------------
 
@@ -96,16 +170,14 @@ void ModelL95::tendencies(const FieldL95 & xx, const double & bias,
   const int nn = resol_.npoints();
   // intel 19 is doing some agressive optimization of this loop that
   // is modifying the solution.
-  for (int jj = 0; jj < nn; ++jj) {
-    int jm2 = jj - 2;
-    int jm1 = jj - 1;
-    int jp1 = jj + 1;
-    if (jm2 < 0) jm2 += nn;
-    if (jm1 < 0) jm1 += nn;
-    if (jp1 >= nn) jp1 -= nn;
-    const double dxdt = -xx[jm2] * xx[jm1] + xx[jm1] * xx[jp1] - xx[jj] + f_ - bias;
+  // The points next to the periodic boundary are peeled off the loop.
+  dx[0] = dt_ * (-xx[nn - 2] * xx[nn - 1] + xx[nn - 1] * xx[1] - xx[0] + f_ - bias);
+  dx[1] = dt_ * (-xx[nn - 1] * xx[0] + xx[0] * xx[2] - xx[1] + f_ - bias);
+  for (int jj = 2; jj < nn - 1; ++jj) {
+    const double dxdt = -xx[jj - 2] * xx[jj - 1] + xx[jj - 1] * xx[jj + 1] - xx[jj] + f_ - bias;
     dx[jj] = dt_ * dxdt;
   }
+  dx[nn - 1] = dt_ * (-xx[nn - 3] * xx[nn - 2] + xx[nn - 2] * xx[0] - xx[nn - 1] + f_ - bias);
 }
 #ifdef __INTEL_COMPILER
 #pragma optimize("", on)
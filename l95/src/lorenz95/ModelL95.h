@@ -13,6 +13,7 @@
 
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "eckit/config/Configuration.h"
 #include "oops/base/Variables.h"
@@ -63,6 +64,10 @@ class ModelL95 : public oops::interface::ModelBase<L95Traits>,
   void finalize(StateL95 &) const;
   void stepRK(FieldL95 &, const ModelBias &, ModelTrajectory &) const;
 
+// Step several members together
+  void stepBatch(const std::vector<StateL95 *> &, const ModelBias &) const;
+  bool hasStepBatch() const {return true;}
+
 // Information and diagnostics
   const util::Duration & timeResolution() const {return tstep_;}
   const oops::Variables & variables() const {return vars_;}
@@ -33,21 +33,31 @@ ObsLocBoxCar::ObsLocBoxCar(const Parameters_ & params, const ObsTable & obsdb)
 // -----------------------------------------------------------------------------
 
 void ObsLocBoxCar::computeLocalization(const Iterator & iterator, ObsVec1D & locfactor) const {
-  std::vector<double> locations = obsdb_.locations();
-  eckit::geometry::Point3 center = *iterator;
+  oops::LocalObs local;
+  computeLocalObs(iterator, local);
+  size_t jj = 0;
   for (unsigned int ii=0; ii < obsdb_.nobs(); ++ii) {
-    double curdist = std::abs(center[0] - locations[ii]);
-    curdist = std::min(curdist, 1.-curdist);
-    if (curdist >= rscale_) {
-      locfactor[ii] = locfactor.missing();
+    if (jj < local.size() && local.indices[jj] == ii) {
+      locfactor[ii] *= local.values[jj];
+      ++jj;
     } else {
-      locfactor[ii] *= 1.0;
+      locfactor[ii] = locfactor.missing();
     }
   }
 }
 
 // -----------------------------------------------------------------------------
 
+bool ObsLocBoxCar::computeLocalObs(const Iterator & iterator, oops::LocalObs & local) const {
+  eckit::geometry::Point3 center = *iterator;
+  std::vector<double> dists;
+  obsdb_.localObs(center[0], rscale_, local.indices, dists);
+  local.values.assign(dists.size(), 1.0);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
 void ObsLocBoxCar::print(std::ostream & os) const {
   os << "Box Car localization with lengthscale=" << rscale_;
 }
@@ -32,6 +32,9 @@ class ObsLocBoxCar: public oops::ObsLocalizationBase<L95Traits, L95ObsTraits> {
   /// (missing value is for obs outside of localization)
   void computeLocalization(const Iterator &, ObsVec1D & locfactor) const override;
 
+  /// compute localization values for the observations local to the grid point only
+  bool computeLocalObs(const Iterator &, oops::LocalObs & local) const override;
+
  private:
   void print(std::ostream &) const override;
 
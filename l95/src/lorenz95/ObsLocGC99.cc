@@ -35,21 +35,34 @@ ObsLocGC99::ObsLocGC99(const Parameters_ & params, const ObsTable & obsdb)
 // -----------------------------------------------------------------------------
 
 void ObsLocGC99::computeLocalization(const Iterator & iterator, ObsVec1D & locfactor) const {
-  std::vector<double> locations = obsdb_.locations();
-  eckit::geometry::Point3 center = *iterator;
+  oops::LocalObs local;
+  computeLocalObs(iterator, local);
+  size_t jj = 0;
   for (unsigned int ii=0; ii < obsdb_.nobs(); ++ii) {
-    double curdist = std::abs(center[0] - locations[ii]);
-    curdist = std::min(curdist, 1.-curdist);
-    if (curdist >= rscale_) {
-      locfactor[ii] = locfactor.missing();
+    if (jj < local.size() && local.indices[jj] == ii) {
+      locfactor[ii] *= local.values[jj];
+      ++jj;
     } else {
-      locfactor[ii] *= oops::gc99(curdist/rscale_);
+      locfactor[ii] = locfactor.missing();
     }
   }
 }
 
 // -----------------------------------------------------------------------------
 
+bool ObsLocGC99::computeLocalObs(const Iterator & iterator, oops::LocalObs & local) const {
+  eckit::geometry::Point3 center = *iterator;
+  std::vector<double> dists;
+  obsdb_.localObs(center[0], rscale_, local.indices, dists);
+  local.values.resize(dists.size());
+  for (size_t jj = 0; jj < dists.size(); ++jj) {
+    local.values[jj] = oops::gc99(dists[jj]/rscale_);
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
 void ObsLocGC99::print(std::ostream & os) const {
   os << "Gaspari-Cohn localization with lengthscale=" << rscale_;
 }
@@ -22,6 +22,7 @@
 
 #include "eckit/config/LocalConfiguration.h"
 #include "eckit/exception/Exceptions.h"
+#include "eckit/geometry/Point3.h"
 
 #include "lorenz95/ObsIterator.h"
 #include "oops/mpi/mpi.h"
@@ -35,6 +36,16 @@
 
 namespace sf = util::stringfunctions;
 
+namespace {
+// The domain [0, 1) is periodic: locations are placed on a circle of circumference 1
+// so that distances in the spatial index are periodic distances.
+const double circleRadius = 0.5 / M_PI;
+eckit::geometry::Point3 toCircle(const double x) {
+  return eckit::geometry::Point3(circleRadius * std::cos(2.0 * M_PI * x),
+                                 circleRadius * std::sin(2.0 * M_PI * x), 0.0);
+}
+}  // namespace
+
 // -----------------------------------------------------------------------------
 namespace lorenz95 {
 // -----------------------------------------------------------------------------
@@ -173,6 +184,35 @@ void ObsTable::getdb(const std::string & col, std::vector<double> & vec) const {
 
 // -----------------------------------------------------------------------------
 
+void ObsTable::localObs(const double center, const double dist,
+                        std::vector<size_t> & indices, std::vector<double> & dists) const {
+  std::call_once(indexBuilt_, [this]() {
+    std::vector<eckit::geometry::Point3> points;
+    points.reserve(locations_.size());
+    for (const double & loc : locations_) points.push_back(toCircle(loc));
+    index_.reset(new oops::ObsSpatialIndex(points));
+  });
+  index_->findInSphere(toCircle(center),
+                       oops::ObsSpatialIndex::chordLength(dist, circleRadius), indices);
+
+  // keep observations strictly closer than dist
+  size_t nlocal = 0;
+  dists.resize(indices.size());
+  for (size_t jj = 0; jj < indices.size(); ++jj) {
+    double curdist = std::abs(center - locations_[indices[jj]]);
+    curdist = std::min(curdist, 1.-curdist);
+    if (curdist < dist) {
+      indices[nlocal] = indices[jj];
+      dists[nlocal] = curdist;
+      ++nlocal;
+    }
+  }
+  indices.resize(nlocal);
+  dists.resize(nlocal);
+}
+
+// -----------------------------------------------------------------------------
+
 void ObsTable::generateDistribution(const ObsGenerateParameters & params) {
   oops::Log::trace() << "ObsTable::generateDistribution starting" << std::endl;
 
@@ -13,6 +13,8 @@
 
 #include <fstream>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -20,6 +22,7 @@
 #include "eckit/mpi/Comm.h"
 #include "oops/base/ObsSpaceBase.h"
 #include "oops/base/Variables.h"
+#include "oops/generic/ObsSpatialIndex.h"
 #include "oops/util/DateTime.h"
 #include "oops/util/ObjectCounter.h"
 #include "oops/util/parameters/OptionalParameter.h"
@@ -104,6 +107,9 @@ class ObsTable : public oops::ObsSpaceBase,
   void random(std::vector<double> &) const;
   unsigned int nobs() const {return times_.size();}
   const std::vector<double> & locations() const { return locations_; }
+  /// indices (ascending) and distances of the observations closer than \p dist to \p x
+  void localObs(const double x, const double dist,
+                std::vector<size_t> & indices, std::vector<double> & dists) const;
   const std::vector<util::DateTime> & times() const { return times_; }
   const oops::Variables & obsvariables() const { return obsvars_; }
   const oops::Variables & assimvariables() const { return assimvars_; }
@@ -125,6 +131,8 @@ class ObsTable : public oops::ObsSpaceBase,
   std::vector<util::DateTime> times_;
   std::vector<double> locations_;
   mutable std::map<std::string, std::vector<double> > data_;
+  mutable std::unique_ptr<oops::ObsSpatialIndex> index_;  // built on first use
+  mutable std::once_flag indexBuilt_;
 
   const eckit::mpi::Comm & comm_;
   const oops::Variables obsvars_;
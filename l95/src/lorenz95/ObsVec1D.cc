@@ -199,6 +199,17 @@ size_t ObsVec1D::packEigenSize(const ObsVec1D & mask) const {
   return ii;
 }
 // -----------------------------------------------------------------------------
+std::vector<size_t> ObsVec1D::packEigenIndices(const ObsVec1D & mask) const {
+  std::vector<size_t> indices;
+  indices.reserve(packEigenSize(mask));
+  for (size_t jj = 0; jj < data_.size(); ++jj) {
+    if ((data_[jj] != missing_) && (mask[jj] != missing_)) {
+      indices.push_back(jj);
+    }
+  }
+  return indices;
+}
+// -----------------------------------------------------------------------------
 void ObsVec1D::read(const std::string & name) {
   obsdb_.getdb(name, data_);
 }
@@ -47,6 +47,7 @@ class ObsVec1D : public util::Printable,
 
   Eigen::VectorXd packEigen(const ObsVec1D &) const;
   size_t packEigenSize(const ObsVec1D &) const;
+  std::vector<size_t> packEigenIndices(const ObsVec1D &) const;
 
   size_t size() const {return data_.size();}
   const double & operator[](const std::size_t ii) const {return data_.at(ii);}
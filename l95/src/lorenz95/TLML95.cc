@@ -10,6 +10,8 @@
 
 #include "lorenz95/TLML95.h"
 
+#include <vector>
+
 #include "eckit/config/LocalConfiguration.h"
 #include "eckit/exception/Exceptions.h"
 
@@ -33,13 +35,69 @@ namespace lorenz95 {
 // -----------------------------------------------------------------------------
 static oops::interface::LinearModelMaker<L95Traits, TLML95> makerTLML95_("L95TLM");
 // -----------------------------------------------------------------------------
+// intel 19 tries to aggressive optimize these functions in a way that leads
+// to memory violations.  So, turn off optimizations.
+#ifdef __INTEL_COMPILER
+#pragma optimize("", off)
+#endif
+namespace {
+/// TL tendency at point jj, with neighbours jm2, jm1 and jp1
+template <typename REAL>
+inline REAL tlPoint(const REAL * xx, const REAL bias, const REAL * xtraj,
+                    const int jm2, const int jm1, const int jj, const int jp1) {
+  return - xx[jm2] * xtraj[jm1] - xtraj[jm2] * xx[jm1]
+         + xx[jm1] * xtraj[jp1] + xtraj[jm1] * xx[jp1]
+         - xx[jj] - bias;
+}
+/// AD tendency at point jj, with neighbours jm2, jm1 and jp1
+template <typename REAL>
+inline void adPoint(REAL * xx, REAL & bias, const REAL * xtraj, const REAL dxdt,
+                    const int jm2, const int jm1, const int jj, const int jp1) {
+  xx[jm2] -= dxdt * xtraj[jm1];
+  xx[jm1] -= dxdt * xtraj[jm2];
+  xx[jm1] += dxdt * xtraj[jp1];
+  xx[jp1] += dxdt * xtraj[jm1];
+  xx[jj] -= dxdt;
+  bias -= dxdt;
+}
+/// TL tendencies, in double or single precision. The points next to the periodic
+/// boundary are peeled off the loop.
+template <typename REAL>
+void tlTendencies(const REAL * xx, const REAL bias, const REAL * xtraj, REAL * dx,
+                  const int nn, const REAL dt) {
+  dx[0] = dt * tlPoint(xx, bias, xtraj, nn - 2, nn - 1, 0, 1);
+  dx[1] = dt * tlPoint(xx, bias, xtraj, nn - 1, 0, 1, 2);
+  for (int jj = 2; jj < nn - 1; ++jj) {
+    dx[jj] = dt * tlPoint(xx, bias, xtraj, jj - 2, jj - 1, jj, jj + 1);
+  }
+  dx[nn - 1] = dt * tlPoint(xx, bias, xtraj, nn - 3, nn - 2, nn - 1, 0);
+}
+/// AD tendencies, in double or single precision
+template <typename REAL>
+void adTendencies(REAL * xx, REAL & bias, const REAL * xtraj, const REAL * dx,
+                  const int nn, const REAL dt) {
+  for (int jj = 0; jj < nn; ++jj) xx[jj] = 0.0;
+  adPoint(xx, bias, xtraj, dt * dx[0], nn - 2, nn - 1, 0, 1);
+  adPoint(xx, bias, xtraj, dt * dx[1], nn - 1, 0, 1, 2);
+  for (int jj = 2; jj < nn - 1; ++jj) {
+    adPoint(xx, bias, xtraj, dt * dx[jj], jj - 2, jj - 1, jj, jj + 1);
+  }
+  adPoint(xx, bias, xtraj, dt * dx[nn - 1], nn - 3, nn - 2, nn - 1, 0);
+}
+}  // namespace
+#ifdef __INTEL_COMPILER
+#pragma optimize("", on)
+#endif
+// -----------------------------------------------------------------------------
 TLML95::TLML95(const Resolution & resol, const Parameters_ & params)
   : resol_(resol), tstep_(params.tstep),
     dt_(tstep_.toSeconds()/432000.0), traj_(),
+    single_(params.singlePrecision), trajSingle_(),
     lrmodel_(resol_, params.trajectory),
-    vars_()
+    vars_(), work_(3 * resol_.npoints()), workSingle_(single_ ? 5 * resol_.npoints() : 0)
 {
-  oops::Log::info() << "TLML95: resol = " << resol_ << ", tstep = " << tstep_ << std::endl;
+  oops::Log::info() << "TLML95: resol = " << resol_ << ", tstep = " << tstep_
+                    << (single_ ? ", single precision" : "") << std::endl;
   oops::Log::trace() << "TLML95::TLML95 created" << std::endl;
 }
 // -----------------------------------------------------------------------------
@@ -52,11 +110,21 @@ TLML95::~TLML95() {
 // -----------------------------------------------------------------------------
 void TLML95::setTrajectory(const StateL95 & xx, StateL95 &, const ModelBias & bias) {
   ASSERT(traj_.find(xx.validTime()) == traj_.end());
+  ASSERT(trajSingle_.find(xx.validTime()) == trajSingle_.end());
   ModelTrajectory * traj = new ModelTrajectory();
 // Interpolate xx to xlr here
   FieldL95 zz(xx.getField());
   lrmodel_.stepRK(zz, bias, *traj);
-  traj_[xx.validTime()] = traj;
+  if (single_) {
+    std::vector<std::vector<float>> & trajs = trajSingle_[xx.validTime()];
+    for (int jj = 1; jj <= 4; ++jj) {
+      const std::vector<double> & xtraj = traj->get(jj).asVector();
+      trajs.emplace_back(xtraj.begin(), xtraj.end());
+    }
+    delete traj;
+  } else {
+    traj_[xx.validTime()] = traj;
+  }
 }
 // -----------------------------------------------------------------------------
 const ModelTrajectory * TLML95::getTrajectory(const util::DateTime & tt) const {
@@ -68,6 +136,16 @@ const ModelTrajectory * TLML95::getTrajectory(const util::DateTime & tt) const {
   return itra->second;
 }
 // -----------------------------------------------------------------------------
+const std::vector<std::vector<float>> &
+TLML95::getTrajectorySingle(const util::DateTime & tt) const {
+  auto itra = trajSingle_.find(tt);
+  if (itra == trajSingle_.end()) {
+    oops::Log::error() << "TLML95: trajectory not available at time " << tt << std::endl;
+    ABORT("TLML95: trajectory not available");
+  }
+  return itra->second;
+}
+// -----------------------------------------------------------------------------
 /// Run TLM and its adjoint
 // -----------------------------------------------------------------------------
 void TLML95::initializeTL(IncrementL95 &) const {}
@@ -76,118 +154,140 @@ void TLML95::initializeAD(IncrementL95 &) const {}
 void TLML95::finalizeAD(IncrementL95 &) const {}
 // -----------------------------------------------------------------------------
 void TLML95::stepTL(IncrementL95 & xx, const ModelBiasCorrection & bias) const {
-  FieldL95 dx(xx.getField(), false);
-  FieldL95 zz(xx.getField(), false);
-  FieldL95 dz(xx.getField(), false);
+  if (single_) {
+    this->stepTLSingle(xx, bias);
+    return;
+  }
   const ModelTrajectory * traj = this->getTrajectory(xx.validTime());
+  const int nn = resol_.npoints();
+  const double zb = bias.bias();
+  std::vector<double> & xd = xx.asVector();
+  double * dx = work_.data();
+  double * zz = dx + nn;
+  double * dz = zz + nn;
 
-  zz = xx.getField();
-  this->tendenciesTL(zz, bias.bias(), traj->get(1), dz);
-  dx = dz;
+  tlTendencies(xd.data(), zb, traj->get(1).asVector().data(), dz, nn, dt_);
+  for (int jj = 0; jj < nn; ++jj) dx[jj] = dz[jj];
 
-  zz = xx.getField();
-  zz.axpy(0.5, dz);
-  this->tendenciesTL(zz, bias.bias(), traj->get(2), dz);
-  dx.axpy(2.0, dz);
+  for (int jj = 0; jj < nn; ++jj) zz[jj] = xd[jj] + 0.5 * dz[jj];
+  tlTendencies(zz, zb, traj->get(2).asVector().data(), dz, nn, dt_);
+  for (int jj = 0; jj < nn; ++jj) dx[jj] += 2.0 * dz[jj];
 
-  zz = xx.getField();
-  zz.axpy(0.5, dz);
-  this->tendenciesTL(zz, bias.bias(), traj->get(3), dz);
-  dx.axpy(2.0, dz);
+  for (int jj = 0; jj < nn; ++jj) zz[jj] = xd[jj] + 0.5 * dz[jj];
+  tlTendencies(zz, zb, traj->get(3).asVector().data(), dz, nn, dt_);
+  for (int jj = 0; jj < nn; ++jj) dx[jj] += 2.0 * dz[jj];
 
-  zz = xx.getField();
-  zz += dz;
-  this->tendenciesTL(zz, bias.bias(), traj->get(4), dz);
-  dx += dz;
+  for (int jj = 0; jj < nn; ++jj) zz[jj] = xd[jj] + dz[jj];
+  tlTendencies(zz, zb, traj->get(4).asVector().data(), dz, nn, dt_);
+  for (int jj = 0; jj < nn; ++jj) dx[jj] += dz[jj];
 
   const double zt = 1.0/6.0;
-  xx.getField().axpy(zt, dx);
+  for (int jj = 0; jj < nn; ++jj) xd[jj] += zt * dx[jj];
   xx.validTime() += tstep_;
 }
 // -----------------------------------------------------------------------------
 void TLML95::stepAD(IncrementL95 & xx, ModelBiasCorrection & bias) const {
-  FieldL95 dx(xx.getField(), false);
-  FieldL95 zz(xx.getField(), false);
-  FieldL95 dz(xx.getField(), false);
-
+  if (single_) {
+    this->stepADSingle(xx, bias);
+    return;
+  }
   xx.validTime() -= tstep_;
   const ModelTrajectory * traj = this->getTrajectory(xx.validTime());
+  const int nn = resol_.npoints();
+  std::vector<double> & xd = xx.asVector();
+  double * dx = work_.data();
+  double * zz = dx + nn;
+  double * dz = zz + nn;
 
   const double zt = 1.0/6.0;
-  dx = xx.getField();
-  dx *= zt;
-
-  dz = dx;
-  this->tendenciesAD(zz, bias.bias(), traj->get(4), dz);
-  xx.getField() += zz;
-  dz = zz;
-
-  dz.axpy(2.0, dx);
-  this->tendenciesAD(zz, bias.bias(), traj->get(3), dz);
-  xx.getField() += zz;
-  dz = zz;
-  dz *= 0.5;
-
-  dz.axpy(2.0, dx);
-  this->tendenciesAD(zz, bias.bias(), traj->get(2), dz);
-  xx.getField() += zz;
-  dz = zz;
-  dz *= 0.5;
-
-  dz += dx;
-  this->tendenciesAD(zz, bias.bias(), traj->get(1), dz);
-  xx.getField() += zz;
+  for (int jj = 0; jj < nn; ++jj) dx[jj] = xd[jj] * zt;
+
+  adTendencies(zz, bias.bias(), traj->get(4).asVector().data(), dx, nn, dt_);
+  for (int jj = 0; jj < nn; ++jj) xd[jj] += zz[jj];
+
+  for (int jj = 0; jj < nn; ++jj) dz[jj] = zz[jj] + 2.0 * dx[jj];
+  adTendencies(zz, bias.bias(), traj->get(3).asVector().data(), dz, nn, dt_);
+  for (int jj = 0; jj < nn; ++jj) xd[jj] += zz[jj];
+
+  for (int jj = 0; jj < nn; ++jj) dz[jj] = zz[jj] * 0.5 + 2.0 * dx[jj];
+  adTendencies(zz, bias.bias(), traj->get(2).asVector().data(), dz, nn, dt_);
+  for (int jj = 0; jj < nn; ++jj) xd[jj] += zz[jj];
+
+  for (int jj = 0; jj < nn; ++jj) dz[jj] = zz[jj] * 0.5 + dx[jj];
+  adTendencies(zz, bias.bias(), traj->get(1).asVector().data(), dz, nn, dt_);
+  for (int jj = 0; jj < nn; ++jj) xd[jj] += zz[jj];
 }
 // -----------------------------------------------------------------------------
-// intel 19 tries to aggressive optimize these functions in a way that leads
-// to memory violations.  So, turn off optimizations.
-#ifdef __INTEL_COMPILER
-#pragma optimize("", off)
-#endif
-void TLML95::tendenciesTL(const FieldL95 & xx, const double & bias,
-                          const FieldL95 & xtraj, FieldL95 & dx) const {
+void TLML95::stepTLSingle(IncrementL95 & xx, const ModelBiasCorrection & bias) const {
+// Same Runge-Kutta steps as stepTL, in single precision
+  const std::vector<std::vector<float>> & traj = this->getTrajectorySingle(xx.validTime());
   const int nn = resol_.npoints();
-  for (int jj = 0; jj < nn; ++jj) {
-    int jm2 = jj - 2;
-    int jm1 = jj - 1;
-    int jp1 = jj + 1;
-    if (jm2 < 0) jm2 += nn;
-    if (jm1 < 0) jm1 += nn;
-    if (jp1 >= nn) jp1 -= nn;
-    const double dxdt = - xx[jm2] * xtraj[jm1] - xtraj[jm2] * xx[jm1]
-                        + xx[jm1] * xtraj[jp1] + xtraj[jm1] * xx[jp1]
-                        - xx[jj] - bias;
-    dx[jj] = dt_ * dxdt;
-  }
+  const float zb = bias.bias();
+  const float dt = dt_;
+  std::vector<double> & xd = xx.asVector();
+  float * x0 = workSingle_.data();
+  float * dx = x0 + nn;
+  float * zz = dx + nn;
+  float * dz = zz + nn;
+  for (int jj = 0; jj < nn; ++jj) x0[jj] = xd[jj];
+
+  tlTendencies(x0, zb, traj[0].data(), dz, nn, dt);
+  for (int jj = 0; jj < nn; ++jj) dx[jj] = dz[jj];
+
+  for (int jj = 0; jj < nn; ++jj) zz[jj] = x0[jj] + 0.5f * dz[jj];
+  tlTendencies(zz, zb, traj[1].data(), dz, nn, dt);
+  for (int jj = 0; jj < nn; ++jj) dx[jj] += 2.0f * dz[jj];
+
+  for (int jj = 0; jj < nn; ++jj) zz[jj] = x0[jj] + 0.5f * dz[jj];
+  tlTendencies(zz, zb, traj[2].data(), dz, nn, dt);
+  for (int jj = 0; jj < nn; ++jj) dx[jj] += 2.0f * dz[jj];
+
+  for (int jj = 0; jj < nn; ++jj) zz[jj] = x0[jj] + dz[jj];
+  tlTendencies(zz, zb, traj[3].data(), dz, nn, dt);
+  for (int jj = 0; jj < nn; ++jj) dx[jj] += dz[jj];
+
+  const float zt = 1.0f/6.0f;
+  for (int jj = 0; jj < nn; ++jj) xd[jj] += zt * dx[jj];
+  xx.validTime() += tstep_;
 }
 // -----------------------------------------------------------------------------
-void TLML95::tendenciesAD(FieldL95 & xx, double & bias,
-                          const FieldL95 & xtraj, const FieldL95 & dx) const {
+void TLML95::stepADSingle(IncrementL95 & xx, ModelBiasCorrection & bias) const {
+// Adjoint of stepTLSingle
+  xx.validTime() -= tstep_;
+  const std::vector<std::vector<float>> & traj = this->getTrajectorySingle(xx.validTime());
   const int nn = resol_.npoints();
-  xx.zero();
-  for (int jj = 0; jj < nn; ++jj) {
-    int jm2 = jj - 2;
-    int jm1 = jj - 1;
-    int jp1 = jj + 1;
-    if (jm2 < 0) jm2 += nn;
-    if (jm1 < 0) jm1 += nn;
-    if (jp1 >= nn) jp1 -= nn;
-    const double dxdt = dt_ * dx[jj];
-    xx[jm2] -= dxdt * xtraj[jm1];
-    xx[jm1] -= dxdt * xtraj[jm2];
-    xx[jm1] += dxdt * xtraj[jp1];
-    xx[jp1] += dxdt * xtraj[jm1];
-    xx[jj] -= dxdt;
-    bias -= dxdt;
-  }
+  const float dt = dt_;
+  std::vector<double> & xd = xx.asVector();
+  float * dx = workSingle_.data();
+  float * zz = dx + nn;
+  float * dz = zz + nn;
+  float * xs = dz + nn;
+  float zb = 0.0f;
+
+  const float zt = 1.0f/6.0f;
+  for (int jj = 0; jj < nn; ++jj) dx[jj] = zt * static_cast<float>(xd[jj]);
+  for (int jj = 0; jj < nn; ++jj) xs[jj] = 0.0f;
+
+  adTendencies(zz, zb, traj[3].data(), dx, nn, dt);
+  for (int jj = 0; jj < nn; ++jj) xs[jj] += zz[jj];
+
+  for (int jj = 0; jj < nn; ++jj) dz[jj] = zz[jj] + 2.0f * dx[jj];
+  adTendencies(zz, zb, traj[2].data(), dz, nn, dt);
+  for (int jj = 0; jj < nn; ++jj) xs[jj] += zz[jj];
+
+  for (int jj = 0; jj < nn; ++jj) dz[jj] = 0.5f * zz[jj] + 2.0f * dx[jj];
+  adTendencies(zz, zb, traj[1].data(), dz, nn, dt);
+  for (int jj = 0; jj < nn; ++jj) xs[jj] += zz[jj];
+
+  for (int jj = 0; jj < nn; ++jj) dz[jj] = 0.5f * zz[jj] + dx[jj];
+  adTendencies(zz, zb, traj[0].data(), dz, nn, dt);
+  for (int jj = 0; jj < nn; ++jj) xd[jj] += xs[jj] + zz[jj];
+  bias.bias() += zb;
 }
-#ifdef __INTEL_COMPILER
-#pragma optimize("", on)
-#endif
 // -----------------------------------------------------------------------------
 void TLML95::print(std::ostream & os) const {
   os << "TLML95: resol = " << resol_ << ", tstep = " << tstep_ << std::endl;
-  os << "L95 Model Trajectory, nstep=" << traj_.size() << std::endl;
+  os << "L95 Model Trajectory, nstep=" << traj_.size() + trajSingle_.size() << std::endl;
   typedef std::map< util::DateTime, ModelTrajectory * >::const_iterator trajICst;
   if (traj_.size() > 0) {
     os << "L95 Model Trajectory: times are:";
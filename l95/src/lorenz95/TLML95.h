@@ -14,6 +14,7 @@
 #include <map>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include <boost/noncopyable.hpp>
 
@@ -21,6 +22,7 @@
 #include "oops/interface/LinearModelBase.h"
 #include "oops/util/Duration.h"
 #include "oops/util/ObjectCounter.h"
+#include "oops/util/parameters/Parameter.h"
 #include "oops/util/Printable.h"
 
 #include "lorenz95/L95Traits.h"
@@ -50,6 +52,8 @@ class TLML95Parameters : public oops::LinearModelParametersBase {
   // TLML95 or on the oops::LinearModel interface. Leaving it in place in case it turns out it is
   // used by some other fragment of code that loads the configuration of the linear model.
   oops::OptionalParameter<std::string> variableChange{"variable change", this};
+  /// Run the TL and AD in single precision, with the trajectory also kept in single precision.
+  oops::Parameter<bool> singlePrecision{"single precision", false, this};
 };
 
 // -----------------------------------------------------------------------------
@@ -83,8 +87,9 @@ class TLML95: public oops::interface::LinearModelBase<L95Traits>,
 
  private:
   const ModelTrajectory * getTrajectory(const util::DateTime &) const;
-  void tendenciesTL(const FieldL95 &, const double &, const FieldL95 &, FieldL95 &) const;
-  void tendenciesAD(FieldL95 &, double &, const FieldL95 &, const FieldL95 &) const;
+  const std::vector<std::vector<float>> & getTrajectorySingle(const util::DateTime &) const;
+  void stepTLSingle(IncrementL95 &, const ModelBiasCorrection &) const;
+  void stepADSingle(IncrementL95 &, ModelBiasCorrection &) const;
   void print(std::ostream &) const override;
 
   typedef std::map< util::DateTime, ModelTrajectory * >::iterator trajIter;
@@ -95,8 +100,12 @@ class TLML95: public oops::interface::LinearModelBase<L95Traits>,
   const util::Duration tstep_;
   const double dt_;
   std::map< util::DateTime, ModelTrajectory * > traj_;
+  const bool single_;
+  std::map< util::DateTime, std::vector<std::vector<float>> > trajSingle_;
   const ModelL95 lrmodel_;
   const oops::Variables vars_;
+  mutable std::vector<double> work_;  // Runge-Kutta workspace of stepTL and stepAD
+  mutable std::vector<float> workSingle_;  // same for stepTLSingle and stepADSingle
 };
 
 // -----------------------------------------------------------------------------
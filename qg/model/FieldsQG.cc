@@ -121,6 +121,12 @@ double FieldsQG::dot_product_with(const FieldsQG & fld2) const {
   return zz;
 }
 // -----------------------------------------------------------------------------
+double FieldsQG::local_dot_product_with(const FieldsQG & fld2) const {
+  double zz;
+  qg_fields_dot_prod_local_f90(keyFlds_, fld2.keyFlds_, zz);
+  return zz;
+}
+// -----------------------------------------------------------------------------
 void FieldsQG::schur_product_with(const FieldsQG & dx) {
     qg_fields_self_schur_f90(keyFlds_, dx.keyFlds_);
 }
@@ -237,13 +243,10 @@ void FieldsQG::setLocal(const oops::LocalIncrement & x, const GeometryQGIterator
 }
 // -----------------------------------------------------------------------------
 size_t FieldsQG::serialSize() const {
-  int nx, ny, nz, lbc;
-  qg_fields_sizes_f90(keyFlds_, nx, ny, nz);
-  qg_fields_lbc_f90(keyFlds_, lbc);
-  size_t nn = nx * ny * nz;
-  if (lbc == 1) {
-    nn += 2 * (nx + 1) * nz;
-  }
+  // Local rows only
+  int vsize;
+  qg_fields_serial_size_f90(keyFlds_, vsize);
+  size_t nn = vsize;
   nn += time_.serialSize();
   return nn;
 }
@@ -71,6 +71,7 @@ class FieldsQG : public util::Printable,
   FieldsQG & operator*=(const double &);
   void axpy(const double &, const FieldsQG &);
   double dot_product_with(const FieldsQG &) const;
+  double local_dot_product_with(const FieldsQG &) const;
   void schur_product_with(const FieldsQG &);
   void dirac(const eckit::Configuration &);
   void random();
@@ -27,8 +27,7 @@ namespace qg {
 // -----------------------------------------------------------------------------
 GeometryQG::GeometryQG(const GeometryQgParameters & params,
                        const eckit::mpi::Comm & comm) : comm_(comm), levs_(0) {
-  ASSERT(comm_.size() == 1);
-  qg_geom_setup_f90(keyGeom_, params.toConfiguration());
+  qg_geom_setup_f90(keyGeom_, params.toConfiguration(), comm_);
 
   int nx = 0;
   int ny = 0;
@@ -53,7 +52,6 @@ GeometryQG::GeometryQG(const GeometryQgParameters & params,
 }
 // -----------------------------------------------------------------------------
 GeometryQG::GeometryQG(const GeometryQG & other) : comm_(other.comm_), levs_(other.levs_) {
-  ASSERT(comm_.size() == 1);
   qg_geom_clone_f90(keyGeom_, other.keyGeom_);
 
   // Copy function space
@@ -78,13 +76,7 @@ GeometryQGIterator GeometryQG::begin() const {
 }
 // -----------------------------------------------------------------------------
 GeometryQGIterator GeometryQG::end() const {
-  int nx = 0;
-  int ny = 0;
-  int nz = 1;
-  double deltax;
-  double deltay;
-  qg_geom_info_f90(keyGeom_, nx, ny, nz, deltax, deltay);
-  return GeometryQGIterator(*this, nx*ny+1);
+  return GeometryQGIterator(*this, functionSpace_.size()+1);
 }
 // -------------------------------------------------------------------------------------------------
 void GeometryQG::latlon(std::vector<double> & lats, std::vector<double> & lons, const bool) const {
@@ -98,6 +90,12 @@ void GeometryQG::latlon(std::vector<double> & lats, std::vector<double> & lons,
   }
 }
 // -------------------------------------------------------------------------------------------------
+int GeometryQG::closestTask(const double lat, const double lon) const {
+  int itask = 0;
+  qg_geom_closest_task_f90(keyGeom_, lat, lon, itask);
+  return itask;
+}
+// -------------------------------------------------------------------------------------------------
 std::vector<double> GeometryQG::verticalCoord(std::string & vcUnits) const {
   // returns vertical coordinate in untis of vcUnits
   int nx = 0;
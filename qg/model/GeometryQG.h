@@ -49,12 +49,16 @@ class GeometryQgParameters : public oops::Parameters {
   oops::Parameter<bool> heating{"heating", true, this};
   /// Modified QG option
   oops::Parameter<float> perturbedheat{"perturbed heating", 0, this};
+  /// Number of rows exchanged with the neighbouring latitude bands for the advection
+  oops::Parameter<int> halo{"halo", 4, this};
 };
 
 class GeometryQGIterator;
 
 // -----------------------------------------------------------------------------
 /// GeometryQG handles geometry for QG model.
+/// The grid is distributed in latitude bands over the tasks of the communicator,
+/// functionSpace and the iterators only cover the local band.
 
 class GeometryQG : public util::Printable,
                    private util::ObjectCounter<GeometryQG> {
@@ -83,6 +87,7 @@ class GeometryQG : public util::Printable,
   std::vector<size_t> variableSizes(const oops::Variables & vars) const;
 
   void latlon(std::vector<double> &, std::vector<double> &, const bool) const;
+  int closestTask(const double, const double) const;
 
  private:
   GeometryQG & operator=(const GeometryQG &);
@@ -129,6 +129,16 @@ double IncrementQG::dot_product_with(const IncrementQG & other) const {
   return dot_product(*fields_, *other.fields_);
 }
 // -----------------------------------------------------------------------------
+std::vector<double> IncrementQG::local_dot_products(const std::vector<const IncrementQG *> & lhs,
+                                                    const std::vector<const IncrementQG *> & rhs) {
+  ASSERT(lhs.size() == rhs.size());
+  std::vector<double> zz(lhs.size());
+  for (size_t jj = 0; jj < lhs.size(); ++jj) {
+    zz[jj] = lhs[jj]->fields_->local_dot_product_with(*rhs[jj]->fields_);
+  }
+  return zz;
+}
+// -----------------------------------------------------------------------------
 void IncrementQG::random() {
   fields_->random();
 }
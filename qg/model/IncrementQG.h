@@ -83,6 +83,8 @@ class IncrementQG : public util::Printable,
   IncrementQG & operator*=(const double &);
   void axpy(const double &, const IncrementQG &, const bool check = true);
   double dot_product_with(const IncrementQG &) const;
+  static std::vector<double> local_dot_products(const std::vector<const IncrementQG *> &,
+                                                const std::vector<const IncrementQG *> &);
   void schur_product_with(const IncrementQG &);
   void random();
   void dirac(const eckit::Configuration &);
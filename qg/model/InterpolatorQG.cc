@@ -7,6 +7,7 @@
 
 #include "model/InterpolatorQG.h"
 
+#include <algorithm>
 #include <ostream>
 #include <vector>
 
@@ -70,6 +71,9 @@ void InterpolatorQG::apply(const oops::Variables & vars, const FieldsQG & flds,
   const size_t nvals = vars.size() * nlevs_ * nout;
   std::vector<double> tmp(nvals);
 
+// Called even without any point, as the halo rows are exchanged with the other tasks
+  locs.resize(std::max<size_t>(locs.size(), 1));
+  tmp.resize(std::max<size_t>(nvals, 1));
   qg_fields_getvals_f90(flds.toFortran(), vars, nout, locs[0], nvals, tmp[0]);
 
   size_t ival = 0;
@@ -123,6 +127,9 @@ void InterpolatorQG::applyAD(const oops::Variables & vars, IncrementQG & dx,
     }
   }
 
+// Called even without any point, as the halo rows are exchanged with the other tasks
+  locs.resize(std::max<size_t>(locs.size(), 1));
+  tmp.resize(std::max<size_t>(nvals, 1));
   qg_fields_getvalsad_f90(dx.fields().toFortran(), vars, nout, locs[0], nvals, tmp[0]);
 }
 
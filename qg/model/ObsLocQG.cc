@@ -8,19 +8,15 @@
 #include "model/ObsLocQG.h"
 
 #include <memory>
+#include <vector>
 
-#include "atlas/array.h"
 #include "eckit/geometry/Point2.h"
 #include "eckit/geometry/Point3.h"
-#include "eckit/geometry/Sphere.h"
 
 #include "model/GeometryQGIterator.h"
-#include "model/LocationsQG.h"
 #include "model/ObsSpaceQG.h"
 #include "model/QgTraits.h"
 
-using atlas::array::make_view;
-
 namespace qg {
 
 static oops::ObsLocalizationMaker<QgTraits, QgObsTraits, ObsLocQG> makerObsLoc_("Heaviside");
@@ -36,21 +32,41 @@ ObsLocQG::ObsLocQG(const Parameters_ & params, const ObsSpaceQG & obsdb)
 
 void ObsLocQG::computeLocalization(const GeometryQGIterator & p,
                                    ObsVecQG & local) const {
-  std::unique_ptr<LocationsQG> locs = obsdb_.locations();
-  atlas::Field field_lonlat = locs->lonlat();
-  auto lonlat = make_view<double, 2>(field_lonlat);
   eckit::geometry::Point3 refPoint = *p;
   eckit::geometry::Point2 refPoint2(refPoint[0], refPoint[1]);
-
-  for (int jj = 0; jj < locs->size(); ++jj) {
-    eckit::geometry::Point2 obsPoint(lonlat(jj, 0), lonlat(jj, 1));
-    double localDist = eckit::geometry::Sphere::distance(6.371e6, refPoint2, obsPoint);
-    if (localDist > lengthscale_) {
-      local.setToMissing(jj);
+  std::vector<size_t> indices;
+  std::vector<double> dists;
+  obsdb_.localObs(refPoint2, lengthscale_, indices, dists);
+
+  size_t jloc = 0;
+  for (int jj = 0; jj < obsdb_.nobs(); ++jj) {
+    if (jloc < indices.size() && indices[jloc] == static_cast<size_t>(jj)) {
+      ++jloc;
     } else {
-      local *= 1.0;
+      local.setToMissing(jj);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+bool ObsLocQG::computeLocalObs(const GeometryQGIterator & p, oops::LocalObs & local) const {
+  eckit::geometry::Point3 refPoint = *p;
+  eckit::geometry::Point2 refPoint2(refPoint[0], refPoint[1]);
+  std::vector<size_t> indices;
+  std::vector<double> dists;
+  obsdb_.localObs(refPoint2, lengthscale_, indices, dists);
+
+  // all values at a local observation location are local
+  const size_t nval = obsdb_.assimvariables().size();
+  local.indices.resize(indices.size() * nval);
+  for (size_t jloc = 0; jloc < indices.size(); ++jloc) {
+    for (size_t jval = 0; jval < nval; ++jval) {
+      local.indices[jloc * nval + jval] = indices[jloc] * nval + jval;
     }
   }
+  local.values.assign(local.indices.size(), 1.0);
+  return true;
 }
 
 // -----------------------------------------------------------------------------
@@ -41,6 +41,9 @@ class ObsLocQG : public oops::ObsLocalizationBase<QgTraits, QgObsTraits> {
   /// (missing value is for obs outside of localization)
   void computeLocalization(const GeometryQGIterator &, ObsVecQG &) const override;
 
+  /// compute localization values for the observations local to the grid point only
+  bool computeLocalObs(const GeometryQGIterator &, oops::LocalObs &) const override;
+
  private:
   void print(std::ostream &) const override;
   const double lengthscale_;
@@ -14,6 +14,7 @@
 #include <map>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "atlas/array.h"
 #include "atlas/field.h"
@@ -33,6 +34,8 @@ namespace qg {
 // initialization for the static map
 std::map < std::string, F90odb > ObsSpaceQG::theObsFileRegister_;
 int ObsSpaceQG::theObsFileCount_ = 0;
+// Earth radius used for distances between observations and grid points
+static const double earthRadius = 6.371e6;
 
 // -----------------------------------------------------------------------------
 
@@ -159,6 +162,41 @@ int ObsSpaceQG::nobs() const {
 }
 // -----------------------------------------------------------------------------
 
+void ObsSpaceQG::localObs(const eckit::geometry::Point2 & center, const double dist,
+                          std::vector<size_t> & indices, std::vector<double> & dists) const {
+  std::call_once(indexBuilt_, [this]() {
+    std::unique_ptr<LocationsQG> locs = this->locations();
+    auto lonlat = make_view<double, 2>(locs->lonlat());
+    std::vector<eckit::geometry::Point3> points;
+    points.reserve(locs->size());
+    lonlat_.reserve(locs->size());
+    for (int jj = 0; jj < locs->size(); ++jj) {
+      lonlat_.emplace_back(lonlat(jj, 0), lonlat(jj, 1));
+      points.push_back(oops::ObsSpatialIndex::lonLatToCartesian(lonlat(jj, 0), lonlat(jj, 1),
+                                                                earthRadius));
+    }
+    index_.reset(new oops::ObsSpatialIndex(points));
+  });
+  index_->findInSphere(oops::ObsSpatialIndex::lonLatToCartesian(center[0], center[1],
+                                                                earthRadius),
+                       oops::ObsSpatialIndex::chordLength(dist, earthRadius), indices);
+
+  // keep observations within great-circle distance dist
+  size_t nlocal = 0;
+  dists.resize(indices.size());
+  for (size_t jj = 0; jj < indices.size(); ++jj) {
+    const double localDist = eckit::geometry::Sphere::distance(earthRadius, center,
+                                                               lonlat_[indices[jj]]);
+    if (localDist <= dist) {
+      indices[nlocal] = indices[jj];
+      dists[nlocal] = localDist;
+      ++nlocal;
+    }
+  }
+  indices.resize(nlocal);
+  dists.resize(nlocal);
+}
+
 // -----------------------------------------------------------------------------
 ObsIteratorQG ObsSpaceQG::begin() const {
   return ObsIteratorQG(*this->locations(), 0);
@@ -14,14 +14,17 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <vector>
 
+#include "eckit/geometry/Point2.h"
 #include "eckit/mpi/Comm.h"
 
 #include "oops/base/ObsSpaceBase.h"
 #include "oops/base/Variables.h"
+#include "oops/generic/ObsSpatialIndex.h"
 #include "oops/util/DateTime.h"
 #include "oops/util/parameters/OptionalParameter.h"
 #include "oops/util/parameters/Parameters.h"
@@ -127,6 +130,11 @@ class ObsSpaceQG : public oops::ObsSpaceBase {
   /// return number of observations (unique locations)
   int nobs() const;
 
+  /// indices (ascending) and great-circle distances (m) of the observation locations
+  /// within \p dist of \p lonlat
+  void localObs(const eckit::geometry::Point2 & lonlat, const double dist,
+                std::vector<size_t> & indices, std::vector<double> & dists) const;
+
   /// return variables to be processed
   const oops::Variables & obsvariables() const { return obsvars_; }
 
@@ -153,6 +161,9 @@ class ObsSpaceQG : public oops::ObsSpaceBase {
   const util::DateTime winend_;
   oops::Variables assimvars_;          // variables simulated by ObsOperators
   oops::Variables obsvars_;          // variables that are observed
+  mutable std::unique_ptr<oops::ObsSpatialIndex> index_;  // spatial index of the locations
+  mutable std::vector<eckit::geometry::Point2> lonlat_;   // built on first use
+  mutable std::once_flag indexBuilt_;
 
   // defines mapping for Fortran structures
   static std::map < std::string, F90odb > theObsFileRegister_;
@@ -142,6 +142,12 @@ size_t ObsVecQG::packEigenSize(const ObsVecQG & mask) const {
   return nobs;
 }
 // -----------------------------------------------------------------------------
+std::vector<size_t> ObsVecQG::packEigenIndices(const ObsVecQG & mask) const {
+  std::vector<int> ind(packEigenSize(mask));
+  qg_obsvec_get_indices_withmask_f90(keyOvec_, mask.toFortran(), ind.data(), ind.size());
+  return std::vector<size_t>(ind.begin(), ind.end());
+}
+// -----------------------------------------------------------------------------
 void ObsVecQG::read(const std::string & name) {
   obsdb_.getdb(name, keyOvec_);
 }
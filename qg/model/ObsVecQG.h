@@ -15,6 +15,7 @@
 #include <Eigen/Dense>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "oops/util/ObjectCounter.h"
 #include "oops/util/Printable.h"
@@ -47,6 +48,7 @@ class ObsVecQG : public util::Printable,
 
   Eigen::VectorXd packEigen(const ObsVecQG &) const;
   size_t packEigenSize(const ObsVecQG &) const;
+  std::vector<size_t> packEigenIndices(const ObsVecQG &) const;
   size_t size() const;
 
   /// set all values to zero
@@ -22,6 +22,9 @@
 // Forward declarations
 namespace eckit {
   class Configuration;
+  namespace mpi {
+    class Comm;
+  }
 }
 
 namespace oops {
@@ -100,6 +103,7 @@ extern "C" {
   void qg_fields_axpy_f90(const F90flds &, const double &, const F90flds &);
   void qg_fields_self_schur_f90(const F90flds &, const F90flds &);
   void qg_fields_dot_prod_f90(const F90flds &, const F90flds &, double &);
+  void qg_fields_dot_prod_local_f90(const F90flds &, const F90flds &, double &);
   void qg_fields_add_incr_f90(const F90flds &, const F90flds &);
   void qg_fields_diff_incr_f90(const F90flds &, const F90flds &, const F90flds &);
   void qg_fields_change_resol_f90(const F90flds &, const F90flds &);
@@ -125,6 +129,7 @@ extern "C" {
                                const int &, const double &, const int &, const double &);
   void qg_fields_getpoint_f90(const F90flds&, const F90iter&, const int &, double &);
   void qg_fields_setpoint_f90(const F90flds&, const F90iter&, const int &, const double &);
+  void qg_fields_serial_size_f90(const F90flds &, int &);
   void qg_fields_serialize_f90(const F90flds &, const int &, double[]);
   void qg_fields_deserialize_f90(const F90flds &, const int &, const double[], int &);
 
@@ -147,13 +152,14 @@ extern "C" {
 // -----------------------------------------------------------------------------
 //  Geometry
 // -----------------------------------------------------------------------------
-  void qg_geom_setup_f90(F90geom &, const eckit::Configuration &);
+  void qg_geom_setup_f90(F90geom &, const eckit::Configuration &, const eckit::mpi::Comm &);
   void qg_geom_set_lonlat_f90(const F90geom &, atlas::field::FieldSetImpl *);
   void qg_geom_set_functionspace_pointer_f90(const F90geom &,
                                                    atlas::functionspace::FunctionSpaceImpl *);
   void qg_geom_fill_extra_fields_f90(const F90geom &, atlas::field::FieldSetImpl *);
   void qg_geom_clone_f90(F90geom &, const F90geom &);
   void qg_geom_info_f90(const F90geom &, int &, int &, int &, double &, double &);
+  void qg_geom_closest_task_f90(const F90geom &, const double &, const double &, int &);
   void qg_geom_delete_f90(F90geom &);
   void qg_geom_dimensions_f90(double &, double &, double &, double &, double &);
 
@@ -253,6 +259,9 @@ extern "C" {
   void qg_obsvec_get_withmask_f90(const F90ovec &, const F90ovec & mask_key,
                                   double * data, const int & nobs);
   void qg_obsvec_nobs_withmask_f90(const F90ovec &, const F90ovec & mask_key, int &);
+  /// fill \p indices (size \p nobs) with indices of all non-masked out (non-missing) values
+  void qg_obsvec_get_indices_withmask_f90(const F90ovec &, const F90ovec & mask_key,
+                                          int * indices, const int & nobs);
 
 
 // -----------------------------------------------------------------------------
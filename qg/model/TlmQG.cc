@@ -35,6 +35,7 @@ static oops::interface::LinearModelMaker<QgTraits, TlmQG> makerQGTLM_("QgTLM");
 // -----------------------------------------------------------------------------
 TlmQG::TlmQG(const GeometryQG & resol, const eckit::Configuration & tlConf)
   : keyConfig_(0), tstep_(), resol_(resol), traj_(),
+    packed_(tlConf.getString("trajectory packing", "double")), work_(0), vals_(),
     lrmodel_(resol_,
              oops::validateAndDeserialize<ModelQgParameters>(
                eckit::LocalConfiguration(tlConf, "trajectory"))),
@@ -52,6 +53,7 @@ TlmQG::~TlmQG() {
   for (trajIter jtra = traj_.begin(); jtra != traj_.end(); ++jtra) {
     qg_fields_delete_f90(jtra->second);
   }
+  if (work_ != 0) qg_fields_delete_f90(work_);
   oops::Log::trace() << "TlmQG destructed" << std::endl;
 }
 // -----------------------------------------------------------------------------
@@ -59,7 +61,40 @@ void TlmQG::setTrajectory(const StateQG & xx, StateQG & xlr, const ModelBias & b
 // StateQG xlr(resol_, xx);
   xlr.changeResolution(xx);
   int ftraj = lrmodel_.saveTrajectory(xlr, bias);
-  traj_[xx.validTime()] = ftraj;
+  if (packed_.packing() == "double") {
+    traj_[xx.validTime()] = ftraj;
+  } else {
+    int vsize;
+    qg_fields_serial_size_f90(ftraj, vsize);
+    vals_.resize(vsize);
+    qg_fields_serialize_f90(ftraj, vsize, vals_.data());
+    packed_.put(xx.validTime(), vals_);
+    // The first saved fields are kept to unpack the trajectory into
+    if (work_ == 0) {
+      work_ = ftraj;
+    } else {
+      qg_fields_delete_f90(ftraj);
+    }
+  }
+}
+// -----------------------------------------------------------------------------
+F90flds TlmQG::trajectory(const util::DateTime & tt) const {
+  if (packed_.packing() == "double") {
+    trajICst itra = traj_.find(tt);
+    if (itra == traj_.end()) {
+      oops::Log::error() << "TlmQG: trajectory not available at time " << tt << std::endl;
+      ABORT("TlmQG: trajectory not available");
+    }
+    return itra->second;
+  }
+  if (!packed_.has(tt)) {
+    oops::Log::error() << "TlmQG: trajectory not available at time " << tt << std::endl;
+    ABORT("TlmQG: trajectory not available");
+  }
+  packed_.get(tt, vals_);
+  int index = 0;
+  qg_fields_deserialize_f90(work_, static_cast<int>(vals_.size()), vals_.data(), index);
+  return work_;
 }
 // -----------------------------------------------------------------------------
 void TlmQG::initializeTL(IncrementQG & dx) const {
@@ -67,13 +102,9 @@ void TlmQG::initializeTL(IncrementQG & dx) const {
 }
 // -----------------------------------------------------------------------------
 void TlmQG::stepTL(IncrementQG & dx, const ModelBiasIncrement &) const {
-  trajICst itra = traj_.find(dx.validTime());
-  if (itra == traj_.end()) {
-    oops::Log::error() << "TlmQG: trajectory not available at time " << dx.validTime() << std::endl;
-    ABORT("TlmQG: trajectory not available");
-  }
+  const F90flds ftraj = trajectory(dx.validTime());
   ASSERT(dx.fields().isForModel(false));
-  qg_model_propagate_tl_f90(keyConfig_, itra->second, dx.fields().toFortran());
+  qg_model_propagate_tl_f90(keyConfig_, ftraj, dx.fields().toFortran());
   dx.validTime() += tstep_;
 }
 // -----------------------------------------------------------------------------
@@ -85,18 +116,18 @@ void TlmQG::initializeAD(IncrementQG & dx) const {
 // -----------------------------------------------------------------------------
 void TlmQG::stepAD(IncrementQG & dx, ModelBiasIncrement &) const {
   dx.validTime() -= tstep_;
-  trajICst itra = traj_.find(dx.validTime());
-  if (itra == traj_.end()) {
-    oops::Log::error() << "TlmQG: trajectory not available at time " << dx.validTime() << std::endl;
-    ABORT("TlmQG: trajectory not available");
-  }
+  const F90flds ftraj = trajectory(dx.validTime());
   ASSERT(dx.fields().isForModel(false));
-  qg_model_propagate_ad_f90(keyConfig_, itra->second, dx.fields().toFortran());
+  qg_model_propagate_ad_f90(keyConfig_, ftraj, dx.fields().toFortran());
 }
 // -----------------------------------------------------------------------------
 void TlmQG::finalizeAD(IncrementQG & dx) const {}
 // -----------------------------------------------------------------------------
 void TlmQG::print(std::ostream & os) const {
+  if (packed_.packing() != "double") {
+    os << "QG TLM " << packed_ << std::endl;
+    return;
+  }
   os << "QG TLM Trajectory, nstep=" << traj_.size() << std::endl;
   typedef std::map< util::DateTime, int >::const_iterator trajICst;
   if (traj_.size() > 0) {
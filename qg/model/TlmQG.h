@@ -14,6 +14,7 @@
 #include <map>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include <boost/noncopyable.hpp>
 
@@ -22,6 +23,7 @@
 #include "oops/util/Duration.h"
 #include "oops/util/ObjectCounter.h"
 #include "oops/util/Printable.h"
+#include "oops/util/TrajectoryStore.h"
 
 #include "oops/qg/ModelQG.h"
 #include "oops/qg/QgFortran.h"
@@ -66,6 +68,7 @@ class TlmQG: public oops::interface::LinearModelBase<QgTraits>,
   const oops::Variables & variables() const override {return linvars_;}
 
  private:
+  F90flds trajectory(const util::DateTime &) const;
   void print(std::ostream &) const override;
   typedef std::map< util::DateTime, int >::iterator trajIter;
   typedef std::map< util::DateTime, int >::const_iterator trajICst;
@@ -75,6 +78,9 @@ class TlmQG: public oops::interface::LinearModelBase<QgTraits>,
   util::Duration tstep_;
   const GeometryQG resol_;
   std::map< util::DateTime, F90flds> traj_;
+  util::TrajectoryStore packed_;  // used instead of traj_ unless packing is "double"
+  mutable F90flds work_;          // unpacked trajectory step
+  mutable std::vector<double> vals_;  // serialized trajectory step
   const ModelQG lrmodel_;
   oops::Variables linvars_;
 };
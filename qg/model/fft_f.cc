@@ -9,6 +9,7 @@
 
 #include <unsupported/Eigen/FFT>
 #include <cmath>
+#include <complex>
 #include <vector>
 
 #include "oops/util/Logger.h"
@@ -16,41 +17,80 @@
 // -----------------------------------------------------------------------------
 namespace qg {
 // -----------------------------------------------------------------------------
+namespace {
 
-void fft_fwd_f(const int & kk, const double * xx, double * ff) {
-  static Eigen::FFT<double> fft;
-  std::vector<double> grid(kk);
-  const unsigned int size = kk/2+1;
-  std::vector<std::complex<double> > coefs(size);
+// Each thread has its own FFT engine (Eigen caches the plans by size in it) and work buffers,
+// so that transforms can be called from OpenMP parallel regions and repeated transforms of the
+// same size do not allocate.
+struct FFTEngine {
+  Eigen::FFT<double> fft;
+  std::vector<double> grid;
+  std::vector<std::complex<double> > coefs;
+};
 
-  for (int jj = 0; jj < kk; ++jj) grid[jj] = xx[jj];
+FFTEngine & engine() {
+  static thread_local FFTEngine eng;
+  return eng;
+}
 
-  fft.fwd(coefs, grid);
+}  // namespace
+// -----------------------------------------------------------------------------
 
-  for (unsigned int jj = 0; jj < size; ++jj) {
-    ff[2*jj]   = coefs[jj].real();
-    ff[2*jj+1] = coefs[jj].imag();
-  }
+void fft_fwd_f(const int & kk, const double * xx, double * ff) {
+  const int one = 1;
+  fft_fwd_batch_f(kk, one, xx, ff);
 }
 
 // -----------------------------------------------------------------------------
 
 void fft_inv_f(const int & kk, const double * ff, double * xx) {
-  static Eigen::FFT<double> fft;
-  std::vector<double> grid(kk);
-  std::vector<std::complex<double> > coefs(kk);
+  const int one = 1;
+  fft_inv_batch_f(kk, one, ff, xx);
+}
 
-  const std::complex<double> zero(0.0, 0.0);
+// -----------------------------------------------------------------------------
+
+void fft_fwd_batch_f(const int & kk, const int & nrows, const double * xx, double * ff) {
+  FFTEngine & eng = engine();
   const int size = kk/2+1;
-  for (int jj = 0; jj < size; ++jj) {
-    std::complex<double> zz(ff[2*jj], ff[2*jj+1]);
-    coefs[jj] = zz;
+  eng.grid.resize(kk);
+  eng.coefs.resize(size);
+
+  for (int jr = 0; jr < nrows; ++jr) {
+    const double * xrow = xx + jr * kk;
+    double * frow = ff + jr * (kk + 2);
+    for (int jj = 0; jj < kk; ++jj) eng.grid[jj] = xrow[jj];
+
+    eng.fft.fwd(eng.coefs, eng.grid);
+
+    for (int jj = 0; jj < size; ++jj) {
+      frow[2*jj]   = eng.coefs[jj].real();
+      frow[2*jj+1] = eng.coefs[jj].imag();
+    }
   }
-  for (int jj = size; jj < kk; ++jj) coefs[jj] = zero;
+}
+
+// -----------------------------------------------------------------------------
 
-  fft.inv(grid, coefs);
+void fft_inv_batch_f(const int & kk, const int & nrows, const double * ff, double * xx) {
+  FFTEngine & eng = engine();
+  const std::complex<double> zero(0.0, 0.0);
+  const int size = kk/2+1;
+  eng.grid.resize(kk);
+  eng.coefs.resize(kk);
+
+  for (int jr = 0; jr < nrows; ++jr) {
+    const double * frow = ff + jr * (kk + 2);
+    double * xrow = xx + jr * kk;
+    for (int jj = 0; jj < size; ++jj) {
+      eng.coefs[jj] = std::complex<double>(frow[2*jj], frow[2*jj+1]);
+    }
+    for (int jj = size; jj < kk; ++jj) eng.coefs[jj] = zero;
 
-  for (int jj = 0; jj < kk; ++jj) xx[jj] = grid[jj];
+    eng.fft.inv(eng.grid, eng.coefs);
+
+    for (int jj = 0; jj < kk; ++jj) xrow[jj] = eng.grid[jj];
+  }
 }
 
 // -----------------------------------------------------------------------------
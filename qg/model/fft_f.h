@@ -12,6 +12,9 @@ namespace qg {
 extern "C" {
   void fft_fwd_f(const int &, const double *, double *);
   void fft_inv_f(const int &, const double *, double *);
+  /// Transforms of nrows contiguous rows: grid rows of kk values, spectral rows of kk+2 values
+  void fft_fwd_batch_f(const int &, const int &, const double *, double *);
+  void fft_inv_batch_f(const int &, const int &, const double *, double *);
 }
 }  // namespace qg
 
@@ -0,0 +1,59 @@
+/*
+ * (C) Copyright 2017-2020 UCAR
+ * 
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0. 
+ */
+
+#include "model/qg_comm_f.h"
+
+#include "eckit/exception/Exceptions.h"
+#include "eckit/mpi/Comm.h"
+
+// -----------------------------------------------------------------------------
+namespace qg {
+// -----------------------------------------------------------------------------
+
+void qg_comm_size_f(const eckit::mpi::Comm & comm, int & size) {
+  size = static_cast<int>(comm.size());
+}
+
+// -----------------------------------------------------------------------------
+
+void qg_comm_rank_f(const eckit::mpi::Comm & comm, int & rank) {
+  rank = static_cast<int>(comm.rank());
+}
+
+// -----------------------------------------------------------------------------
+
+void qg_comm_allreduce_f(const eckit::mpi::Comm & comm, const int & op, const int & nn,
+                         double * vals) {
+  if (op == 0) {
+    comm.allReduceInPlace(vals, vals + nn, eckit::mpi::Operation::SUM);
+  } else if (op == 1) {
+    comm.allReduceInPlace(vals, vals + nn, eckit::mpi::Operation::MIN);
+  } else if (op == 2) {
+    comm.allReduceInPlace(vals, vals + nn, eckit::mpi::Operation::MAX);
+  } else {
+    throw eckit::BadValue("qg_comm_allreduce_f: unknown operation");
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void qg_comm_allgatherv_f(const eckit::mpi::Comm & comm, const int & nn, const double * sendbuf,
+                          const int * recvcounts, const int * displs, double * recvbuf) {
+  comm.allGatherv(sendbuf, sendbuf + nn, recvbuf, recvcounts, displs);
+}
+
+// -----------------------------------------------------------------------------
+
+void qg_comm_alltoallv_f(const eckit::mpi::Comm & comm, const double * sendbuf,
+                         const int * sendcounts, const int * sdispls, double * recvbuf,
+                         const int * recvcounts, const int * rdispls) {
+  comm.allToAllv(sendbuf, sendcounts, sdispls, recvbuf, recvcounts, rdispls);
+}
+
+// -----------------------------------------------------------------------------
+
+}  // namespace qg
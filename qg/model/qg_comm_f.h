@@ -0,0 +1,32 @@
+/*
+ * (C) Copyright 2017-2020 UCAR
+ * 
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0. 
+ */
+
+#ifndef QG_MODEL_QG_COMM_F_H_
+#define QG_MODEL_QG_COMM_F_H_
+
+namespace eckit {
+  namespace mpi {
+    class Comm;
+  }
+}
+
+namespace qg {
+
+extern "C" {
+  void qg_comm_size_f(const eckit::mpi::Comm &, int &);
+  void qg_comm_rank_f(const eckit::mpi::Comm &, int &);
+  /// In-place reduction of nn values: op is 0 for sum, 1 for min, 2 for max
+  void qg_comm_allreduce_f(const eckit::mpi::Comm &, const int &, const int &, double *);
+  void qg_comm_allgatherv_f(const eckit::mpi::Comm &, const int &, const double *,
+                            const int *, const int *, double *);
+  void qg_comm_alltoallv_f(const eckit::mpi::Comm &, const double *, const int *, const int *,
+                           double *, const int *, const int *);
+}
+
+}  // namespace qg
+
+#endif  // QG_MODEL_QG_COMM_F_H_
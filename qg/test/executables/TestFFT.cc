@@ -0,0 +1,107 @@
+/*
+ * (C) Copyright 2023 UCAR
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "eckit/config/LocalConfiguration.h"
+#include "eckit/testing/Test.h"
+#include "model/fft_f.h"
+#include "oops/runs/Run.h"
+#include "oops/runs/Test.h"
+#include "test/TestEnvironment.h"
+
+namespace test {
+
+// -----------------------------------------------------------------------------
+/// Grid rows with several wavenumbers
+std::vector<double> fftRows(const int kk, const int nrows) {
+  std::vector<double> xx(kk * nrows);
+  for (int jr = 0; jr < nrows; ++jr) {
+    for (int jj = 0; jj < kk; ++jj) {
+      const double zx = 2.0 * M_PI * static_cast<double>(jj) / static_cast<double>(kk);
+      xx[jr * kk + jj] = 1.0 + jr + std::cos(zx + 0.1 * jr) + 0.5 * std::sin(3.0 * zx - jr)
+                         + 1.0e-2 * ((jj * 7 + jr * 3) % 5);
+    }
+  }
+  return xx;
+}
+
+// -----------------------------------------------------------------------------
+/// Batched transforms of nrows rows against the transforms of each row
+void checkBatch(const int kk, const int nrows, const double tol) {
+  const std::vector<double> xx = fftRows(kk, nrows);
+  std::vector<double> ff(nrows * (kk + 2));
+  qg::fft_fwd_batch_f(kk, nrows, xx.data(), ff.data());
+
+  std::vector<double> frow(kk + 2);
+  std::vector<double> xrow(kk);
+  for (int jr = 0; jr < nrows; ++jr) {
+    qg::fft_fwd_f(kk, xx.data() + jr * kk, frow.data());
+    for (int jj = 0; jj < kk + 2; ++jj) EXPECT(frow[jj] == ff[jr * (kk + 2) + jj]);
+  }
+
+  std::vector<double> yy(kk * nrows);
+  qg::fft_inv_batch_f(kk, nrows, ff.data(), yy.data());
+  for (int jr = 0; jr < nrows; ++jr) {
+    qg::fft_inv_f(kk, ff.data() + jr * (kk + 2), xrow.data());
+    for (int jj = 0; jj < kk; ++jj) {
+      EXPECT(xrow[jj] == yy[jr * kk + jj]);
+      EXPECT(std::abs(yy[jr * kk + jj] - xx[jr * kk + jj]) <= tol);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+CASE("qg/fft/batch") {
+  const eckit::LocalConfiguration conf(TestEnvironment::config(), "fft");
+  const double tol = conf.getDouble("tolerance");
+  const int nrows = conf.getInt("number of rows");
+  for (const int kk : conf.getIntVector("sizes")) {
+    checkBatch(kk, nrows, tol);
+    checkBatch(kk, 1, tol);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+CASE("qg/fft/threads") {
+// Each thread has its own FFT engine: concurrent transforms of different sizes
+  const eckit::LocalConfiguration conf(TestEnvironment::config(), "fft");
+  const double tol = conf.getDouble("tolerance");
+  const int nrows = conf.getInt("number of rows");
+  std::vector<std::thread> threads;
+  for (const int kk : conf.getIntVector("sizes")) {
+    threads.emplace_back([kk, nrows, tol]() {
+      for (int jj = 0; jj < 10; ++jj) checkBatch(kk, nrows, tol);
+    });
+  }
+  for (std::thread & thread : threads) thread.join();
+}
+
+// -----------------------------------------------------------------------------
+
+class FFT : public oops::Test {
+ private:
+  std::string testid() const override {return "test::FFT";}
+
+  void register_tests() const override {}
+  void clear() const override {}
+};
+
+// -----------------------------------------------------------------------------
+
+}  // namespace test
+
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  test::FFT tests;
+  return run.execute(tests);
+}
@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "eckit/config/Configuration.h"
+#include "eckit/exception/Exceptions.h"
 #include "oops/assimilation/ControlVariable.h"
 #include "oops/base/Geometry.h"
 #include "oops/base/Increment.h"
@@ -75,7 +76,11 @@ class ControlIncrement : public util::Printable,
   ControlIncrement & operator-=(const ControlIncrement &);
   ControlIncrement & operator*=(const double);
   void axpy(const double, const ControlIncrement &);
+  void multi_axpy(const std::vector<double> &, const std::vector<const ControlIncrement *> &);
   double dot_product_with(const ControlIncrement &) const;
+  std::vector<double> dot_products_with(const std::vector<const ControlIncrement *> &) const;
+  static std::vector<double> dot_products(const std::vector<const ControlIncrement *> &,
+                                          const std::vector<const ControlIncrement *> &);
   void schur_product_with(const ControlIncrement & other);
 
   /// Set this ControlIncrement to be difference between \p cvar1 and \p cvar2
@@ -215,6 +220,19 @@ void ControlIncrement<MODEL, OBS>::axpy(const double zz, const ControlIncrement
 }
 // -----------------------------------------------------------------------------
 template<typename MODEL, typename OBS>
+void ControlIncrement<MODEL, OBS>::multi_axpy(const std::vector<double> & ww,
+                                              const std::vector<const ControlIncrement *> & rhs) {
+  ASSERT(ww.size() == rhs.size());
+  std::vector<const Increment_ *> incs(rhs.size());
+  for (size_t jj = 0; jj < rhs.size(); ++jj) incs[jj] = &rhs[jj]->increment_;
+  increment_.multi_axpy(ww, incs);
+  for (size_t jj = 0; jj < rhs.size(); ++jj) {
+    modbias_.axpy(ww[jj], rhs[jj]->modbias_);
+    obsbias_.axpy(ww[jj], rhs[jj]->obsbias_);
+  }
+}
+// -----------------------------------------------------------------------------
+template<typename MODEL, typename OBS>
 void ControlIncrement<MODEL, OBS>::read(const eckit::Configuration & config) {
   increment_.read(config);
   modbias_.read(config);
@@ -245,6 +263,38 @@ double ControlIncrement<MODEL, OBS>::dot_product_with(const ControlIncrement & x
 }
 // -----------------------------------------------------------------------------
 template<typename MODEL, typename OBS>
+std::vector<double> ControlIncrement<MODEL, OBS>::dot_products_with(
+                                         const std::vector<const ControlIncrement *> & others) const {
+  std::vector<const Increment_ *> incs(others.size());
+  for (size_t jj = 0; jj < others.size(); ++jj) incs[jj] = &others[jj]->increment_;
+  std::vector<double> zz = increment_.dot_products_with(incs);
+  for (size_t jj = 0; jj < others.size(); ++jj) {
+    zz[jj] += dot_product(modbias_, others[jj]->modbias_);
+    zz[jj] += dot_product(obsbias_, others[jj]->obsbias_);
+  }
+  return zz;
+}
+// -----------------------------------------------------------------------------
+template<typename MODEL, typename OBS>
+std::vector<double> ControlIncrement<MODEL, OBS>::dot_products(
+                                               const std::vector<const ControlIncrement *> & lhs,
+                                               const std::vector<const ControlIncrement *> & rhs) {
+  ASSERT(lhs.size() == rhs.size());
+  std::vector<const Increment_ *> lhsinc(lhs.size());
+  std::vector<const Increment_ *> rhsinc(rhs.size());
+  for (size_t jj = 0; jj < lhs.size(); ++jj) {
+    lhsinc[jj] = &lhs[jj]->increment_;
+    rhsinc[jj] = &rhs[jj]->increment_;
+  }
+  std::vector<double> zz = Increment_::dot_products(lhsinc, rhsinc);
+  for (size_t jj = 0; jj < lhs.size(); ++jj) {
+    zz[jj] += dot_product(lhs[jj]->modbias_, rhs[jj]->modbias_);
+    zz[jj] += dot_product(lhs[jj]->obsbias_, rhs[jj]->obsbias_);
+  }
+  return zz;
+}
+// -----------------------------------------------------------------------------
+template<typename MODEL, typename OBS>
 void ControlIncrement<MODEL, OBS>::schur_product_with(const ControlIncrement & other) {
   increment_.schur_product_with(other.increment_);
 }
@@ -16,6 +16,7 @@
 #include <string>
 #include <vector>
 
+#include "eckit/config/LocalConfiguration.h"
 #include "oops/assimilation/BMatrix.h"
 #include "oops/assimilation/CMatrix.h"
 #include "oops/assimilation/ControlIncrement.h"
@@ -24,6 +25,7 @@
 #include "oops/assimilation/HtRinvHMatrix.h"
 #include "oops/assimilation/MinimizerUtils.h"
 #include "oops/assimilation/QNewtonLMP.h"
+#include "oops/assimilation/VectorStore.h"
 #include "oops/util/dot_product.h"
 #include "oops/util/Logger.h"
 #include "oops/util/printRunStats.h"
@@ -69,6 +71,14 @@ namespace oops {
  *  which applies the matrix to the first argument, and returns the
  *  matrix-vector product in the second. (Note: the const is optonal, but
  *  recommended.)
+ *
+ *  With "fused dot products" set in the minimizer configuration, the dot products that
+ *  do not depend on each other are computed together: the cost function terms with the
+ *  first re-orthogonalization coefficient, and r^T s, r^T r and s^T r_old (for the next
+ *  beta). The re-orthogonalization stays modified Gram-Schmidt, so the other coefficients
+ *  are still computed one at a time. The batched dot products share a single reduction over
+ *  the model domain if the model Increment provides local_dot_products, otherwise only the
+ *  reduction over the time dimension is shared.
  */
 
 // -----------------------------------------------------------------------------
@@ -89,13 +99,16 @@ template<typename MODEL, typename OBS> class DRIPCGMinimizer : public DRMinimize
   double solve(CtrlInc_ &, CtrlInc_ &, CtrlInc_ &, const Bmat_ &, const HtRinvH_ &,
                const double, const double, const int, const double) override;
   QNewtonLMP<CtrlInc_, Bmat_, Cmat_> lmp_;
+  const bool fused_;
+  const eckit::LocalConfiguration conf_;
 };
 
 // =============================================================================
 
 template<typename MODEL, typename OBS>
 DRIPCGMinimizer<MODEL, OBS>::DRIPCGMinimizer(const eckit::Configuration & conf, const CostFct_ & J)
-  : DRMinimizer<MODEL, OBS>(J), lmp_(conf)
+  : DRMinimizer<MODEL, OBS>(J), lmp_(conf), fused_(conf.getBool("fused dot products", false)),
+    conf_(conf)
 {}
 
 // -----------------------------------------------------------------------------
@@ -114,12 +127,9 @@ double DRIPCGMinimizer<MODEL, OBS>::solve(CtrlInc_ & xx, CtrlInc_ & xh, CtrlInc_
   CtrlInc_ dr(xh);
   CtrlInc_ r0(xh);
 
-  std::vector<CtrlInc_> vvecs;  // for re-orthogonalization
-  std::vector<CtrlInc_> zvecs;  // for re-orthogonalization
+  VectorStore<CtrlInc_> vvecs(conf_);  // for re-orthogonalization
+  VectorStore<CtrlInc_> zvecs(conf_);  // for re-orthogonalization
   std::vector<double> scals;  // for re-orthogonalization
-  // reserve space in vectors to avoid extra copies
-  vvecs.reserve(maxiter+1);
-  zvecs.reserve(maxiter+1);
   scals.reserve(maxiter+1);
 
   const double costJ0 = costJ0Jb + costJ0JoJc;
@@ -137,6 +147,7 @@ double DRIPCGMinimizer<MODEL, OBS>::solve(CtrlInc_ & xx, CtrlInc_ & xh, CtrlInc_
   double normReduction = 1.0;
   double rdots = dotSr0;
   double rdots_old = dotSr0;
+  double sdotr_old = 0.0;  // s_{i+1}^T r_{i}, used when the dot products are fused
 
   vvecs.push_back(rr);
   zvecs.push_back(ss);
@@ -151,8 +162,13 @@ double DRIPCGMinimizer<MODEL, OBS>::solve(CtrlInc_ & xx, CtrlInc_ & xh, CtrlInc_
       pp = ss;
       ph = sh;
     } else {
-      dr -= rr;  // dr=oldr-r
-      double beta = -dot_product(ss, dr)/rdots_old;
+      double beta;
+      if (fused_) {
+        beta = -(sdotr_old - rdots)/rdots_old;
+      } else {
+        dr -= rr;  // dr=oldr-r
+        beta = -dot_product(ss, dr)/rdots_old;
+      }
 
       pp *= beta;
       pp += ss;      // p = s + beta*p
@@ -174,29 +190,58 @@ double DRIPCGMinimizer<MODEL, OBS>::solve(CtrlInc_ & xx, CtrlInc_ & xh, CtrlInc_
     xh.axpy(alpha, ph);   // xh = xh + alpha*ph
     rr.axpy(-alpha, ap);  // rr = rr - alpha*ap
 
-    // Compute the quadratic cost function
-    double costJ = costJ0 - 0.5 * dot_product(xx, r0);
-    double costJb = costJ0Jb + 0.5 * dot_product(xx, xh);
-    double costJoJc = costJ - costJb;
-
-    // Re-orthogonalization
-    for (int jj = 0; jj < jiter; ++jj) {
-      double proj = scals[jj] * dot_product(rr, zvecs[jj]);
-      rr.axpy(-proj, vvecs[jj]);
+    // Compute the quadratic cost function and re-orthogonalize
+    double costJ, costJb;
+    if (fused_) {
+      // Cost function terms and the first re-orthogonalization coefficient, reduced together
+      std::vector<const CtrlInc_ *> lhs{&xx, &xx};
+      std::vector<const CtrlInc_ *> rhs{&r0, &xh};
+      if (jiter > 0) {
+        lhs.push_back(&rr);
+        rhs.push_back(&zvecs[0]);
+      }
+      const std::vector<double> dots = dot_products(lhs, rhs);
+      costJ = costJ0 - 0.5 * dots[0];
+      costJb = costJ0Jb + 0.5 * dots[1];
+
+      // Re-orthogonalization (modified Gram-Schmidt: the next coefficients use the updated r)
+      for (int jj = 0; jj < jiter; ++jj) {
+        double proj = scals[jj] * (jj == 0 ? dots[2] : dot_product(rr, zvecs[jj]));
+        rr.axpy(-proj, vvecs[jj]);
+      }
+    } else {
+      costJ = costJ0 - 0.5 * dot_product(xx, r0);
+      costJb = costJ0Jb + 0.5 * dot_product(xx, xh);
+
+      // Re-orthogonalization
+      for (int jj = 0; jj < jiter; ++jj) {
+        double proj = scals[jj] * dot_product(rr, zvecs[jj]);
+        rr.axpy(-proj, vvecs[jj]);
+      }
     }
+    double costJoJc = costJ - costJb;
 
     lmp_.multiply(rr, sh);
     B.multiply(sh, ss);
 
     rdots_old = rdots;
-    rdots = dot_product(rr, ss);
+    double rrnorm;
+    if (fused_) {
+      // r^T s, r^T r and s^T oldr (for the next beta), reduced together
+      const std::vector<double> dots = dot_products<CtrlInc_>({&rr, &rr, &ss}, {&ss, &rr, &dr});
+      rdots = dots[0];
+      rrnorm = sqrt(dots[1]);
+      sdotr_old = dots[2];
+    } else {
+      rdots = dot_product(rr, ss);
+      rrnorm = sqrt(dot_product(rr, rr));
+    }
 //  There is an issue where in some cases ss goes to zero before rr. The convergence
 //  check below only checks for rr. Leaving the commented lines here for further invertigation.
 //  double sdots = dot_product(ss, ss);
 //  double rdotr = dot_product(rr, rr);
 //  Log::info() << "DRIPCGMinimizer rdots = " << rdots
 //              << ", sdots = " << sdots << ", rdotr = " << rdotr << std::endl;
-    double rrnorm = sqrt(dot_product(rr, rr));
     normReduction = rrnorm/rrnorm0;
 
     Log::info() << "DRIPCG end of iteration " << jiter+1 << std::endl;
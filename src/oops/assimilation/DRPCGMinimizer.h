@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "eckit/config/Configuration.h"
+#include "eckit/config/LocalConfiguration.h"
 #include "oops/assimilation/BMatrix.h"
 #include "oops/assimilation/CMatrix.h"
 #include "oops/assimilation/ControlIncrement.h"
@@ -25,6 +26,7 @@
 #include "oops/assimilation/HtRinvHMatrix.h"
 #include "oops/assimilation/MinimizerUtils.h"
 #include "oops/assimilation/QNewtonLMP.h"
+#include "oops/assimilation/VectorStore.h"
 #include "oops/util/dot_product.h"
 #include "oops/util/formats.h"
 #include "oops/util/Logger.h"
@@ -74,6 +76,13 @@ namespace oops {
  *  which applies the matrix to the first argument, and returns the
  *  matrix-vector product in the second. (Note: the const is optional, but
  *  recommended.)
+ *
+ *  With "fused dot products" set in the minimizer configuration, the cost function
+ *  diagnostics and the first re-orthogonalization coefficient of an iteration are computed
+ *  together. The re-orthogonalization stays modified Gram-Schmidt, so the other coefficients
+ *  are still computed one at a time. The batched dot products share a single reduction over
+ *  the model domain if the model Increment provides local_dot_products, otherwise only the
+ *  reduction over the time dimension is shared.
  */
 
 // -----------------------------------------------------------------------------
@@ -94,13 +103,16 @@ template<typename MODEL, typename OBS> class DRPCGMinimizer : public DRMinimizer
   double solve(CtrlInc_ &, CtrlInc_ &, CtrlInc_ &, const Bmat_ &, const HtRinvH_ &,
                const double, const double, const int, const double) override;
   QNewtonLMP<CtrlInc_, Bmat_, Cmat_> lmp_;
+  const bool fused_;
+  const eckit::LocalConfiguration conf_;
 };
 
 // =============================================================================
 
 template<typename MODEL, typename OBS>
 DRPCGMinimizer<MODEL, OBS>::DRPCGMinimizer(const eckit::Configuration & conf, const CostFct_ & J)
-  : DRMinimizer<MODEL, OBS>(J), lmp_(conf)
+  : DRMinimizer<MODEL, OBS>(J), lmp_(conf), fused_(conf.getBool("fused dot products", false)),
+    conf_(conf)
 {}
 
 // -----------------------------------------------------------------------------
@@ -123,12 +135,10 @@ double DRPCGMinimizer<MODEL, OBS>::solve(CtrlInc_ & dx, CtrlInc_ & dxh, CtrlInc_
   CtrlInc_ ww(dxh);
 
   // vectors for re-orthogonalization
-  std::vector<CtrlInc_> vvecs;
-  std::vector<CtrlInc_> zvecs;
+  // (kept in memory unless a "vector store" is configured)
+  VectorStore<CtrlInc_> vvecs(conf_);
+  VectorStore<CtrlInc_> zvecs(conf_);
   std::vector<double> scals;
-  // reserve space in vectors to avoid extra copies
-  vvecs.reserve(maxiter+1);
-  zvecs.reserve(maxiter+1);
   scals.reserve(maxiter+1);
 
   // J0
@@ -193,20 +203,40 @@ double DRPCGMinimizer<MODEL, OBS>::solve(CtrlInc_ & dx, CtrlInc_ & dxh, CtrlInc_
     // r_{i+1} = r_{i} - alpha * q_{i}
     rr.axpy(-alpha, qq);
 
-    // Compute the quadratic cost function
-    // J[dx_{i}] = J[0] - 0.5 dx_{i}^T r_{0}
-    double costJ = costJ0 - 0.5 * dot_product(dx, r0);
-    // Jb[dx_{i}] = 0.5 dx_{i}^T f_{i}
-    double costJb = costJ0Jb + 0.5 * dot_product(dx, dxh);
+    // Compute the quadratic cost function and re-orthogonalize
+    double costJ, costJb;
+    if (fused_) {
+      // dx_{i}^T r_{0}, dx_{i}^T f_{i} and r_{i+1}^T z_{0}, reduced together
+      std::vector<const CtrlInc_ *> lhs{&dx, &dx};
+      std::vector<const CtrlInc_ *> rhs{&r0, &dxh};
+      if (jiter > 0) {
+        lhs.push_back(&rr);
+        rhs.push_back(&zvecs[0]);
+      }
+      const std::vector<double> dots = dot_products(lhs, rhs);
+      costJ = costJ0 - 0.5 * dots[0];
+      costJb = costJ0Jb + 0.5 * dots[1];
+
+      // Re-orthogonalization (modified Gram-Schmidt: the next coefficients use the updated r)
+      for (int jj = 0; jj < jiter; ++jj) {
+        double proj = scals[jj] * (jj == 0 ? dots[2] : dot_product(rr, zvecs[jj]));
+        rr.axpy(-proj, vvecs[jj]);
+      }
+    } else {
+      // J[dx_{i}] = J[0] - 0.5 dx_{i}^T r_{0}
+      costJ = costJ0 - 0.5 * dot_product(dx, r0);
+      // Jb[dx_{i}] = 0.5 dx_{i}^T f_{i}
+      costJb = costJ0Jb + 0.5 * dot_product(dx, dxh);
+
+      // Re-orthogonalization
+      for (int jj = 0; jj < jiter; ++jj) {
+        double proj = scals[jj] * dot_product(rr, zvecs[jj]);
+        rr.axpy(-proj, vvecs[jj]);
+      }
+    }
     // Jo[dx_{i}] + Jc[dx_{i}] = J[dx_{i}] - Jb[dx_{i}]
     double costJoJc = costJ - costJb;
 
-    // Re-orthogonalization
-    for (int jj = 0; jj < jiter; ++jj) {
-      double proj = scals[jj] * dot_product(rr, zvecs[jj]);
-      rr.axpy(-proj, vvecs[jj]);
-    }
-
     // z_{i+1} = B LMP r_{i+1}
     lmp_.multiply(rr, pr);
     B.multiply(pr, zz);
@@ -27,6 +27,7 @@
 #include "oops/assimilation/MinimizerUtils.h"
 #include "oops/assimilation/SpectralLMP.h"
 #include "oops/assimilation/TriDiagSolve.h"
+#include "oops/assimilation/VectorStore.h"
 #include "oops/util/dot_product.h"
 #include "oops/util/Logger.h"
 #include "oops/util/printRunStats.h"
@@ -91,9 +92,9 @@ template<typename MODEL, typename OBS> class DRPLanczosMinimizer : public DRMini
 
   SpectralLMP<CtrlInc_, Cmat_> lmp_;
 
-  std::vector<std::unique_ptr<CtrlInc_>> hvecs_;
-  std::vector<std::unique_ptr<CtrlInc_>> vvecs_;
-  std::vector<std::unique_ptr<CtrlInc_>> zvecs_;
+  VectorStore<CtrlInc_> hvecs_;
+  VectorStore<CtrlInc_> vvecs_;
+  VectorStore<CtrlInc_> zvecs_;
   std::vector<double> alphas_;
   std::vector<double> betas_;
 
@@ -106,8 +107,8 @@ template<typename MODEL, typename OBS> class DRPLanczosMinimizer : public DRMini
 template<typename MODEL, typename OBS>
 DRPLanczosMinimizer<MODEL, OBS>::DRPLanczosMinimizer(const eckit::Configuration & conf,
                                                      const CostFct_ & J)
-  : DRMinimizer<MODEL, OBS>(J), lmp_(conf), hvecs_(), vvecs_(), zvecs_(), alphas_(),
-    betas_(), diagConf_(conf) {}
+  : DRMinimizer<MODEL, OBS>(J), lmp_(conf), hvecs_(conf), vvecs_(conf), zvecs_(conf),
+    alphas_(), betas_(), diagConf_(conf) {}
 
 // -----------------------------------------------------------------------------
 
@@ -152,11 +153,11 @@ double DRPLanczosMinimizer<MODEL, OBS>::solve(CtrlInc_ & dx, CtrlInc_ & dxh, Ctr
   zz *= 1/beta;
 
   // hvecs[0] = pr_{1} --> required for solution
-  hvecs_.emplace_back(std::unique_ptr<CtrlInc_>(new CtrlInc_(pr)));
+  hvecs_.push_back(pr);
   // zvecs[0] = z_{1} ---> for re-orthogonalization
-  zvecs_.emplace_back(std::unique_ptr<CtrlInc_>(new CtrlInc_(zz)));
+  zvecs_.push_back(zz);
   // vvecs[0] = v_{1} ---> for re-orthogonalization
-  vvecs_.emplace_back(std::unique_ptr<CtrlInc_>(new CtrlInc_(vv)));
+  vvecs_.push_back(vv);
 
   double normReduction = 1.0;
 
@@ -170,19 +171,32 @@ double DRPLanczosMinimizer<MODEL, OBS>::solve(CtrlInc_ & dx, CtrlInc_ & dxh, Ctr
     vv += pr;
 
     if (jiter > 0) {
-      vv.axpy(-beta, *vvecs_[jiter-1]);
+      vv.axpy(-beta, vvecs_[jiter-1]);
     }
 
     // alpha_{i} = v_{i+1}^T z_{i}
     double alpha = dot_product(zz, vv);
 
     // v_{i+1} = v_{i+1} - alpha_{i} v_{i}
-    vv.axpy(-alpha, *vvecs_[jiter]);  // vv = vv - alpha * v_j
+    vv.axpy(-alpha, vvecs_[jiter]);  // vv = vv - alpha * v_j
 
-    // Re-orthogonalization
-    for (int jj = 0; jj < jiter; ++jj) {
-      double proj = dot_product(vv, *zvecs_[jj]);
-      vv.axpy(-proj, *vvecs_[jj]);
+    // Re-orthogonalization (classical Gram-Schmidt, one pass over the stored vectors)
+    if (jiter > 0) {
+      std::vector<double> proj(jiter);
+      if (!zvecs_.paged() && !vvecs_.paged()) {
+        std::vector<const CtrlInc_ *> zprev(jiter);
+        std::vector<const CtrlInc_ *> vprev(jiter);
+        for (int jj = 0; jj < jiter; ++jj) {
+          zprev[jj] = &zvecs_[jj];
+          vprev[jj] = &vvecs_[jj];
+        }
+        proj = vv.dot_products_with(zprev);
+        for (int jj = 0; jj < jiter; ++jj) proj[jj] = -proj[jj];
+        vv.multi_axpy(proj, vprev);
+      } else {
+        for (int jj = 0; jj < jiter; ++jj) proj[jj] = -dot_product(vv, zvecs_[jj]);
+        for (int jj = 0; jj < jiter; ++jj) vv.axpy(proj[jj], vvecs_[jj]);
+      }
     }
 
     // z_{i+1} = B LMP v_{i+1}
@@ -200,11 +214,11 @@ double DRPLanczosMinimizer<MODEL, OBS>::solve(CtrlInc_ & dx, CtrlInc_ & dxh, Ctr
     zz *= 1/beta;
 
     // hvecs[i+1] =pr_{i+1}
-    hvecs_.emplace_back(std::unique_ptr<CtrlInc_>(new CtrlInc_(pr)));
+    hvecs_.push_back(pr);
     // zvecs[i+1] = z_{i+1}
-    zvecs_.emplace_back(std::unique_ptr<CtrlInc_>(new CtrlInc_(zz)));
+    zvecs_.push_back(zz);
     // vvecs[i+1] = v_{i+1}
-    vvecs_.emplace_back(std::unique_ptr<CtrlInc_>(new CtrlInc_(vv)));
+    vvecs_.push_back(vv);
 
     alphas_.push_back(alpha);
 
@@ -213,7 +227,7 @@ double DRPLanczosMinimizer<MODEL, OBS>::solve(CtrlInc_ & dx, CtrlInc_ & dxh, Ctr
       dd.push_back(beta0);
     } else {
       // Solve the tridiagonal system T_{i} s_{i} = beta0 * e_1
-      dd.push_back(beta0*dot_product(*zvecs_[0], vv));
+      dd.push_back(beta0*dot_product(zvecs_[0], vv));
       TriDiagSolve(alphas_, betas_, dd, ss);
     }
 
@@ -225,9 +239,26 @@ double DRPLanczosMinimizer<MODEL, OBS>::solve(CtrlInc_ & dx, CtrlInc_ & dxh, Ctr
     double costJ = costJ0;
 
     double costJb = costJ0Jb;
+    std::vector<double> ztr(jiter+1);
+    std::vector<double> vtz(jiter+1);
+    if (!zvecs_.paged() && !vvecs_.paged()) {
+      std::vector<const CtrlInc_ *> zall(jiter+1);
+      std::vector<const CtrlInc_ *> vall(jiter+1);
+      for (int jj = 0; jj < jiter+1; ++jj) {
+        zall[jj] = &zvecs_[jj];
+        vall[jj] = &vvecs_[jj];
+      }
+      ztr = rr.dot_products_with(zall);
+      vtz = dot_products(vall, zall);
+    } else {
+      for (int jj = 0; jj < jiter+1; ++jj) {
+        ztr[jj] = dot_product(rr, zvecs_[jj]);
+        vtz[jj] = dot_product(vvecs_[jj], zvecs_[jj]);
+      }
+    }
     for (int jj = 0; jj < jiter+1; ++jj) {
-      costJ -= 0.5 * ss[jj] * dot_product(*zvecs_[jj], rr);
-      costJb += 0.5 * ss[jj] * dot_product(*vvecs_[jj], *zvecs_[jj]) * ss[jj];
+      costJ -= 0.5 * ss[jj] * ztr[jj];
+      costJb += 0.5 * ss[jj] * vtz[jj] * ss[jj];
     }
     double costJoJc = costJ - costJb;
 
@@ -249,9 +280,20 @@ double DRPLanczosMinimizer<MODEL, OBS>::solve(CtrlInc_ & dx, CtrlInc_ & dxh, Ctr
   dxh.zero();
 
   // Calculate the solution (dxh = Binv dx)
-  for (unsigned int jj = 0; jj < ss.size(); ++jj) {
-    dx.axpy(ss[jj], *zvecs_[jj]);
-    dxh.axpy(ss[jj], *hvecs_[jj]);
+  if (!zvecs_.paged() && !hvecs_.paged()) {
+    std::vector<const CtrlInc_ *> zsol(ss.size());
+    std::vector<const CtrlInc_ *> hsol(ss.size());
+    for (unsigned int jj = 0; jj < ss.size(); ++jj) {
+      zsol[jj] = &zvecs_[jj];
+      hsol[jj] = &hvecs_[jj];
+    }
+    dx.multi_axpy(ss, zsol);
+    dxh.multi_axpy(ss, hsol);
+  } else {
+    for (unsigned int jj = 0; jj < ss.size(); ++jj) {
+      dx.axpy(ss[jj], zvecs_[jj]);
+      dxh.axpy(ss[jj], hvecs_[jj]);
+    }
   }
 
   // Compute and save the eigenvectors
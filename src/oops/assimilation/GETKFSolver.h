@@ -15,6 +15,7 @@
 #include <utility>
 #include <vector>
 
+#include "atlas/parallel/omp/omp.h"
 #include "eckit/config/LocalConfiguration.h"
 #include "oops/assimilation/gletkfInterface.h"
 #include "oops/assimilation/LocalEnsembleSolver.h"
@@ -95,8 +96,27 @@ class GETKFSolver : public LocalEnsembleSolver<MODEL, OBS> {
 
   DeparturesEnsemble_ HZb_;
 
-  Eigen::MatrixXd Wa_;  // transformation matrix for ens. perts. Xa_=Xf*Wa
-  Eigen::VectorXd wa_;  // transformation matrix for ens. mean xa_=xf*wa
+  /// Work arrays for the update at one grid point
+  struct Workspace {
+    Eigen::MatrixXd Wa;  // transformation matrix for ens. perts. Xa_=Xf*Wa
+    Eigen::VectorXd wa;  // transformation matrix for ens. mean xa_=xf*wa
+
+    // local original and analysis ensembles, reused across grid points
+    Eigen::MatrixXd XbOriginal;
+    Eigen::MatrixXd Xa;
+
+    // local observations and localization factors
+    std::unique_ptr<Departures_> locvector;
+    Eigen::VectorXd omb;
+    Eigen::MatrixXd Yb;
+    Eigen::MatrixXd HZb;
+    Eigen::VectorXd invVarR;
+  };
+
+  /// Work arrays of the calling thread
+  Workspace & workspace() {return work_[atlas_omp_get_thread_num()];}
+
+  std::vector<Workspace> work_;  // one set of work arrays per thread
 };
 
 // -----------------------------------------------------------------------------
@@ -111,15 +131,21 @@ GETKFSolver<MODEL, OBS>::GETKFSolver(ObsSpaces_ & obspaces, const Geometry_ & ge
     neig_(vertloc_.neig()), nanal_(neig_*nens_), HZb_(obspaces, nanal_)
 {
   // pre-allocate transformation matrices
-  Wa_.resize(nanal_, nens);
-  wa_.resize(nanal_);
+  work_.resize(this->nthreads());
+  for (Workspace & ws : work_) {
+    ws.Wa.resize(nanal_, nens);
+    ws.wa.resize(nanal_);
+    // ObsVectors are created here rather than in the grid point loop
+    ws.locvector.reset(new Departures_(this->obspaces_));
+  }
 }
 
 // -----------------------------------------------------------------------------
 template <typename MODEL, typename OBS>
 Observations<OBS> GETKFSolver<MODEL, OBS>::computeHofX(const StateEnsemble4D_ & ens_xx,
                                                        size_t iteration, bool readFromFile) {
-  util::Timer timer(classname(), "computeHofX");
+  static const util::TimerId timerId(classname(), "computeHofX");
+  util::Timer timer(timerId);
 
   // compute/read H(x) for the original ensemble members
   // also computes omb_
@@ -171,10 +197,11 @@ void GETKFSolver<MODEL, OBS>::computeWeights(const Eigen::VectorXd & dy,
                                              const Eigen::MatrixXd & Yb,
                                              const Eigen::MatrixXd & YbOrig,
                                              const Eigen::VectorXd & R_invvar) {
-  // compute transformation matrix, save in Wa_, wa_
+  // compute transformation matrix, save in Wa, wa of the thread workspace
   // Yb(nobs,neig*nens), YbOrig(nobs,nens)
   // uses GSI GETKF code
-  util::Timer timer(classname(), "computeWeights");
+  static const util::TimerId timerId(classname(), "computeWeights");
+  util::Timer timer(timerId);
   const LocalEnsembleSolverInflationParameters & inflopt = this->options_.infl;
   const float infl = inflopt.mult;
 
@@ -197,8 +224,9 @@ void GETKFSolver<MODEL, OBS>::computeWeights(const Eigen::VectorXd & dy,
                  wa_f.data(), Wa_f.data(),
                  R_invvar_f.data(), nanal_, neig_,
                  getkf_inflation, denkf, getkf, infl);
-  this->Wa_ = Wa_f.cast<double>();
-  this->wa_ = wa_f.cast<double>();
+  Workspace & ws = workspace();
+  ws.Wa = Wa_f.cast<double>();
+  ws.wa = wa_f.cast<double>();
 }
 
 // -----------------------------------------------------------------------------
@@ -207,33 +235,32 @@ template <typename MODEL, typename OBS>
 void GETKFSolver<MODEL, OBS>::applyWeights(const IncrementEnsemble4D_ & bkg_pert,
                                            IncrementEnsemble4D_ & ana_pert,
                                            const GeometryIterator_ & i) {
-  // apply Wa_, wa_
-  util::Timer timer(classname(), "applyWeights");
-
-  // allocate tmp arrays
-  Eigen::MatrixXd XbModulated;  // modulated perturbations
-  Eigen::MatrixXd XbOriginal;   // original perturbations
+  // apply Wa, wa of the thread workspace
+  static const util::TimerId timerId(classname(), "applyWeights");
+  util::Timer timer(timerId);
+  Workspace & ws = workspace();
+  Eigen::MatrixXd & XbOriginal = ws.XbOriginal;   // original perturbations
+  Eigen::MatrixXd & Xa = ws.Xa;
 
   // loop through analysis times and ens. members
   for (unsigned itime=0; itime < bkg_pert[0].size(); ++itime) {
     // cast bkg_pert ensemble at grid point i as an Eigen matrix Xb
     // modulates Xb
-    XbModulated = vertloc_.modulateIncrement(bkg_pert, i, itime);
+    const Eigen::MatrixXd XbModulated = vertloc_.modulateIncrement(bkg_pert, i, itime);
     // original Xb
     bkg_pert.packEigen(XbOriginal, i, itime);
 
     // postmulptiply
-    // ensemble mean update
-    Eigen::VectorXd xa = XbModulated*wa_;
     // ensemble perturbation update
-    // Eq (10) from Lei 2018. (-) sign is accounted for in the Wa_ computation
-    Eigen::MatrixXd Xa = XbOriginal + XbModulated*Wa_;
+    // Eq (10) from Lei 2018. (-) sign is accounted for in the Wa computation
+    Xa = XbOriginal;
+    Xa.noalias() += XbModulated*ws.Wa;
 
     // posterior inflation if rtps and rttp coefficients belong to (0,1]
     this->posteriorInflation(XbOriginal, Xa);
 
-    // assign Xa_ to ana_pert
-    Xa = Xa.colwise() + xa;
+    // assign Xa_ to ana_pert, adding the ensemble mean update
+    Xa.colwise() += XbModulated*ws.wa;
     ana_pert.setEigen(Xa, i, itime);
   }
 }
@@ -244,30 +271,21 @@ template <typename MODEL, typename OBS>
 void GETKFSolver<MODEL, OBS>::measurementUpdate(const IncrementEnsemble4D_ & bkg_pert,
                                                 const GeometryIterator_ & i,
                                                 IncrementEnsemble4D_ & ana_pert) {
-  util::Timer timer(classname(), "measurementUpdate");
+  static const util::TimerId timerId(classname(), "measurementUpdate");
+  util::Timer timer(timerId);
 
   // create the local subset of observations
-  Departures_ locvector(this->obspaces_);
-  locvector.ones();
-  this->obsloc().computeLocalization(i, locvector);
-  locvector.mask(*(this->invVarR_));
-  Eigen::VectorXd local_omb_vec = this->omb_.packEigen(locvector);
-
-  if (local_omb_vec.size() == 0) {
-    // no obs. so no need to update Wa_ and wa_
+  Workspace & ws = workspace();
+  this->packLocalObs(i, *ws.locvector, ws.omb, ws.Yb, ws.invVarR);
+  if (ws.omb.size() == 0) {
+    // no obs. so no need to update Wa and wa
     // ana_pert[i]=bkg_pert[i]
     this->copyLocalIncrement(bkg_pert, i, ana_pert);
   } else {
     // if obs are present do normal KF update
-    // get local Yb & HZ
-    Eigen::MatrixXd local_Yb_mat = this->Yb_.packEigen(locvector);
-    Eigen::MatrixXd local_HZ_mat = this->HZb_.packEigen(locvector);
-    // create local obs errors
-    Eigen::VectorXd local_invVarR_vec = this->invVarR_->packEigen(locvector);
-    // and apply localization
-    Eigen::VectorXd localization = locvector.packEigen(locvector);
-    local_invVarR_vec.array() *= localization.array();
-    computeWeights(local_omb_vec, local_HZ_mat, local_Yb_mat, local_invVarR_vec);
+    // get local HZ
+    ws.HZb = this->packLocal(HZb_, *ws.locvector);
+    computeWeights(ws.omb, ws.HZb, ws.Yb, ws.invVarR);
     applyWeights(bkg_pert, ana_pert, i);
   }
 }
@@ -10,19 +10,25 @@
 #define OOPS_ASSIMILATION_LETKFSOLVER_H_
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <cfloat>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "atlas/parallel/omp/omp.h"
 #include "oops/assimilation/LocalEnsembleSolver.h"
 #include "oops/base/Departures.h"
 #include "oops/base/DeparturesEnsemble.h"
 #include "oops/base/Geometry.h"
 #include "oops/base/IncrementEnsemble4D.h"
+#include "oops/base/LocalObs.h"
 #include "oops/base/ObsErrors.h"
 #include "oops/base/ObsLocalizations.h"
 #include "oops/base/ObsSpaces.h"
+#include "oops/base/Observations.h"
+#include "oops/base/StateEnsemble4D.h"
 #include "oops/interface/GeometryIterator.h"
 #include "oops/util/Logger.h"
 
@@ -49,7 +55,9 @@ class LETKFSolver : public LocalEnsembleSolver<MODEL, OBS> {
   typedef ObsErrors<OBS>              ObsErrors_;
   typedef ObsLocalizations<MODEL, OBS> ObsLocalizations_;
   typedef ObsSpaces<OBS>              ObsSpaces_;
+  typedef Observations<OBS>           Observations_;
   typedef State4D<MODEL>              State4D_;
+  typedef StateEnsemble4D<MODEL>      StateEnsemble4D_;
 
  public:
   static const std::string classname() {return "oops::LETKFSolver";}
@@ -57,6 +65,13 @@ class LETKFSolver : public LocalEnsembleSolver<MODEL, OBS> {
   LETKFSolver(ObsSpaces_ &, const Geometry_ &, const eckit::Configuration &, size_t,
               const State4D_ &);
 
+  /// computes ensemble H(x) and packs the observations used by the local updates
+  Observations_ computeHofX(const StateEnsemble4D_ &, size_t, bool) override;
+
+  /// KF update + posterior inflation for all grid points on this PE; with "weight reuse"
+  /// the grid points are processed in tiles (see updateTile)
+  void measurementUpdate(const IncrementEnsemble4D_ &, IncrementEnsemble4D_ &) override;
+
   /// KF update + posterior inflation at a grid point location (GeometryIterator_)
   void measurementUpdate(const IncrementEnsemble4D_ &,
                          const GeometryIterator_ &, IncrementEnsemble4D_ &) override;
@@ -72,15 +87,47 @@ class LETKFSolver : public LocalEnsembleSolver<MODEL, OBS> {
   /// Applies weights and adds posterior inflation
   virtual void applyWeights(const IncrementEnsemble4D_ &, IncrementEnsemble4D_ &,
                             const GeometryIterator_ &);
+  /// Applies the same weights to a group of grid points and adds posterior inflation
+  virtual void applyWeights(const IncrementEnsemble4D_ &, IncrementEnsemble4D_ &,
+                            const std::vector<GeometryIterator_> &);
+
+  /// KF update of grid points [\p begin, \p end) of \p points: consecutive points with
+  /// identical local observations are updated with a single weight computation
+  void updateTile(const IncrementEnsemble4D_ &, const std::vector<GeometryIterator_> & points,
+                  size_t begin, size_t end, IncrementEnsemble4D_ &);
+
+  /// Work arrays for the update at one grid point
+  struct Workspace {
+    Eigen::MatrixXd Wa;  // transformation matrix for ens. perts. Xa=Xf*Wa
+    Eigen::VectorXd wa;  // transformation matrix for ens. mean xa=xf*wa
+
+    // eigen solver matrices
+    Eigen::VectorXd eival;
+    Eigen::MatrixXd eivec;
 
-  Eigen::MatrixXd Wa_;  // transformation matrix for ens. perts. Xa=Xf*Wa
-  Eigen::VectorXd wa_;  // transformation matrix for ens. mean xa=xf*wa
+    // local background and analysis ensembles, reused across grid points
+    Eigen::MatrixXd Xb;
+    Eigen::MatrixXd Xa;
+
+    // local observations (and those of the next grid point when reusing weights)
+    std::vector<LocalObs> local;
+    std::vector<LocalObs> next;
+    std::vector<GeometryIterator_> group;
+    Eigen::VectorXd omb;
+    Eigen::MatrixXd Yb;
+    Eigen::VectorXd invVarR;
+
+    // localization factors, for localizations without the sparse computation
+    std::unique_ptr<Departures_> locvector;
+  };
 
-  // eigen solver matrices
-  Eigen::VectorXd eival_;
-  Eigen::MatrixXd eivec_;
+  /// Work arrays of the calling thread
+  Workspace & workspace() {return work_[atlas_omp_get_thread_num()];}
 
   const size_t nens_;   // ensemble size
+
+ private:
+  std::vector<Workspace> work_;  // one set of work arrays per thread
 };
 
 // -----------------------------------------------------------------------------
@@ -95,45 +142,131 @@ LETKFSolver<MODEL, OBS>::LETKFSolver(ObsSpaces_ & obspaces, const Geometry_ & ge
   Log::trace() << "LETKFSolver<MODEL, OBS>::create starting" << std::endl;
   Log::info() << "Using EIGEN implementation of LETKF" << std::endl;
 
-  // pre-allocate transformation matrices
-  Wa_.resize(nens_, nens_);
-  wa_.resize(nens_);
+  work_.resize(this->nthreads());
+  for (Workspace & ws : work_) {
+    // pre-allocate transformation matrices
+    ws.Wa.resize(nens_, nens_);
+    ws.wa.resize(nens_);
+
+    // pre-allocate eigen sovler matrices
+    ws.eival.resize(nens_);
+    ws.eivec.resize(nens_, nens_);
 
-  // pre-allocate eigen sovler matrices
-  eival_.resize(nens_);
-  eivec_.resize(nens_, nens_);
+    // ObsVectors are created here rather than in the grid point loop
+    ws.locvector.reset(new Departures_(this->obspaces_));
+  }
   Log::trace() << "LETKFSolver<MODEL, OBS>::create done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
+template <typename MODEL, typename OBS>
+Observations<OBS> LETKFSolver<MODEL, OBS>::computeHofX(const StateEnsemble4D_ & ens_xx,
+                                                       size_t iteration, bool readFromDisk) {
+  Observations_ yb_mean =
+    LocalEnsembleSolver<MODEL, OBS>::computeHofX(ens_xx, iteration, readFromDisk);
+  this->packObs();
+  return yb_mean;
+}
+
+// -----------------------------------------------------------------------------
+
 template <typename MODEL, typename OBS>
 void LETKFSolver<MODEL, OBS>::measurementUpdate(const IncrementEnsemble4D_ & bkg_pert,
-                                                const GeometryIterator_ & i,
                                                 IncrementEnsemble4D_ & ana_pert) {
-  util::Timer timer(classname(), "measurementUpdate");
+  const size_t tilesize = this->options_.weightReuse.value().tileSize;
+  if (tilesize <= 1) {
+    LocalEnsembleSolver<MODEL, OBS>::measurementUpdate(bkg_pert, ana_pert);
+    return;
+  }
+
+  std::vector<GeometryIterator_> points;
+  for (GeometryIterator_ i = this->geometry_.begin(); i != this->geometry_.end(); ++i) {
+    points.push_back(i);
+  }
+  const int ntiles = (points.size() + tilesize - 1) / tilesize;
+  const int nthreads = this->nthreads();
+  if (nthreads > 1) ana_pert.dropFieldSets();
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+  for (int jtile = 0; jtile < ntiles; ++jtile) {
+    const size_t begin = jtile * tilesize;
+    updateTile(bkg_pert, points, begin, std::min(begin + tilesize, points.size()), ana_pert);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL, typename OBS>
+void LETKFSolver<MODEL, OBS>::updateTile(const IncrementEnsemble4D_ & bkg_pert,
+                                         const std::vector<GeometryIterator_> & points,
+                                         size_t begin, size_t end,
+                                         IncrementEnsemble4D_ & ana_pert) {
+  static const util::TimerId timerId(classname(), "updateTile");
+  util::Timer timer(timerId);
+  Workspace & ws = workspace();
+
+  size_t jpt = begin;
+  bool haveLocal = (jpt < end) && this->obsloc().computeLocalization(points[jpt], ws.local);
+  while (jpt < end) {
+    if (!haveLocal) {
+      // sparse localization not supported: update this point on its own
+      measurementUpdate(bkg_pert, points[jpt], ana_pert);
+      ++jpt;
+      haveLocal = (jpt < end) && this->obsloc().computeLocalization(points[jpt], ws.local);
+      continue;
+    }
+
+    // extend the group while the next points see the same observations
+    ws.group.assign(1, points[jpt]);
+    haveLocal = false;
+    for (++jpt; jpt < end; ++jpt) {
+      haveLocal = this->obsloc().computeLocalization(points[jpt], ws.next);
+      if (!haveLocal || ws.next != ws.local) break;
+      ws.group.push_back(points[jpt]);
+    }
+
+    this->packLocalObs(ws.local, ws.omb, ws.Yb, ws.invVarR);
+    if (ws.omb.size() == 0) {
+      for (const GeometryIterator_ & i : ws.group) this->copyLocalIncrement(bkg_pert, i, ana_pert);
+    } else {
+      computeWeights(ws.omb, ws.Yb, ws.invVarR);
+      applyWeights(bkg_pert, ana_pert, ws.group);
+    }
+    // local observations of the point that ended the group
+    std::swap(ws.local, ws.next);
+  }
+}
+
+// -----------------------------------------------------------------------------
 
-  // create the local subset of observations
-  Departures_ locvector(this->obspaces_);
-  locvector.ones();
-  this->obsloc().computeLocalization(i, locvector);
-  locvector.mask(*(this->invVarR_));
-  Eigen::VectorXd local_omb_vec = this->omb_.packEigen(locvector);
+template <typename MODEL, typename OBS>
+void LETKFSolver<MODEL, OBS>::measurementUpdate(const IncrementEnsemble4D_ & bkg_pert,
+                                                const GeometryIterator_ & i,
+                                                IncrementEnsemble4D_ & ana_pert) {
+  static const util::TimerId timerId(classname(), "measurementUpdate");
+  util::Timer timer(timerId);
+
+  // gather the local observations from the packed arrays if the localizations can list them
+  Workspace & ws = workspace();
+  if (this->packLocalObs(i, ws.local, ws.omb, ws.Yb, ws.invVarR)) {
+    if (ws.omb.size() == 0) {
+      this->copyLocalIncrement(bkg_pert, i, ana_pert);
+    } else {
+      computeWeights(ws.omb, ws.Yb, ws.invVarR);
+      applyWeights(bkg_pert, ana_pert, i);
+    }
+    return;
+  }
 
-  if (local_omb_vec.size() == 0) {
-    // no obs. so no need to update Wa_ and wa_
+  // otherwise create the local subset of observations from a full-size mask
+  this->packLocalObs(i, *ws.locvector, ws.omb, ws.Yb, ws.invVarR);
+  if (ws.omb.size() == 0) {
+    // no obs. so no need to update Wa and wa
     // ana_pert[i]=bkg_pert[i]
     this->copyLocalIncrement(bkg_pert, i, ana_pert);
   } else {
     // if obs are present do normal KF update
-    // create local Yb
-    Eigen::MatrixXd local_Yb_mat = this->Yb_.packEigen(locvector);
-    // create local obs errors
-    Eigen::VectorXd local_invVarR_vec = this->invVarR_->packEigen(locvector);
-    // and apply localization
-    Eigen::VectorXd localization = locvector.packEigen(locvector);
-    local_invVarR_vec.array() *= localization.array();
-    computeWeights(local_omb_vec, local_Yb_mat, local_invVarR_vec);
+    computeWeights(ws.omb, ws.Yb, ws.invVarR);
     applyWeights(bkg_pert, ana_pert, i);
   }
 }
@@ -144,10 +277,12 @@ template <typename MODEL, typename OBS>
 void LETKFSolver<MODEL, OBS>::computeWeights(const Eigen::VectorXd & dy,
                                              const Eigen::MatrixXd & Yb,
                                              const Eigen::VectorXd & diagInvR ) {
-  // compute transformation matrix, save in Wa_, wa_
+  // compute transformation matrix, save in Wa, wa of the thread workspace
   // uses C++ eigen interface
   // implements LETKF from Hunt et al. 2007
-  util::Timer timer(classname(), "computeWeights");
+  static const util::TimerId timerId(classname(), "computeWeights");
+  util::Timer timer(timerId);
+  Workspace & ws = workspace();
 
   const LocalEnsembleSolverInflationParameters & inflopt = this->options_.infl;
 
@@ -159,19 +294,19 @@ void LETKFSolver<MODEL, OBS>::computeWeights(const Eigen::VectorXd & dy,
 
   // eigenvalues and eigenvectors of the above matrix
   Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> es(work);
-  eival_ = es.eigenvalues().real();
-  eivec_ = es.eigenvectors().real();
+  ws.eival = es.eigenvalues().real();
+  ws.eivec = es.eigenvectors().real();
 
   // Pa   = [ Yb^T R^-1 Yb + (nens-1)/infl I ] ^-1
-  work = eivec_ * eival_.cwiseInverse().asDiagonal() * eivec_.transpose();
+  work = ws.eivec * ws.eival.cwiseInverse().asDiagonal() * ws.eivec.transpose();
 
   // Wa = sqrt[ (nens-1) Pa ]
-  Wa_ = eivec_
-      * ((nens_-1) * eival_.array().inverse()).sqrt().matrix().asDiagonal()
-      * eivec_.transpose();
+  ws.Wa = ws.eivec
+        * ((nens_-1) * ws.eival.array().inverse()).sqrt().matrix().asDiagonal()
+        * ws.eivec.transpose();
 
   // wa = Pa Yb^T R^-1 dy
-  wa_ = work * (Yb * (diagInvR.asDiagonal()*dy));
+  ws.wa = work * (Yb * (diagInvR.asDiagonal()*dy));
 }
 
 // -----------------------------------------------------------------------------
@@ -180,29 +315,54 @@ template <typename MODEL, typename OBS>
 void LETKFSolver<MODEL, OBS>::applyWeights(const IncrementEnsemble4D_ & bkg_pert,
                                            IncrementEnsemble4D_ & ana_pert,
                                            const GeometryIterator_ & i) {
-  // applies Wa_, wa_
-  util::Timer timer(classname(), "applyWeights");
+  // applies Wa, wa of the thread workspace
+  static const util::TimerId timerId(classname(), "applyWeights");
+  util::Timer timer(timerId);
+  Workspace & ws = workspace();
+  Eigen::MatrixXd & Xb = ws.Xb;
+  Eigen::MatrixXd & Xa = ws.Xa;
 
   // loop through analysis times and ens. members
   for (size_t itime=0; itime < bkg_pert[0].size(); ++itime) {
     // make grid point forecast pert ensemble array
-    Eigen::MatrixXd Xb;
     bkg_pert.packEigen(Xb, i, itime);
 
     // postmulptiply
-    Eigen::VectorXd xa = Xb*wa_;   // ensemble mean update
-    Eigen::MatrixXd Xa = Xb*Wa_;   // ensemble perturbation update
+    Xa.noalias() = Xb*ws.Wa;   // ensemble perturbation update
 
     // posterior inflation if rtps and rttp coefficients belong to (0,1]
     this->posteriorInflation(Xb, Xa);
 
-    // assign Xa to ana_pert
-    Xa = Xa.colwise() + xa;
+    // assign Xa to ana_pert, adding the ensemble mean update
+    Xa.colwise() += Xb*ws.wa;
     ana_pert.setEigen(Xa, i, itime);
   }
 }
 
 // -----------------------------------------------------------------------------
 
+template <typename MODEL, typename OBS>
+void LETKFSolver<MODEL, OBS>::applyWeights(const IncrementEnsemble4D_ & bkg_pert,
+                                           IncrementEnsemble4D_ & ana_pert,
+                                           const std::vector<GeometryIterator_> & group) {
+  // applies Wa, wa of the thread workspace to all points of the group at once
+  static const util::TimerId timerId(classname(), "applyWeights");
+  util::Timer timer(timerId);
+  Workspace & ws = workspace();
+  Eigen::MatrixXd & Xb = ws.Xb;
+  Eigen::MatrixXd & Xa = ws.Xa;
+
+  for (size_t itime=0; itime < bkg_pert[0].size(); ++itime) {
+    // stack the forecast pert ensembles of all points of the group
+    bkg_pert.packEigen(Xb, group, itime);
+    Xa.noalias() = Xb*ws.Wa;
+    this->posteriorInflation(Xb, Xa);
+    Xa.colwise() += Xb*ws.wa;
+    ana_pert.setEigen(Xa, group, itime);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 }  // namespace oops
 #endif  // OOPS_ASSIMILATION_LETKFSOLVER_H_
@@ -57,7 +57,7 @@ template <typename MODEL, typename OBS>
 void LETKFSolverGSI<MODEL, OBS>::computeWeights(const Eigen::VectorXd & dy,
                                                 const Eigen::MatrixXd & Yb,
                                                 const Eigen::VectorXd & R_invvar) {
-  // compute transformation matrix, save in Wa_, wa_
+  // compute transformation matrix, save in Wa, wa of the thread workspace
   // uses GSI GETKF code
   const int nobsl = dy.size();
   const LocalEnsembleSolverInflationParameters & inflopt = this->options_.infl;
@@ -80,8 +80,9 @@ void LETKFSolverGSI<MODEL, OBS>::computeWeights(const Eigen::VectorXd & dy,
                  wa_f.data(), Wa_f.data(),
                  R_invvar_f.data(), this->nens_, neigv,
                  getkf_inflation, denkf, getkf, infl);
-  this->Wa_ = Wa_f.cast<double>();
-  this->wa_ = wa_f.cast<double>();
+  typename LETKFSolver<MODEL, OBS>::Workspace & ws = this->workspace();
+  ws.Wa = Wa_f.cast<double>();
+  ws.wa = wa_f.cast<double>();
 }
 
 }  // namespace oops
@@ -13,9 +13,11 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "atlas/parallel/omp/omp.h"
 #include "eckit/config/Configuration.h"
 #include "eckit/config/LocalConfiguration.h"
 #include "oops/assimilation/LocalEnsembleSolverParameters.h"
@@ -23,6 +25,7 @@
 #include "oops/base/DeparturesEnsemble.h"
 #include "oops/base/Geometry.h"
 #include "oops/base/IncrementEnsemble4D.h"
+#include "oops/base/LocalObs.h"
 #include "oops/base/Model.h"
 #include "oops/base/ObsAuxControls.h"
 #include "oops/base/ObsEnsemble.h"
@@ -38,9 +41,23 @@
 #include "oops/interface/ModelAuxControl.h"
 #include "oops/util/abor1_cpp.h"
 #include "oops/util/Logger.h"
+#include "oops/util/TypeTraits.h"
 
 namespace oops {
 
+/// Detects whether the MODEL or OBS traits \c T declare
+///
+///     static const bool threadSafeLocalUpdate = true;
+///
+/// i.e. that their implementations meet the requirements of the threaded grid point loop of
+/// LocalEnsembleSolver (see LocalEnsembleSolverThreadingParameters).
+template<typename T, typename = void>
+struct HasThreadSafeLocalUpdate : std::false_type {};
+
+template<typename T>
+struct HasThreadSafeLocalUpdate<T, cpp17::void_t<decltype(T::threadSafeLocalUpdate)>>
+    : std::integral_constant<bool, T::threadSafeLocalUpdate> {};
+
 /// \brief Base class for LETKF-type solvers
 template <typename MODEL, typename OBS>
 class LocalEnsembleSolver {
@@ -78,6 +95,7 @@ class LocalEnsembleSolver {
                       bool readFromDisk);
 
   /// update background ensemble \p bg to analysis ensemble \p for all points on this PE
+  /// (grid points are distributed over threads if "threading.number of threads" != 1)
   virtual void measurementUpdate(const IncrementEnsemble4D_ & bg, IncrementEnsemble4D_ & an);
 
   /// update background ensemble \p bg to analysis ensemble \p an at a grid point location \p i
@@ -94,9 +112,34 @@ class LocalEnsembleSolver {
   /// compute H(x) based on 4D state \p xx and put the result into \p yy. Also sets up
   /// R_ based on the QC filters run during H(x)
   void computeHofX4D(const eckit::Configuration &, const State4D_ &, Observations_ &);
+  /// compute H(x) for all members of ensemble \p xx and put the results into \p yy,
+  /// sharing the interpolation to obs locations between the members
+  void computeHofX4D(const eckit::Configuration &, const StateEnsemble4D_ & xx,
+                     ObsEnsemble_ & yy);
   /// accessor to obs localizations
   const ObsLocalizations_ & obsloc() const {return obsloc_;}
 
+  /// pack omb_, Yb_ and invVarR_ of all valid observations into contiguous arrays, used
+  /// by packLocalObs; called after computeHofX
+  void packObs();
+  /// fill \p omb, \p Yb and \p invVarR (localized) with the observations local to grid
+  /// point \p i, using the sparse localization and the arrays from packObs. \p local is
+  /// work space. Returns false if the localizations don't support the sparse computation.
+  bool packLocalObs(const GeometryIterator_ & i, std::vector<LocalObs> & local,
+                    Eigen::VectorXd & omb, Eigen::MatrixXd & Yb,
+                    Eigen::VectorXd & invVarR) const;
+  /// same as above, for the local observations \p local returned by
+  /// ObsLocalizations::computeLocalization
+  void packLocalObs(const std::vector<LocalObs> & local, Eigen::VectorXd & omb,
+                    Eigen::MatrixXd & Yb, Eigen::VectorXd & invVarR) const;
+  /// same as above for localizations without the sparse computation: \p locvector is set to
+  /// the localization factors of grid point \p i, masked with the inverse obs error variances
+  void packLocalObs(const GeometryIterator_ & i, Departures_ & locvector,
+                    Eigen::VectorXd & omb, Eigen::MatrixXd & Yb,
+                    Eigen::VectorXd & invVarR) const;
+  /// number of threads that may call the grid point measurementUpdate concurrently
+  size_t nthreads() const {return nthreads_;}
+
  protected:
   const Geometry_  & geometry_;   ///< Geometry associated with the updated states
   const ObsSpaces_ & obspaces_;   ///< ObsSpaces used in the update
@@ -108,10 +151,26 @@ class LocalEnsembleSolver {
                                            ///  computeHofX method
   LocalEnsembleSolverParameters options_;
 
+  /// values of \p dep (rows of \p ens) at the observations selected by \p mask; the OBS
+  /// methods are called directly so that these can be used in the grid point loop
+  static Eigen::VectorXd packLocal(const Departures_ & dep, const Departures_ & mask);
+  static Eigen::MatrixXd packLocal(const DeparturesEnsemble_ & ens, const Departures_ & mask);
+
  private:
+  /// observations of one obs space packed by packObs
+  struct PackedObs {
+    std::vector<int> position;  // position of an ObsVector element in the packed arrays
+                                // (-1 if the observation is not used)
+    Eigen::VectorXd omb;
+    Eigen::MatrixXd Yb;         // (nens, nobs)
+    Eigen::VectorXd invVarR;
+  };
+  std::vector<PackedObs> packed_;  ///< one per obs space; set in packObs method
+
   const eckit::LocalConfiguration obsconf_;  // configuration for observations
   const eckit::LocalConfiguration observersconf_;  // configuration for observations.observers
   ObsLocalizations_ obsloc_;      ///< observation space localization
+  size_t nthreads_;               ///< number of threads used in the grid point loop
 };
 
 // -----------------------------------------------------------------------------
@@ -127,6 +186,18 @@ LocalEnsembleSolver<MODEL, OBS>::LocalEnsembleSolver(ObsSpaces_ & obspaces,
     obsloc_(observersconf_, obspaces_) {
   // initialize and print options
   options_.deserialize(config);
+  const int nthreads = options_.threading.value().nthreads;
+  nthreads_ = (nthreads == 0) ? atlas_omp_get_max_threads() : nthreads;
+  if (nthreads_ > 1 && !(HasThreadSafeLocalUpdate<MODEL>::value &&
+                         HasThreadSafeLocalUpdate<OBS>::value)) {
+    Log::warning() << MODEL::name() << " and " << OBS::name() << " don't declare "
+                   << "threadSafeLocalUpdate: grid points will be updated by one thread"
+                   << std::endl;
+    nthreads_ = 1;
+  }
+  if (nthreads_ > 1) {
+    Log::info() << "Grid points will be updated by " << nthreads_ << " threads" << std::endl;
+  }
   const LocalEnsembleSolverInflationParameters & inflopt = this->options_.infl;
   Log::info() << "Multiplicative inflation will be applied with multCoeff=" <<
                  inflopt.mult << std::endl;
@@ -151,9 +222,28 @@ LocalEnsembleSolver<MODEL, OBS>::LocalEnsembleSolver(ObsSpaces_ & obspaces,
 template <typename MODEL, typename OBS>
 void LocalEnsembleSolver<MODEL, OBS>::measurementUpdate
         (const IncrementEnsemble4D_ & bg, IncrementEnsemble4D_ & an) {
+  if (nthreads_ <= 1) {
     for (GeometryIterator_ i = geometry_.begin(); i != geometry_.end(); ++i) {
       measurementUpdate(bg, i, an);
     }
+    return;
+  }
+
+  // GeometryIterator is a forward iterator: collect the grid points first so that
+  // they can be handed out to the threads
+  std::vector<GeometryIterator_> points;
+  for (GeometryIterator_ i = geometry_.begin(); i != geometry_.end(); ++i) {
+    points.push_back(i);
+  }
+  const int npoints = points.size();
+  const int nthreads = nthreads_;
+  const int chunk = options_.threading.value().chunk;
+  // Yb_, omb_ and invVarR_ are only read here; solvers keep per-thread work arrays
+  an.dropFieldSets();
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic, chunk)
+  for (int jj = 0; jj < npoints; ++jj) {
+    measurementUpdate(bg, points[jj], an);
+  }
 }
 // -----------------------------------------------------------------------------
 
@@ -189,10 +279,52 @@ void LocalEnsembleSolver<MODEL, OBS>::computeHofX4D(const eckit::Configuration &
 
 // -----------------------------------------------------------------------------
 
+template <typename MODEL, typename OBS>
+void LocalEnsembleSolver<MODEL, OBS>::computeHofX4D(const eckit::Configuration & config,
+                                                    const StateEnsemble4D_ & ens_xx,
+                                                    ObsEnsemble_ & obsens) {
+  static const util::TimerId timerId(classname(), "computeHofX4D");
+  util::Timer timer(timerId);
+  const size_t nens = ens_xx.size();
+  const util::Duration default_tstep = (obspaces_.windowEnd() - obspaces_.windowStart()) * 2;
+  ModelAux_ moderr(geometry_, eckit::LocalConfiguration());
+  ObsAux_ obsaux(obspaces_, observersconf_);
+
+  // one set of observers (with their own QC) per member, all sharing the GetValues of the first
+  std::vector<std::unique_ptr<ObsErrors_>> Rens;
+  std::vector<std::unique_ptr<Observers_>> hofx;
+  for (size_t jj = 0; jj < nens; ++jj) {
+    Rens.emplace_back(new ObsErrors_(observersconf_, obspaces_));
+    hofx.emplace_back(new Observers_(obspaces_, obsconf_));
+    PostProcessor<State_> post;
+    if (jj == 0) {
+      hofx[jj]->initialize(geometry_, obsaux, *Rens[jj], post, config, nens);
+    } else {
+      hofx[jj]->initialize(geometry_, obsaux, *Rens[jj], post, config, *hofx[0], jj);
+    }
+
+    // run the pseudo model through this member's states (see computeHofX4D above)
+    const std::vector<util::DateTime> times = ens_xx[jj].validTimes();
+    const util::Duration flength = times[times.size()-1] - times[0];
+    std::unique_ptr<PseudoModel_> pseudomodel(new PseudoModel_(ens_xx[jj], default_tstep));
+    const Model_ model(std::move(pseudomodel));
+    State_ init_xx = ens_xx[jj][0];
+    model.forecast(init_xx, moderr, flength, post);
+  }
+
+  // the interpolated values of all members have been exchanged: compute H(x)
+  for (size_t jj = 0; jj < nens; ++jj) {
+    hofx[jj]->finalize(obsens[jj]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 template <typename MODEL, typename OBS>
 Observations<OBS> LocalEnsembleSolver<MODEL, OBS>::computeHofX(const StateEnsemble4D_ & ens_xx,
                                                    size_t iteration, bool readFromDisk) {
-  util::Timer timer(classname(), "computeHofX");
+  static const util::TimerId timerId(classname(), "computeHofX");
+  util::Timer timer(timerId);
 
   ASSERT(ens_xx.size() == Yb_.size());
 
@@ -222,8 +354,9 @@ Observations<OBS> LocalEnsembleSolver<MODEL, OBS>::computeHofX(const StateEnsemb
     config.set("save obs errors", false);
     config.set("iteration", std::to_string(iteration));
 
+    if (options_.ensembleObserver) computeHofX4D(config, ens_xx, obsens);
     for (size_t jj = 0; jj < nens; ++jj) {
-      computeHofX4D(config, ens_xx[jj], obsens[jj]);
+      if (!options_.ensembleObserver) computeHofX4D(config, ens_xx[jj], obsens[jj]);
       Log::test() << "H(x) for member " << jj+1 << ":" << std::endl << obsens[jj] << std::endl;
       obsens[jj].save("hofx"+std::to_string(iteration)+"_"+std::to_string(jj+1));
     }
@@ -266,6 +399,134 @@ Observations<OBS> LocalEnsembleSolver<MODEL, OBS>::computeHofX(const StateEnsemb
 
 // -----------------------------------------------------------------------------
 
+template <typename MODEL, typename OBS>
+void LocalEnsembleSolver<MODEL, OBS>::packObs() {
+  static const util::TimerId timerId(classname(), "packObs");
+  util::Timer timer(timerId);
+
+  // observations used in the update: valid in omb_, invVarR_ and all members of Yb_
+  Departures_ valid(*invVarR_);
+  valid.mask(omb_);
+  for (size_t iens = 0; iens < Yb_.size(); ++iens) valid.mask(Yb_[iens]);
+
+  packed_.resize(obspaces_.size());
+  for (size_t jj = 0; jj < obspaces_.size(); ++jj) {
+    PackedObs & packed = packed_[jj];
+    const std::vector<size_t> indices = valid[jj].packEigenIndices(valid[jj]);
+    packed.position.assign(indices.empty() ? 0 : indices.back() + 1, -1);
+    for (size_t jobs = 0; jobs < indices.size(); ++jobs) {
+      packed.position[indices[jobs]] = jobs;
+    }
+    packed.omb = omb_[jj].packEigen(valid[jj]);
+    packed.invVarR = (*invVarR_)[jj].packEigen(valid[jj]);
+    packed.Yb.resize(Yb_.size(), indices.size());
+    for (size_t iens = 0; iens < Yb_.size(); ++iens) {
+      packed.Yb.row(iens) = Yb_[iens][jj].packEigen(valid[jj]);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL, typename OBS>
+bool LocalEnsembleSolver<MODEL, OBS>::packLocalObs(const GeometryIterator_ & i,
+                                                   std::vector<LocalObs> & local,
+                                                   Eigen::VectorXd & omb, Eigen::MatrixXd & Yb,
+                                                   Eigen::VectorXd & invVarR) const {
+  if (packed_.size() != obspaces_.size()) return false;
+  if (!obsloc_.computeLocalization(i, local)) return false;
+  packLocalObs(local, omb, Yb, invVarR);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL, typename OBS>
+void LocalEnsembleSolver<MODEL, OBS>::packLocalObs(const std::vector<LocalObs> & local,
+                                                   Eigen::VectorXd & omb, Eigen::MatrixXd & Yb,
+                                                   Eigen::VectorXd & invVarR) const {
+  ASSERT(packed_.size() == local.size());
+  // local observations that are not used have no position in the packed arrays
+  size_t nlocal = 0;
+  for (size_t jj = 0; jj < local.size(); ++jj) {
+    const std::vector<int> & position = packed_[jj].position;
+    for (const size_t index : local[jj].indices) {
+      if (index < position.size() && position[index] >= 0) ++nlocal;
+    }
+  }
+
+  omb.resize(nlocal);
+  Yb.resize(Yb_.size(), nlocal);
+  invVarR.resize(nlocal);
+  size_t ii = 0;
+  for (size_t jj = 0; jj < local.size(); ++jj) {
+    const PackedObs & packed = packed_[jj];
+    for (size_t jloc = 0; jloc < local[jj].size(); ++jloc) {
+      const size_t index = local[jj].indices[jloc];
+      if (index >= packed.position.size() || packed.position[index] < 0) continue;
+      const size_t jobs = packed.position[index];
+      omb(ii) = packed.omb(jobs);
+      Yb.col(ii) = packed.Yb.col(jobs);
+      invVarR(ii) = packed.invVarR(jobs) * local[jj].values[jloc];
+      ++ii;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL, typename OBS>
+void LocalEnsembleSolver<MODEL, OBS>::packLocalObs(const GeometryIterator_ & i,
+                                                   Departures_ & locvector,
+                                                   Eigen::VectorXd & omb, Eigen::MatrixXd & Yb,
+                                                   Eigen::VectorXd & invVarR) const {
+  obsloc_.computeLocalization(i, locvector);
+  for (size_t jj = 0; jj < locvector.size(); ++jj) {
+    locvector[jj].obsvector().mask((*invVarR_)[jj].obsvector());
+  }
+  omb = packLocal(omb_, locvector);
+  Yb = packLocal(Yb_, locvector);
+  invVarR = packLocal(*invVarR_, locvector);
+  // apply localization
+  invVarR.array() *= packLocal(locvector, locvector).array();
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL, typename OBS>
+Eigen::VectorXd LocalEnsembleSolver<MODEL, OBS>::packLocal(const Departures_ & dep,
+                                                           const Departures_ & mask) {
+  std::vector<size_t> len(dep.size());
+  size_t nobs = 0;
+  for (size_t jj = 0; jj < dep.size(); ++jj) {
+    len[jj] = dep[jj].obsvector().packEigenSize(mask[jj].obsvector());
+    nobs += len[jj];
+  }
+  Eigen::VectorXd vec(nobs);
+  size_t ii = 0;
+  for (size_t jj = 0; jj < dep.size(); ++jj) {
+    vec.segment(ii, len[jj]) = dep[jj].obsvector().packEigen(mask[jj].obsvector());
+    ii += len[jj];
+  }
+  return vec;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL, typename OBS>
+Eigen::MatrixXd LocalEnsembleSolver<MODEL, OBS>::packLocal(const DeparturesEnsemble_ & ens,
+                                                           const Departures_ & mask) {
+  Eigen::MatrixXd mat;
+  for (size_t iens = 0; iens < ens.size(); ++iens) {
+    const Eigen::VectorXd row = packLocal(ens[iens], mask);
+    if (iens == 0) mat.resize(ens.size(), row.size());
+    mat.row(iens) = row;
+  }
+  return mat;
+}
+
+// -----------------------------------------------------------------------------
+
 template <typename MODEL, typename OBS>
 void LocalEnsembleSolver<MODEL, OBS>::copyLocalIncrement(const IncrementEnsemble4D_ & bkg_pert,
                                                          const GeometryIterator_ & i,
@@ -273,8 +534,9 @@ void LocalEnsembleSolver<MODEL, OBS>::copyLocalIncrement(const IncrementEnsemble
   // ana_pert[i]=bkg_pert[i]
   for (size_t itime=0; itime < bkg_pert[0].size(); ++itime) {
     for (size_t iens=0; iens < bkg_pert.size(); ++iens) {
-      LocalIncrement gp = bkg_pert[iens][itime].getLocal(i);
-      ana_pert[iens][itime].setLocal(gp, i);
+      // called in the grid point loop: the MODEL::Increment methods are called directly
+      LocalIncrement gp = bkg_pert[iens][itime].increment().getLocal(i.geometryiter());
+      ana_pert[iens][itime].increment().setLocal(gp, i.geometryiter());
     }
   }
 }
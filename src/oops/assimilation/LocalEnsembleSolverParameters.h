@@ -52,11 +52,55 @@ class LocalEnsembleSolverInflationParameters : public Parameters {
   double rtpsInflMax() const { return 1e30; }
 };
 
+/// Parameters for the shared-memory parallel loop over grid points
+class LocalEnsembleSolverThreadingParameters : public Parameters {
+  OOPS_CONCRETE_PARAMETERS(LocalEnsembleSolverThreadingParameters, Parameters)
+
+ public:
+  // Grid points are updated concurrently by OpenMP threads sharing a single copy of the
+  // observation-space ensemble. The model GeometryIterator, Increment::getLocal/setLocal,
+  // ObsVector construction and methods (ones, mask, packEigen) and the obs localizations must
+  // be safe to call concurrently for distinct grid points. The MODEL and OBS traits declare
+  // this with "static const bool threadSafeLocalUpdate = true"; otherwise one thread is used.
+  Parameter<int> nthreads{"number of threads",
+                          "number of threads updating grid points concurrently "
+                          "(1: serial loop, 0: OpenMP default)",
+                          1, this, {oops::minConstraint(0)}};
+  Parameter<int> chunk{"chunk size",
+                       "number of grid points handed to a thread at a time",
+                       64, this, {oops::minConstraint(1)}};
+};
+
+/// Parameters for sharing the LETKF weights between neighbouring grid points
+class LocalEnsembleSolverWeightReuseParameters : public Parameters {
+  OOPS_CONCRETE_PARAMETERS(LocalEnsembleSolverWeightReuseParameters, Parameters)
+
+ public:
+  // Consecutive grid points (in GeometryIterator order) of a tile that have identical local
+  // observations and localization values share one weight computation, and the weights are
+  // applied to all of them with a single matrix product. Only used when the obs localizations
+  // support the sparse computation of local observations.
+  Parameter<int> tileSize{"tile size",
+                          "number of consecutive grid points searched for identical local "
+                          "observations (1: weights computed at every grid point)",
+                          1, this, {oops::minConstraint(1)}};
+};
+
 /// LocalEnsembleSolver parameters
 class LocalEnsembleSolverParameters : public Parameters {
   OOPS_CONCRETE_PARAMETERS(LocalEnsembleSolverParameters, Parameters)
  public:
   Parameter<LocalEnsembleSolverInflationParameters> infl{"local ensemble DA.inflation", {}, this};
+  Parameter<LocalEnsembleSolverThreadingParameters> threading{"local ensemble DA.threading",
+                                                              {}, this};
+  Parameter<LocalEnsembleSolverWeightReuseParameters> weightReuse{
+    "local ensemble DA.weight reuse", {}, this};
+  // When true, H(x) of all members is computed with one set of observers sharing the
+  // interpolation to the observation locations; the interpolated values of all members are
+  // exchanged between MPI tasks in a single communication round.
+  Parameter<bool> ensembleObserver{"local ensemble DA.ensemble observer",
+                                   "compute ensemble H(x) with a shared interpolation setup",
+                                   false, this};
 };
 
 // -----------------------------------------------------------------------------
@@ -8,13 +8,13 @@
 #ifndef OOPS_ASSIMILATION_MINIMIZERUTILS_H_
 #define OOPS_ASSIMILATION_MINIMIZERUTILS_H_
 
-#include <memory>
 #include <vector>
 
 #include "eckit/config/Configuration.h"
 
 #include "oops/assimilation/ControlIncrement.h"
 #include "oops/assimilation/HtRinvHMatrix.h"
+#include "oops/assimilation/VectorStore.h"
 #include "oops/util/Logger.h"
 
 namespace oops {
@@ -86,8 +86,8 @@ void writeEigenvectors(const eckit::Configuration & diagConf,
                        const std::vector<double> & diag,
                        const std::vector<double> & sub,
                        const std::vector<double> & rhs,
-                       std::vector<std::unique_ptr<ControlIncrement<MODEL, OBS>>> & zvecs,
-                       std::vector<std::unique_ptr<ControlIncrement<MODEL, OBS>>> & hvecs,
+                       VectorStore<ControlIncrement<MODEL, OBS>> & zvecs,
+                       VectorStore<ControlIncrement<MODEL, OBS>> & hvecs,
                        const HtRinvHMatrix<MODEL, OBS> & HtRinvH,
                        ControlIncrement<MODEL, OBS> & temp,
                        ControlIncrement<MODEL, OBS> & eigenv,
@@ -114,11 +114,11 @@ void writeEigenvectors(const eckit::Configuration & diagConf,
       eigenv.zero();
       for (unsigned int jj = 0; jj < nn; ++jj) {
         temp.zero();
-        temp = *zvecs[jj];
+        temp = zvecs[jj];
         temp *= eigenvecT.coeff(jj, nn - 1 - ii);
         eigenz += temp;
         temp.zero();
-        temp = *hvecs[jj];
+        temp = hvecs[jj];
         temp *= eigenvecT.coeff(jj, nn - 1 - ii);
         eigenv += temp;
       }
@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "eckit/config/LocalConfiguration.h"
+#include "oops/assimilation/VectorStore.h"
 #include "oops/util/dot_product.h"
 #include "oops/util/Logger.h"
 
@@ -61,17 +62,17 @@ template<typename VECTOR, typename BMATRIX, typename CMATRIX> class QNewtonLMP {
   int maxouter_;
   int update_;
 
-  std::vector<VECTOR> P_;
-  std::vector<VECTOR> Ph_;
-  std::vector<VECTOR> AP_;
-  std::vector<VECTOR> BAP_;
+  VectorStore<VECTOR> P_;
+  VectorStore<VECTOR> Ph_;
+  VectorStore<VECTOR> AP_;
+  VectorStore<VECTOR> BAP_;
   std::vector<double> rhos_;
   std::vector<unsigned> usedpairIndx_;
   std::unique_ptr<CMATRIX> Cmatrix_;
 
-  std::vector<VECTOR> savedP_;
-  std::vector<VECTOR> savedPh_;
-  std::vector<VECTOR> savedAP_;
+  VectorStore<VECTOR> savedP_;
+  VectorStore<VECTOR> savedPh_;
+  VectorStore<VECTOR> savedAP_;
   std::vector<double> savedrhos_;
 };
 
@@ -79,7 +80,8 @@ template<typename VECTOR, typename BMATRIX, typename CMATRIX> class QNewtonLMP {
 
 template<typename VECTOR, typename BMATRIX, typename CMATRIX>
 QNewtonLMP<VECTOR, BMATRIX, CMATRIX>::QNewtonLMP(const eckit::Configuration & conf)
-  : maxpairs_(0), maxnewpairs_(0), useoldpairs_(false), maxouter_(0), update_(1)
+  : maxpairs_(0), maxnewpairs_(0), useoldpairs_(false), maxouter_(0), update_(1),
+    P_(conf), Ph_(conf), AP_(conf), BAP_(conf), savedP_(conf), savedPh_(conf), savedAP_(conf)
 {
   maxouter_ = conf.getInt("nouter");
   Log::info() << "QNewtonLMP: maxouter : " << maxouter_ << std::endl;
@@ -109,9 +111,9 @@ void QNewtonLMP<VECTOR, BMATRIX, CMATRIX>::push(const VECTOR & p, const VECTOR &
   ASSERT(savedP_.size() <= maxnewpairs_);
   if (maxnewpairs_ > 0 && update_ < maxouter_) {
     if (savedP_.size() == maxnewpairs_) {
-      savedP_.erase(savedP_.begin());
-      savedPh_.erase(savedPh_.begin());
-      savedAP_.erase(savedAP_.begin());
+      savedP_.erase_front();
+      savedPh_.erase_front();
+      savedAP_.erase_front();
       savedrhos_.erase(savedrhos_.begin());
     }
     savedP_.push_back(p);
@@ -158,10 +160,10 @@ void QNewtonLMP<VECTOR, BMATRIX, CMATRIX>::update(const BMATRIX & Bmat) {
     if (oldpairs + newpairs > maxpairs_) {
       rmpairs = oldpairs + newpairs - maxpairs_;
       for (unsigned jv = 0; jv < rmpairs; ++jv) {
-        Ph_.erase(Ph_.begin());
-        P_.erase(P_.begin());
-        AP_.erase(AP_.begin());
-        BAP_.erase(BAP_.begin());
+        Ph_.erase_front();
+        P_.erase_front();
+        AP_.erase_front();
+        BAP_.erase_front();
         rhos_.erase(rhos_.begin());
       }
       oldpairs -= rmpairs;
@@ -20,6 +20,7 @@
 
 #include "eckit/config/LocalConfiguration.h"
 #include "oops/assimilation/TriDiagSpectrum.h"
+#include "oops/assimilation/VectorStore.h"
 #include "oops/util/dot_product.h"
 #include "oops/util/Logger.h"
 
@@ -55,8 +56,8 @@ template<typename VECTOR, typename CMATRIX> class SpectralLMP {
   /// Set ObsBias part of the preconditioner to \p Cmat.
   void updateObsBias(std::unique_ptr<CMATRIX> Cmat);
 
-  void update(std::vector<std::unique_ptr<VECTOR>> &, std::vector<std::unique_ptr<VECTOR>> &,
-              std::vector<std::unique_ptr<VECTOR>> &, std::vector<double> &, std::vector<double> &);
+  void update(VectorStore<VECTOR> &, VectorStore<VECTOR> &, VectorStore<VECTOR> &,
+              std::vector<double> &, std::vector<double> &);
 
   void multiply(const VECTOR &, VECTOR &) const;
 
@@ -67,16 +68,16 @@ template<typename VECTOR, typename CMATRIX> class SpectralLMP {
   int maxouter_;
   int update_;
 
-  std::vector<std::unique_ptr<VECTOR>> X_;
-  std::vector<std::unique_ptr<VECTOR>> U_;
+  VectorStore<VECTOR> X_;
+  VectorStore<VECTOR> U_;
   std::vector<double> eigvals_;
   std::vector<double> omega_;
 
   // For RitzPrecond
-  std::vector<std::unique_ptr<VECTOR>> Y_;
-  std::vector<std::unique_ptr<VECTOR>> S_;
-  std::vector<VECTOR> Zlast_;
-  std::vector<VECTOR> Zhlast_;
+  VectorStore<VECTOR> Y_;
+  VectorStore<VECTOR> S_;
+  VectorStore<VECTOR> Zlast_;
+  VectorStore<VECTOR> Zhlast_;
   std::vector<unsigned> usedpairIndx_;
   std::vector<unsigned> zcount;
 
@@ -88,7 +89,8 @@ template<typename VECTOR, typename CMATRIX> class SpectralLMP {
 
 template<typename VECTOR, typename CMATRIX>
 SpectralLMP<VECTOR, CMATRIX>::SpectralLMP(const eckit::Configuration & conf)
-  : maxpairs_(0), useoldpairs_(false), RitzPrecond_(false), maxouter_(0), update_(0)
+  : maxpairs_(0), useoldpairs_(false), RitzPrecond_(false), maxouter_(0), update_(0),
+    X_(conf), U_(conf), Y_(conf), S_(conf), Zlast_(conf), Zhlast_(conf)
 {
   maxouter_ = conf.getInt("nouter");
   Log::info() << "SpectralLMP: maxouter = " << maxouter_ << std::endl;
@@ -124,11 +126,11 @@ void SpectralLMP<VECTOR, CMATRIX>::updateObsBias(std::unique_ptr<CMATRIX> Cmat)
 // -----------------------------------------------------------------------------
 
 template<typename VECTOR, typename CMATRIX>
-void SpectralLMP<VECTOR, CMATRIX>::update(std::vector<std::unique_ptr<VECTOR>> & Zv,
-                                 std::vector<std::unique_ptr<VECTOR>> & Zhl,
-                                 std::vector<std::unique_ptr<VECTOR>> & Zl,
-                                 std::vector<double> & alphas,
-                                 std::vector<double> & betas) {
+void SpectralLMP<VECTOR, CMATRIX>::update(VectorStore<VECTOR> & Zv,
+                                          VectorStore<VECTOR> & Zhl,
+                                          VectorStore<VECTOR> & Zl,
+                                          std::vector<double> & alphas,
+                                          std::vector<double> & betas) {
 //  If useoldpairs = false, use only current information
   if (!useoldpairs_) {
     eigvals_.clear();
@@ -211,29 +213,31 @@ void SpectralLMP<VECTOR, CMATRIX>::update(std::vector<std::unique_ptr<VECTOR>> &
 //    Remove the first oldpairIndx elements
       unsigned minsize = std::min(oldpairIndx, maxpairs_);
       unsigned xsize = X_.size();
-      X_.erase(X_.begin(), X_.begin() + std::min(xsize, minsize));
-      U_.erase(U_.begin(), U_.begin() + std::min(xsize, minsize));
+      for (unsigned jj = 0; jj < std::min(xsize, minsize); ++jj) {
+        X_.erase_front();
+        U_.erase_front();
+      }
     }
     for (unsigned jiter = 0; jiter < convIndx.size(); ++jiter) {
-      std::unique_ptr<VECTOR> ww(new VECTOR(*Zl[0], false));
+      VECTOR ww(Zl[0], false);
       for (unsigned iiter = 0; iiter < nvec-1; ++iiter) {
-        ww->axpy(evecs[convIndx[jiter]][iiter], *Zl[iiter]);
+        ww.axpy(evecs[convIndx[jiter]][iiter], Zl[iiter]);
       }
 //    Add new information
-      X_.emplace_back(std::move(ww));
+      X_.push_back(ww);
     }
     for (unsigned jiter = 0; jiter < convIndx.size(); ++jiter) {
-      std::unique_ptr<VECTOR> ww(new VECTOR(*Zl[0], false));
+      VECTOR ww(Zl[0], false);
       for (unsigned iiter = 0; iiter < nvec-1; ++iiter) {
-        ww->axpy(evecs[convIndx[jiter]][iiter], *Zhl[iiter]);
+        ww.axpy(evecs[convIndx[jiter]][iiter], Zhl[iiter]);
       }
 //    Add new information
-      U_.emplace_back(std::move(ww));
+      U_.push_back(ww);
     }
 
     if (RitzPrecond_) {
-      Zlast_.push_back(*Zl[nvec-1]);
-      Zhlast_.push_back(*Zhl[nvec-1]);
+      Zlast_.push_back(Zl[nvec-1]);
+      Zhlast_.push_back(Zhl[nvec-1]);
 
 //    Calculate the matrix Y = [U1*omega1, ..., Uk*omegak]
       Y_.clear();
@@ -242,12 +246,12 @@ void SpectralLMP<VECTOR, CMATRIX>::update(std::vector<std::unique_ptr<VECTOR>> &
       for (unsigned kiter = 0; kiter < usedpairIndx_.size(); ++kiter) {
         if (usedpairIndx_[kiter] != 0) {
           zcount.push_back(kiter);
-          std::unique_ptr<VECTOR> ww(new VECTOR(*Zl[0], false));
+          VECTOR ww(Zl[0], false);
           for (unsigned jiter = 0; jiter < usedpairIndx_[kiter]; ++jiter) {
-            ww->axpy(omega_[jiter + kk], *U_[jiter + kk]);
+            ww.axpy(omega_[jiter + kk], U_[jiter + kk]);
           }
           kk += usedpairIndx_[kiter];
-          Y_.emplace_back(std::move(ww));
+          Y_.push_back(ww);
         }
       }
 
@@ -256,12 +260,12 @@ void SpectralLMP<VECTOR, CMATRIX>::update(std::vector<std::unique_ptr<VECTOR>> &
       kk = 0;
       for (unsigned kiter = 0; kiter < usedpairIndx_.size(); ++kiter) {
         if (usedpairIndx_[kiter] != 0) {
-          std::unique_ptr<VECTOR> ww(new VECTOR(*Zl[0], false));
+          VECTOR ww(Zl[0], false);
           for (unsigned jiter = 0; jiter < usedpairIndx_[kiter]; ++jiter) {
-            ww->axpy(omega_[jiter + kk], *X_[jiter + kk]);
+            ww.axpy(omega_[jiter + kk], X_[jiter + kk]);
           }
           kk += usedpairIndx_[kiter];
-          S_.emplace_back(std::move(ww));
+          S_.push_back(ww);
         }
       }
     }
@@ -287,32 +291,72 @@ void SpectralLMP<VECTOR, CMATRIX>::multiply(const VECTOR & a, VECTOR & b) const
   }
   Cmatrix_->multiply(a, b);
 
-  for (unsigned iiter = 0; iiter < eigvals_.size(); ++iiter) {
-    double zeval = std::min(10.0, eigvals_[iiter]);
-//    double zeval = eigvals_[iiter];
-    double zz = 1.0/zeval - 1.0;
-    b.axpy(zz*dot_product(a, *X_[iiter]), *U_[iiter]);
+  // All the dot products with a are done together, then all the updates of b (one vector
+  // at a time when some vectors are paged, as references to them do not stay valid)
+  const unsigned npairs = eigvals_.size();
+  std::vector<double> coefs(npairs);
+  if (!X_.paged() && !U_.paged()) {
+    std::vector<const VECTOR *> xvecs(npairs);
+    std::vector<const VECTOR *> uvecs(npairs);
+    for (unsigned iiter = 0; iiter < npairs; ++iiter) {
+      xvecs[iiter] = &X_[iiter];
+      uvecs[iiter] = &U_[iiter];
+    }
+    coefs = a.dot_products_with(xvecs);
+    for (unsigned iiter = 0; iiter < npairs; ++iiter) {
+      double zeval = std::min(10.0, eigvals_[iiter]);
+//      double zeval = eigvals_[iiter];
+      double zz = 1.0/zeval - 1.0;
+      coefs[iiter] *= zz;
+    }
+    b.multi_axpy(coefs, uvecs);
+  } else {
+    for (unsigned iiter = 0; iiter < npairs; ++iiter) coefs[iiter] = dot_product(a, X_[iiter]);
+    for (unsigned iiter = 0; iiter < npairs; ++iiter) {
+      double zeval = std::min(10.0, eigvals_[iiter]);
+      double zz = 1.0/zeval - 1.0;
+      b.axpy(coefs[iiter] * zz, U_[iiter]);
+    }
   }
 
   if (RitzPrecond_ && eigvals_.size() != 0) {
-//  Sk'*a
-    std::vector<double> sta;
-    sta.clear();
-    for (unsigned iiter = 0; iiter < S_.size(); ++iiter) {
-      sta.push_back(dot_product(*S_[iiter], a));
+//  Sk'*a and Zlast'*a
+    const unsigned nk = S_.size();
+    std::vector<double> sta(nk);
+    std::vector<double> zta(nk);
+    const bool paged = S_.paged() || Zlast_.paged() || Zhlast_.paged();
+    if (!paged) {
+      std::vector<const VECTOR *> svecs(nk);
+      std::vector<const VECTOR *> zvecs(nk);
+      for (unsigned kiter = 0; kiter < nk; ++kiter) {
+        svecs[kiter] = &S_[kiter];
+        zvecs[kiter] = &Zlast_[zcount[kiter]];
+      }
+      sta = a.dot_products_with(svecs);
+      zta = a.dot_products_with(zvecs);
+    } else {
+      for (unsigned kiter = 0; kiter < nk; ++kiter) {
+        sta[kiter] = dot_product(a, S_[kiter]);
+        zta[kiter] = dot_product(a, Zlast_[zcount[kiter]]);
+      }
     }
 
 //  Yk (sta(k) - Zlast' a)
-    for (unsigned kiter = 0; kiter < S_.size(); ++kiter) {
+    for (unsigned kiter = 0; kiter < nk; ++kiter) {
       for (unsigned iiter = 0; iiter < eigvals_.size(); ++iiter) {
-        double wxap = sta[kiter] - dot_product(a, Zlast_[zcount[kiter]]);
-        b.axpy(wxap, *Y_[kiter]);
+        double wxap = sta[kiter] - zta[kiter];
+        b.axpy(wxap, Y_[kiter]);
       }
     }
 
 //  -Zhlast sta
-    for (unsigned kiter = 0; kiter < S_.size(); ++kiter) {
-      b.axpy(-sta[kiter], Zhlast_[zcount[kiter]]);
+    for (unsigned kiter = 0; kiter < nk; ++kiter) sta[kiter] = -sta[kiter];
+    if (!paged) {
+      std::vector<const VECTOR *> zhvecs(nk);
+      for (unsigned kiter = 0; kiter < nk; ++kiter) zhvecs[kiter] = &Zhlast_[zcount[kiter]];
+      b.multi_axpy(sta, zhvecs);
+    } else {
+      for (unsigned kiter = 0; kiter < nk; ++kiter) b.axpy(sta[kiter], Zhlast_[zcount[kiter]]);
     }
   }
 }
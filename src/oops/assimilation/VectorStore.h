@@ -0,0 +1,306 @@
+/*
+ * (C) Copyright 2023 UCAR.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#ifndef OOPS_ASSIMILATION_VECTORSTORE_H_
+#define OOPS_ASSIMILATION_VECTORSTORE_H_
+
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <future>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+#include "eckit/config/LocalConfiguration.h"
+#include "eckit/exception/Exceptions.h"
+
+#include "oops/mpi/mpi.h"
+#include "oops/util/Logger.h"
+#include "oops/util/Timer.h"
+
+namespace oops {
+
+// -----------------------------------------------------------------------------
+
+/// Storage for the vectors kept by minimizers and preconditioners (Krylov basis, LMP pairs).
+///
+/// By default all vectors are kept in memory, as in a std::vector. With a "vector store"
+/// section in the minimizer configuration only the most recent "in memory" vectors are kept
+/// as VECTOR objects; older ones are serialized and either written to files in "directory"
+/// (asynchronously) or, when no directory is given, kept in memory as serialized values.
+/// "single precision: true" pages the values (to files or in memory) in single precision,
+/// otherwise they are paged at full precision and read back exactly.
+///
+/// Paged vectors are read back into one of two buffers by operator[], so a reference to a
+/// paged vector remains valid until two other paged vectors of the same store have been
+/// accessed. When vectors are accessed in sequence, the next one is prefetched in the
+/// background.
+template <typename VECTOR>
+class VectorStore : private boost::noncopyable {
+ public:
+  static const std::string classname() {return "oops::VectorStore";}
+
+  explicit VectorStore(const eckit::Configuration &);
+  ~VectorStore();
+
+  void push_back(const VECTOR &);
+  void erase_front();
+  void clear();
+
+  const VECTOR & operator[](const size_t) const;
+  size_t size() const {return entries_.size();}
+  bool empty() const {return entries_.empty();}
+  /// True if some vectors are not held as VECTOR objects
+  bool paged() const {return entries_.size() > nmemory_;}
+
+ private:
+  struct Entry {
+    std::unique_ptr<VECTOR> vec;      // in memory
+    std::vector<double> values;       // paged without a directory
+    std::vector<float> svalues;       // paged without a directory, in single precision
+    std::string file;                 // paged to a file
+    std::shared_future<void> written;
+    size_t nvals = 0;
+  };
+
+  void pageOut(Entry &);
+  static std::vector<double> unpack(const Entry &, const bool);
+  void waitPrefetch() const;
+  void invalidate() const;
+  void remove(Entry &) const;
+
+  size_t maxmemory_;
+  std::string directory_;
+  bool single_;
+  std::deque<Entry> entries_;
+  size_t nmemory_;                    // number of entries at the back held as VECTOR
+  size_t nfiles_;                     // files written so far (for unique names)
+  std::string prefix_;
+
+  mutable std::unique_ptr<VECTOR> buffers_[2];
+  mutable size_t bufindex_[2];
+  mutable size_t nextbuf_;
+  mutable size_t last_;
+  mutable std::future<std::vector<double>> prefetch_;
+  mutable size_t prefetchindex_;
+  static constexpr size_t npos = std::numeric_limits<size_t>::max();
+};
+
+// =============================================================================
+
+template<typename VECTOR>
+VectorStore<VECTOR>::VectorStore(const eckit::Configuration & conf)
+  : maxmemory_(npos), directory_(), single_(false), entries_(), nmemory_(0), nfiles_(0),
+    prefix_(), bufindex_{npos, npos}, nextbuf_(0), last_(npos), prefetch_(),
+    prefetchindex_(npos)
+{
+  if (conf.has("vector store")) {
+    const eckit::LocalConfiguration storeConf(conf, "vector store");
+    maxmemory_ = storeConf.getUnsigned("in memory");
+    directory_ = storeConf.getString("directory", "");
+    single_ = storeConf.getBool("single precision", false);
+    ASSERT(maxmemory_ > 0);
+    static size_t nstores = 0;
+    prefix_ = directory_ + "/vectors_" + std::to_string(oops::mpi::world().rank()) + "_"
+              + std::to_string(nstores++) + "_";
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename VECTOR>
+VectorStore<VECTOR>::~VectorStore() {
+  this->clear();
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename VECTOR>
+void VectorStore<VECTOR>::push_back(const VECTOR & vec) {
+  entries_.emplace_back();
+  entries_.back().vec.reset(new VECTOR(vec));
+  ++nmemory_;
+  if (nmemory_ > maxmemory_) {
+    // Oldest vector still in memory
+    this->pageOut(entries_[entries_.size() - nmemory_]);
+    --nmemory_;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename VECTOR>
+void VectorStore<VECTOR>::erase_front() {
+  ASSERT(!entries_.empty());
+  this->invalidate();
+  this->remove(entries_.front());
+  if (nmemory_ == entries_.size()) --nmemory_;
+  entries_.pop_front();
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename VECTOR>
+void VectorStore<VECTOR>::clear() {
+  this->invalidate();
+  for (Entry & entry : entries_) this->remove(entry);
+  entries_.clear();
+  nmemory_ = 0;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename VECTOR>
+const VECTOR & VectorStore<VECTOR>::operator[](const size_t jj) const {
+  ASSERT(jj < entries_.size());
+  const Entry & entry = entries_[jj];
+  if (entry.vec) return *entry.vec;
+
+  // Paged vector: already in a buffer?
+  for (size_t jb = 0; jb < 2; ++jb) {
+    if (bufindex_[jb] == jj) {
+      nextbuf_ = 1 - jb;  // the other buffer is reused first
+      return *buffers_[jb];
+    }
+  }
+
+  static const util::TimerId timerId(classname(), "read");
+  util::Timer timer(timerId);
+  std::vector<double> vals;
+  if (prefetchindex_ == jj) {
+    vals = prefetch_.get();
+    prefetchindex_ = npos;
+  } else {
+    this->waitPrefetch();
+    vals = unpack(entry, single_);
+  }
+  const size_t jb = nextbuf_;
+  nextbuf_ = 1 - nextbuf_;
+  if (!buffers_[jb]) buffers_[jb].reset(new VECTOR(*entries_.back().vec));
+  size_t index = 0;
+  buffers_[jb]->deserialize(vals, index);
+  ASSERT(index == vals.size());
+  bufindex_[jb] = jj;
+
+  // Prefetch the next vector in the direction of the previous accesses
+  const bool backward = (last_ != npos && jj < last_);
+  last_ = jj;
+  const size_t jnext = backward ? jj - 1 : jj + 1;
+  if ((backward ? jj > 0 : jnext < entries_.size()) && !entries_[jnext].vec) {
+    const Entry * next = &entries_[jnext];
+    const bool single = single_;
+    prefetch_ = std::async(std::launch::async, [next, single]() {return unpack(*next, single);});
+    prefetchindex_ = jnext;
+  }
+  return *buffers_[jb];
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename VECTOR>
+void VectorStore<VECTOR>::pageOut(Entry & entry) {
+  static const util::TimerId timerId(classname(), "pageOut");
+  util::Timer timer(timerId);
+  std::vector<double> vals;
+  entry.vec->serialize(vals);
+  entry.nvals = vals.size();
+  // The last in-memory vector is used as a template to read paged vectors back
+  entry.vec.reset();
+
+  if (directory_.empty()) {
+    if (single_) {
+      entry.svalues.assign(vals.begin(), vals.end());
+    } else {
+      entry.values = std::move(vals);
+    }
+  } else {
+    entry.file = prefix_ + std::to_string(nfiles_++);
+    const std::string file = entry.file;
+    const bool single = single_;
+    entry.written = std::async(std::launch::async, [file, single, vals]() {
+      std::ofstream out(file, std::ios::binary);
+      if (!out) throw eckit::CantOpenFile(file, Here());
+      if (single) {
+        const std::vector<float> svals(vals.begin(), vals.end());
+        out.write(reinterpret_cast<const char *>(svals.data()), svals.size() * sizeof(float));
+      } else {
+        out.write(reinterpret_cast<const char *>(vals.data()), vals.size() * sizeof(double));
+      }
+      if (!out) throw eckit::WriteError(file, Here());
+    }).share();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename VECTOR>
+std::vector<double> VectorStore<VECTOR>::unpack(const Entry & entry, const bool single) {
+  std::vector<double> vals;
+  if (entry.file.empty()) {
+    if (single) {
+      vals.assign(entry.svalues.begin(), entry.svalues.end());
+    } else {
+      vals = entry.values;
+    }
+  } else {
+    entry.written.get();
+    std::ifstream in(entry.file, std::ios::binary);
+    if (!in) throw eckit::CantOpenFile(entry.file, Here());
+    if (single) {
+      std::vector<float> svals(entry.nvals);
+      in.read(reinterpret_cast<char *>(svals.data()), svals.size() * sizeof(float));
+      vals.assign(svals.begin(), svals.end());
+    } else {
+      vals.resize(entry.nvals);
+      in.read(reinterpret_cast<char *>(vals.data()), vals.size() * sizeof(double));
+    }
+    if (!in) throw eckit::ReadError(entry.file, Here());
+  }
+  return vals;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename VECTOR>
+void VectorStore<VECTOR>::waitPrefetch() const {
+  if (prefetchindex_ != npos) {
+    prefetch_.wait();
+    prefetchindex_ = npos;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename VECTOR>
+void VectorStore<VECTOR>::invalidate() const {
+  // Indices shift when vectors are removed
+  this->waitPrefetch();
+  bufindex_[0] = npos;
+  bufindex_[1] = npos;
+  last_ = npos;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename VECTOR>
+void VectorStore<VECTOR>::remove(Entry & entry) const {
+  if (!entry.file.empty()) {
+    entry.written.wait();
+    std::remove(entry.file.c_str());
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+}  // namespace oops
+
+#endif  // OOPS_ASSIMILATION_VECTORSTORE_H_
@@ -51,7 +51,8 @@ class AnalyticInit : private util::ObjectCounter<AnalyticInit<OBS> > {
 template<typename OBS>
 AnalyticInit<OBS>::AnalyticInit(const AnalyticInitParametersBase & params) {
   Log::trace() << "AnalyticInit<OBS>::AnalyticInit starting" << std::endl;
-  util::Timer timer(classname(), "AnalyticInit");
+  static const util::TimerId timerId(classname(), "AnalyticInit");
+  util::Timer timer(timerId);
   analytic_ = AnalyticInitFactory<OBS>::create(params);
   Log::trace() << "AnalyticInit<OBS>::AnalyticInit done" << std::endl;
 }
@@ -61,7 +62,8 @@ AnalyticInit<OBS>::AnalyticInit(const AnalyticInitParametersBase & params) {
 template<typename OBS>
 AnalyticInit<OBS>::~AnalyticInit() {
   Log::trace() << "AnalyticInit<OBS>::~AnalyticInit starting" << std::endl;
-  util::Timer timer(classname(), "~AnalyticInit");
+  static const util::TimerId timerId(classname(), "~AnalyticInit");
+  util::Timer timer(timerId);
   analytic_.reset();
   Log::trace() << "AnalyticInit<OBS>::~AnalyticInit done" << std::endl;
 }
@@ -71,7 +73,8 @@ AnalyticInit<OBS>::~AnalyticInit() {
 template<typename OBS>
 void AnalyticInit<OBS>::fillGeoVaLs(const Locations_ & locs, GeoVaLs_ & gvals) const {
   Log::trace() << "AnalyticInit<OBS>::fillGeoVaLs starting" << std::endl;
-  util::Timer timer(classname(), "fillGeoVaLs");
+  static const util::TimerId timerId(classname(), "fillGeoVaLs");
+  util::Timer timer(timerId);
   analytic_->fillGeoVaLs(locs, gvals);
   Log::trace() << "AnalyticInit<OBS>::fillGeoVaLs done" << std::endl;
 }
@@ -11,6 +11,7 @@
 #ifndef OOPS_BASE_ENSEMBLECOVARIANCE_H_
 #define OOPS_BASE_ENSEMBLECOVARIANCE_H_
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -44,6 +45,8 @@ class EnsembleCovarianceParameters : public ModelSpaceCovarianceParametersBase<M
   IncrementEnsembleFromStatesParameters<MODEL> ensemble{this};
   oops::OptionalParameter<eckit::LocalConfiguration> localization{"localization",
                          "localization applied to ensemble covariances", this};
+  Parameter<size_t> batchSize{"localization batch size",
+                              "number of members localized together", 1, this};
 };
 
 /// Generic ensemble based model space error covariance.
@@ -75,6 +78,7 @@ class EnsembleCovariance : public ModelSpaceCovarianceBase<MODEL>,
 
   EnsemblePtr_ ens_;
   std::unique_ptr<Localization_> loc_;
+  size_t batchSize_;
   int seed_ = 7;  // For reproducibility
 };
 
@@ -86,15 +90,18 @@ template<typename MODEL>
 EnsembleCovariance<MODEL>::EnsembleCovariance(const Geometry_ & resol, const Variables & vars,
                                               const Parameters_ & params,
                                               const State_ & xb, const State_ & fg)
-  : ModelSpaceCovarianceBase<MODEL>(resol, params, xb, fg), ens_(), loc_()
+  : ModelSpaceCovarianceBase<MODEL>(resol, params, xb, fg), ens_(), loc_(),
+    batchSize_(params.batchSize)
 {
   Log::trace() << "EnsembleCovariance::EnsembleCovariance start" << std::endl;
-  util::Timer timer("oops::Covariance", "EnsembleCovariance");
+  static const util::TimerId timerId("oops::Covariance", "EnsembleCovariance");
+  util::Timer timer(timerId);
   size_t init = eckit::system::ResourceUsage().maxResidentSetSize();
   ens_.reset(new Ensemble_(params.ensemble, xb, fg, resol, vars));
   if (params.localization.value() != boost::none) {
     loc_.reset(new Localization_(resol, xb.variables(), *params.localization.value()));
   }
+  ASSERT(batchSize_ > 0);
   size_t current = eckit::system::ResourceUsage().maxResidentSetSize();
   this->setObjectSize(current - init);
   Log::trace() << "EnsembleCovariance::EnsembleCovariance done" << std::endl;
@@ -109,12 +116,19 @@ template<typename MODEL>
 void EnsembleCovariance<MODEL>::doRandomize(Increment_ & dx) const {
   dx.zero();
   if (loc_) {
-    // Localized covariance matrix
-    for (unsigned int ie = 0; ie < ens_->size(); ++ie) {
-      Increment_ tmp(dx);
+    // Localized covariance matrix, by batches of members
+    const size_t nbatch = std::min(batchSize_, ens_->size());
+    std::vector<Increment_> work(nbatch, dx);
+    for (size_t ibgn = 0; ibgn < ens_->size(); ibgn += nbatch) {
+      const size_t nn = std::min(nbatch, ens_->size() - ibgn);
+      std::vector<Increment_ *> tmp(nn);
+      std::vector<const Increment_ *> mem(nn);
+      for (size_t jj = 0; jj < nn; ++jj) {
+        tmp[jj] = &work[jj];
+        mem[jj] = &(*ens_)[ibgn + jj];
+      }
       loc_->randomize(tmp);
-      tmp.schur_product_with((*ens_)[ie]);
-      dx.axpy(1.0, tmp, false);
+      dx.schur_accumul(tmp, mem);
     }
   } else {
     // Raw covariance matrix
@@ -129,16 +143,26 @@ void EnsembleCovariance<MODEL>::doRandomize(Increment_ & dx) const {
 template<typename MODEL>
 void EnsembleCovariance<MODEL>::doMultiply(const Increment_ & dxi, Increment_ & dxo) const {
   dxo.zero();
-  for (unsigned int ie = 0; ie < ens_->size(); ++ie) {
-    if (loc_) {
-      // Localized covariance matrix
-      Increment_ dx(dxi);
-      dx.schur_product_with((*ens_)[ie]);
+  if (loc_) {
+    // Localized covariance matrix, by batches of members
+    const size_t nbatch = std::min(batchSize_, ens_->size());
+    std::vector<Increment_> work(nbatch, dxi);
+    for (size_t ibgn = 0; ibgn < ens_->size(); ibgn += nbatch) {
+      const size_t nn = std::min(nbatch, ens_->size() - ibgn);
+      std::vector<Increment_ *> dx(nn);
+      std::vector<const Increment_ *> mem(nn);
+      for (size_t jj = 0; jj < nn; ++jj) {
+        dx[jj] = &work[jj];
+        mem[jj] = &(*ens_)[ibgn + jj];
+        *dx[jj] = dxi;
+        dx[jj]->schur_product_with(*mem[jj]);
+      }
       loc_->multiply(dx);
-      dx.schur_product_with((*ens_)[ie]);
-      dxo.axpy(1.0, dx, false);
-    } else {
-      // Raw covariance matrix
+      dxo.schur_accumul(dx, mem);
+    }
+  } else {
+    // Raw covariance matrix
+    for (unsigned int ie = 0; ie < ens_->size(); ++ie) {
       double wgt = dxi.dot_product_with((*ens_)[ie]);
       dxo.axpy(wgt, (*ens_)[ie], false);
     }
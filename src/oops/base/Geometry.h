@@ -12,6 +12,7 @@
 #ifndef OOPS_BASE_GEOMETRY_H_
 #define OOPS_BASE_GEOMETRY_H_
 
+#include <cstdint>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -23,6 +24,7 @@
 
 #include "oops/interface/Geometry.h"
 #include "oops/mpi/mpi.h"
+#include "oops/util/hashValues.h"
 #include "oops/util/Logger.h"
 #include "oops/util/Timer.h"
 #include "oops/util/TypeTraits.h"
@@ -115,6 +117,10 @@ class Geometry : public interface::Geometry<MODEL> {
 
   atlas::util::KDTree<size_t>::ValueList closestPoints(const double, const double, const int) const;
 
+  /// Hash of the coordinates of the grid points on this task (including halo): geometries
+  /// with the same local grid have the same hash, e.g. to reuse interpolation weights
+  uint64_t localGridHash() const {return localGridHash_;}
+
  private:
   std::unique_ptr<util::Timer> timer_;
   const eckit::mpi::Comm * spaceComm_;  /// pointer to the MPI communicator in space
@@ -123,6 +129,7 @@ class Geometry : public interface::Geometry<MODEL> {
   const atlas::Geometry earth_;
   atlas::util::IndexKDTree localTree_;
   atlas::util::IndexKDTree globalTree_;
+  uint64_t localGridHash_;
 
   void setLocalTree();
   void setGlobalTree();
@@ -218,6 +225,7 @@ void Geometry<MODEL>::setLocalTree() {
   std::vector<size_t> indx(npoints);
   for (size_t jj = 0; jj < npoints; ++jj) indx[jj] = jj;
   localTree_.build(lons, lats, indx);
+  localGridHash_ = util::hashValues(lons, util::hashValues(lats));
 }
 
 // -----------------------------------------------------------------------------
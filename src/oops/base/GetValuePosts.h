@@ -42,8 +42,9 @@ class GetValuePosts : public PostBase<State<MODEL>> {
   typedef std::shared_ptr<GetValues<MODEL, OBS>> GetValuePtr_;
 
  public:
-/// \brief Saves Locations and Variables to be processed
-  explicit GetValuePosts(const GetValuesParameters<MODEL> &);
+/// \brief Saves Locations and Variables to be processed; \p member is the index of the
+/// ensemble member processed when the GetValues are shared by an ensemble
+  explicit GetValuePosts(const GetValuesParameters<MODEL> &, const size_t member = 0);
 
   void append(GetValuePtr_);
 
@@ -58,13 +59,15 @@ class GetValuePosts : public PostBase<State<MODEL>> {
   const GetValuesParameters<MODEL> params_;
   std::vector<GetValuePtr_> getvals_;
   Variables geovars_;
+  const size_t member_;
 };
 
 // -----------------------------------------------------------------------------
 
 template <typename MODEL, typename OBS>
-GetValuePosts<MODEL, OBS>::GetValuePosts(const GetValuesParameters<MODEL>& params)
-  : PostBase<State_>(), params_(params), getvals_(), geovars_() {
+GetValuePosts<MODEL, OBS>::GetValuePosts(const GetValuesParameters<MODEL>& params,
+                                         const size_t member)
+  : PostBase<State_>(), params_(params), getvals_(), geovars_(), member_(member) {
   Log::trace() << "GetValuePosts::GetValuePosts" << std::endl;
 }
 
@@ -99,7 +102,7 @@ void GetValuePosts<MODEL, OBS>::doProcessing(const State_ & xx) {
   State_ zz(xx);
   chvar.changeVar(zz, geovars_);
 
-  for (GetValuePtr_ getval : getvals_) getval->process(zz);
+  for (GetValuePtr_ getval : getvals_) getval->process(zz, member_);
 
   Log::trace() << "GetValuePosts::doProcessing done" << std::endl;
 }
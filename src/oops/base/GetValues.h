@@ -104,9 +104,14 @@ class GetValues : private util::ObjectCounter<GetValues<MODEL, OBS> > {
 
 /// Nonlinear
   void initialize(const util::Duration &);
-  void process(const State_ &);
+  void process(const State_ &, const size_t member = 0);
   void finalize();
-  void fillGeoVaLs(GeoVaLs_ &);
+  void fillGeoVaLs(GeoVaLs_ &, const size_t member = 0);
+
+/// Share this GetValues between the H(x) computations of \p nmembers ensemble members:
+/// the values of all members are interpolated into one buffer and exchanged between tasks
+/// in a single communication round, once finalize has been called for every member.
+  void setEnsembleSize(const size_t nmembers);
 
 /// TL
   void initializeTL(const util::Duration &);
@@ -126,8 +131,16 @@ class GetValues : private util::ObjectCounter<GetValues<MODEL, OBS> > {
 
  private:
 /// time-interpolation helper: adds contribution from this time to running total
-  void incInterpValues(const util::DateTime &, const std::vector<bool> &,
-                       const size_t &, const std::vector<double> &);
+  void incInterpValues(const util::DateTime &, const std::vector<size_t> &,
+                       const size_t &, const std::vector<double> &, const size_t);
+/// observations interpolated here for a task with times in (t1, t2]
+  const std::vector<size_t> & obsInSlot(const size_t, const util::DateTime &,
+                                        const util::DateTime &);
+/// streaming helpers: send (and post receives for) the values of all observations up to
+/// a given time not yet sent, then gather the received values into the GeoVaLs
+  void resetStreams();
+  void sendCompleted(const util::DateTime &, const bool, const size_t);
+  void receiveCompleted(GeoVaLs_ &, const size_t);
 
   util::DateTime winbgn_;   /// Begining of assimilation window
   util::DateTime winend_;   /// End of assimilation window
@@ -145,10 +158,26 @@ class GetValues : private util::ObjectCounter<GetValues<MODEL, OBS> > {
   std::vector<std::unique_ptr<LocalInterp_>> interp_;
   std::vector<std::vector<size_t>> myobs_index_by_task_;
   std::vector<std::vector<util::DateTime>> obs_times_by_task_;
+  std::vector<std::vector<size_t>> obs_by_time_;    /// obs_times_by_task_ sorted by time:
+  std::vector<std::vector<util::DateTime>> sorted_times_;  /// indices and times
+  std::vector<size_t> slotobs_;        /// obs in the current time slot
+  std::vector<double> tmpinterp_;      /// values interpolated in the current time slot
   std::vector<std::vector<double>> locinterp_;
   std::vector<std::vector<double>> recvinterp_;
   std::vector<eckit::mpi::Request> send_req_;
   std::vector<eckit::mpi::Request> recv_req_;
+  bool streaming_;                     /// send values as each time slot is completed
+  std::vector<std::vector<size_t>> myobs_by_time_;  /// myobs_index_by_task_ sorted by time:
+  std::vector<std::vector<util::DateTime>> mysorted_times_;  /// indices and times
+  std::vector<size_t> nsent_;                   /// values sent, by destination task
+  std::vector<size_t> nposted_;                 /// receives posted, by source task
+  std::vector<std::vector<double>> sendbufs_;   /// one buffer per message sent
+  std::vector<std::vector<double>> recvbufs_;   /// one buffer per message received
+  std::vector<size_t> recvtask_;                /// source task of each message received
+  std::vector<std::vector<size_t>> recvobs_;    /// observations in each message received
+  size_t nmembers_;                    /// number of ensemble members sharing this GetValues
+  size_t nfinalized_;                  /// members for which finalize was called
+  size_t nfilled_;                     /// members for which GeoVaLs were filled
   int tag_;
   const bool levelsTopDown_;            /// When true: Levels are in top down order.
   std::vector<size_t> geovarsSizes_;   /// number of levels for geovars_
@@ -167,12 +196,18 @@ GetValues<MODEL, OBS>::GetValues(const eckit::Configuration & conf, const Geomet
   : winbgn_(bgn), winend_(end), hslot_(), locations_(locs),
     geovars_(vars), varsizes_(0), linvars_(varl), linsizes_(0),
     interpConf_(conf), comm_(geom.getComm()), ntasks_(comm_.size()), interp_(ntasks_),
-    myobs_index_by_task_(ntasks_), obs_times_by_task_(ntasks_),
-    locinterp_(), recvinterp_(), send_req_(), recv_req_(), tag_(789),
+    myobs_index_by_task_(ntasks_), obs_times_by_task_(ntasks_), obs_by_time_(ntasks_),
+    sorted_times_(ntasks_), slotobs_(), tmpinterp_(),
+    locinterp_(), recvinterp_(), send_req_(), recv_req_(), streaming_(false),
+    myobs_by_time_(ntasks_), mysorted_times_(ntasks_), nsent_(ntasks_, 0), nposted_(ntasks_, 0),
+    sendbufs_(), recvbufs_(),
+    recvtask_(), recvobs_(), nmembers_(1), nfinalized_(0),
+    nfilled_(0), tag_(789),
     levelsTopDown_(geom.levelsAreTopDown()), geovarsSizes_(geom.variableSizes(geovars_))
 {
   Log::trace() << "GetValues::GetValues start" << std::endl;
-  util::Timer timer("oops::GetValues", "GetValues");
+  static const util::TimerId timerId("oops::GetValues", "GetValues");
+  util::Timer timer(timerId);
 
 // set the type of time-interpolation
   std::string value;
@@ -188,6 +223,12 @@ GetValues<MODEL, OBS>::GetValues(const eckit::Configuration & conf, const Geomet
     doLinearTimeInterpolation_ = false;
   }
 
+// Streaming: rather than sending all interpolated values at the end of the window, send the
+// values for each time slot once it has been processed. This overlaps the communications with
+// the model integration. The values are sent to and received from each task in time order,
+// which both sides know as every task processes the same time slots.
+  streaming_ = conf.getBool("stream by time slot", false);
+
   tag_ += this->created();
 
   for (size_t jj = 0; jj < geovars_.size(); ++jj) varsizes_ += geom.variableSizes(geovars_)[jj];
@@ -227,6 +268,30 @@ GetValues<MODEL, OBS>::GetValues(const eckit::Configuration & conf, const Geomet
     }
     ASSERT(mylocs_by_task[jtask].size() == ii);
     interp_[jtask] = std::make_unique<LocalInterp_>(interpConf_, geom, lats, lons);
+
+//  Sort obs by time so that each time slot only looks at its own obs
+    const std::vector<util::DateTime> & times = obs_times_by_task_[jtask];
+    obs_by_time_[jtask].resize(nobs);
+    for (size_t jobs = 0; jobs < nobs; ++jobs) obs_by_time_[jtask][jobs] = jobs;
+    std::stable_sort(obs_by_time_[jtask].begin(), obs_by_time_[jtask].end(),
+                     [&times](const size_t jj, const size_t kk) {return times[jj] < times[kk];});
+    sorted_times_[jtask].resize(nobs);
+    for (size_t jobs = 0; jobs < nobs; ++jobs) {
+      sorted_times_[jtask][jobs] = times[obs_by_time_[jtask][jobs]];
+    }
+
+//  Same ordering for the obs owned here and interpolated on jtask (the stable sort of the same
+//  times gives the same permutation on both sides, which streamed messages rely on)
+    const std::vector<size_t> & myobs = myobs_index_by_task_[jtask];
+    myobs_by_time_[jtask].resize(myobs.size());
+    for (size_t jobs = 0; jobs < myobs.size(); ++jobs) myobs_by_time_[jtask][jobs] = jobs;
+    std::stable_sort(myobs_by_time_[jtask].begin(), myobs_by_time_[jtask].end(),
+                     [&obstimes, &myobs](const size_t jj, const size_t kk)
+                       {return obstimes[myobs[jj]] < obstimes[myobs[kk]];});
+    mysorted_times_[jtask].resize(myobs.size());
+    for (size_t jobs = 0; jobs < myobs.size(); ++jobs) {
+      mysorted_times_[jtask][jobs] = obstimes[myobs[myobs_by_time_[jtask][jobs]]];
+    }
   }
 
   Log::trace() << "GetValues::GetValues done" << std::endl;
@@ -236,26 +301,45 @@ GetValues<MODEL, OBS>::GetValues(const eckit::Configuration & conf, const Geomet
 //  Forward methods (called from nonlinear run)
 // -----------------------------------------------------------------------------
 
+template <typename MODEL, typename OBS>
+void GetValues<MODEL, OBS>::setEnsembleSize(const size_t nmembers) {
+  ASSERT(nmembers > 0);
+  ASSERT(locinterp_.empty());
+  nmembers_ = nmembers;
+}
+
+// -----------------------------------------------------------------------------
+
 template <typename MODEL, typename OBS>
 void GetValues<MODEL, OBS>::initialize(const util::Duration & tstep) {
   Log::trace() << "GetValues::initialize start" << std::endl;
   const double missing = util::missingValue(double());
+  // members of an ensemble after the first one use the buffers allocated by the first
+  if (nmembers_ > 1 && !locinterp_.empty()) {
+    ASSERT(hslot_ == (doLinearTimeInterpolation_ ? tstep : tstep/2));
+    return;
+  }
   ASSERT(locinterp_.empty());
 
+  // values of all members are stored one after the other
   locinterp_.resize(ntasks_);
   for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
-    locinterp_[jtask].resize(obs_times_by_task_[jtask].size() * varsizes_, missing);
+    locinterp_[jtask].resize(nmembers_ * obs_times_by_task_[jtask].size() * varsizes_, missing);
   }
+  nfinalized_ = 0;
+  nfilled_ = 0;
   hslot_ = doLinearTimeInterpolation_ ? tstep : tstep/2;
+  if (streaming_) resetStreams();
   Log::trace() << "GetValues::initialize done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 template <typename MODEL, typename OBS>
 void GetValues<MODEL, OBS>::incInterpValues(
-                    const util::DateTime & tCurrent, const std::vector<bool> & mask,
+                    const util::DateTime & tCurrent, const std::vector<size_t> & obs,
                     const size_t & jtask,
-                    const std::vector<double> & tmplocinterp)
+                    const std::vector<double> & tmplocinterp,
+                    const size_t offset)
 {
   Log::trace() << "GetValues::incInterpValues start" << std::endl;
 
@@ -267,30 +351,28 @@ void GetValues<MODEL, OBS>::incInterpValues(
 // Compute and add time weighted contribution from the input interpolated values.
   double timeWeight = 0;
   const size_t nObs = obs_times_by_task_[jtask].size();
-  for (size_t jp = 0; jp < nObs; ++jp) {
+  for (const size_t jp : obs) {
     size_t valuesIndex = jp;
-    if (mask[jp]) {
-      const util::DateTime & obCurrentTime = obs_times_by_task_[jtask][jp];
-      const bool isCurrentTime = obCurrentTime == tCurrent;
-      const bool isFirst = obCurrentTime > tCurrent;
-      if (!isCurrentTime && isFirst) {
-        timeWeight =
-          static_cast<double>((tNext - obCurrentTime).toSeconds())/dt;
-      } else if (!isCurrentTime && !isFirst) {
-        timeWeight =
-          static_cast<double>((obCurrentTime - tPrevious).toSeconds())/dt;
-      }
-      for (size_t jf = 0; jf < geovars_.size(); ++jf) {
-        for (size_t jlev = 0; jlev < geovarsSizes_[jf]; ++jlev) {
-          if (isCurrentTime) {
-            locinterp_[jtask][valuesIndex] = tmplocinterp[valuesIndex];
-          } else if (isFirst) {
-            locinterp_[jtask][valuesIndex] = tmplocinterp[valuesIndex]*timeWeight;
-          } else {
-            locinterp_[jtask][valuesIndex] += tmplocinterp[valuesIndex]*timeWeight;
-          }
-          valuesIndex += nObs;
+    const util::DateTime & obCurrentTime = obs_times_by_task_[jtask][jp];
+    const bool isCurrentTime = obCurrentTime == tCurrent;
+    const bool isFirst = obCurrentTime > tCurrent;
+    if (!isCurrentTime && isFirst) {
+      timeWeight =
+        static_cast<double>((tNext - obCurrentTime).toSeconds())/dt;
+    } else if (!isCurrentTime && !isFirst) {
+      timeWeight =
+        static_cast<double>((obCurrentTime - tPrevious).toSeconds())/dt;
+    }
+    for (size_t jf = 0; jf < geovars_.size(); ++jf) {
+      for (size_t jlev = 0; jlev < geovarsSizes_[jf]; ++jlev) {
+        if (isCurrentTime) {
+          locinterp_[jtask][offset + valuesIndex] = tmplocinterp[valuesIndex];
+        } else if (isFirst) {
+          locinterp_[jtask][offset + valuesIndex] = tmplocinterp[valuesIndex]*timeWeight;
+        } else {
+          locinterp_[jtask][offset + valuesIndex] += tmplocinterp[valuesIndex]*timeWeight;
         }
+        valuesIndex += nObs;
       }
     }
   }
@@ -299,30 +381,59 @@ void GetValues<MODEL, OBS>::incInterpValues(
 
 // -----------------------------------------------------------------------------
 template <typename MODEL, typename OBS>
-void GetValues<MODEL, OBS>::process(const State_ & xx) {
+const std::vector<size_t> & GetValues<MODEL, OBS>::obsInSlot(const size_t jtask,
+                                                            const util::DateTime & t1,
+                                                            const util::DateTime & t2) {
+  const std::vector<util::DateTime> & times = sorted_times_[jtask];
+  const auto bgn = std::upper_bound(times.begin(), times.end(), t1);
+  const auto end = std::upper_bound(bgn, times.end(), t2);
+  const auto first = obs_by_time_[jtask].begin() + (bgn - times.begin());
+  slotobs_.assign(first, first + (end - bgn));
+  return slotobs_;
+}
+
+// -----------------------------------------------------------------------------
+template <typename MODEL, typename OBS>
+void GetValues<MODEL, OBS>::process(const State_ & xx, const size_t member) {
   Log::trace() << "GetValues::process start" << std::endl;
-  util::Timer timer("oops::GetValues", "process");
+  static const util::TimerId timerId("oops::GetValues", "process");
+  util::Timer timer(timerId);
+  ASSERT(member < nmembers_);
 
   util::DateTime t1 = std::max(xx.validTime()-hslot_, winbgn_);
   util::DateTime t2 = std::min(xx.validTime()+hslot_, winend_);
 
   for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
-//  Mask obs outside time slot
-    std::vector<bool> mask(obs_times_by_task_[jtask].size());
-    for (size_t jobs = 0; jobs < obs_times_by_task_[jtask].size(); ++jobs) {
-      mask[jobs] = obs_times_by_task_[jtask][jobs] > t1 && obs_times_by_task_[jtask][jobs] <= t2;
-    }
-
-//  Local interpolation
+//  Obs in time slot
+    const std::vector<size_t> & obs = obsInSlot(jtask, t1, t2);
+
+//  Local interpolation (only the values of the obs in the time slot are set in tmpinterp_,
+//  the buffer is reused between time steps). It is called on all tasks even without obs in
+//  the slot, as the model interpolator can communicate (e.g. halo exchanges).
+    const size_t nvals = obs_times_by_task_[jtask].size() * varsizes_;
+    tmpinterp_.resize(nvals);
     if (doLinearTimeInterpolation_) {
-      std::vector<double> tmplocinterp(locinterp_[jtask].size(), 0);
-      interp_[jtask]->apply(geovars_, xx, mask, tmplocinterp);
-      incInterpValues(xx.validTime(), mask, jtask, tmplocinterp);
+      interp_[jtask]->apply(geovars_, xx, obs, tmpinterp_);
+      incInterpValues(xx.validTime(), obs, jtask, tmpinterp_, member * nvals);
+    } else if (nmembers_ == 1) {
+      interp_[jtask]->apply(geovars_, xx, obs, locinterp_[jtask]);
     } else {
-      interp_[jtask]->apply(geovars_, xx, mask, locinterp_[jtask]);
+      // interpolate into this member's part of the buffer
+      const size_t nobs = obs_times_by_task_[jtask].size();
+      interp_[jtask]->apply(geovars_, xx, obs, tmpinterp_);
+      std::vector<double>::iterator values = locinterp_[jtask].begin() + member * nvals;
+      for (size_t jlev = 0; jlev < varsizes_; ++jlev) {
+        for (const size_t jobs : obs) values[jlev * nobs + jobs] = tmpinterp_[jlev * nobs + jobs];
+      }
     }
   }
 
+// Send values that are now complete (with linear time interpolation, obs after the current
+// time still need the next state)
+  if (streaming_ && nmembers_ == 1) {
+    sendCompleted(doLinearTimeInterpolation_ ? xx.validTime() : t2, false, varsizes_);
+  }
+
   Log::trace() << "GetValues::process done" << std::endl;
 }
 
@@ -331,7 +442,21 @@ void GetValues<MODEL, OBS>::process(const State_ & xx) {
 template <typename MODEL, typename OBS>
 void GetValues<MODEL, OBS>::finalize() {
   Log::trace() << "GetValues::finalize start" << std::endl;
-  util::Timer timer("oops::GetValues", "finalize");
+  static const util::TimerId timerId("oops::GetValues", "finalize");
+  util::Timer timer(timerId);
+
+// Wait until all members sharing this GetValues have been processed
+  if (++nfinalized_ < nmembers_) {
+    Log::trace() << "GetValues::finalize done" << std::endl;
+    return;
+  }
+
+// Send values not sent yet (e.g. for obs outside all the time slots processed)
+  if (streaming_ && nmembers_ == 1) {
+    sendCompleted(winend_, true, varsizes_);
+    Log::trace() << "GetValues::finalize done" << std::endl;
+    return;
+  }
 
 // Send values interpolated locally (non-blocking)
   send_req_.resize(ntasks_);
@@ -344,7 +469,7 @@ void GetValues<MODEL, OBS>::finalize() {
   recvinterp_.resize(ntasks_);
   recv_req_.resize(ntasks_);
   for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
-    const size_t nrecv = myobs_index_by_task_[jtask].size() * varsizes_;
+    const size_t nrecv = nmembers_ * myobs_index_by_task_[jtask].size() * varsizes_;
     recvinterp_[jtask].resize(nrecv);
     recv_req_[jtask] = comm_.iReceive(&recvinterp_[jtask][0], nrecv, jtask, tag_);
   }
@@ -355,18 +480,50 @@ void GetValues<MODEL, OBS>::finalize() {
 // -----------------------------------------------------------------------------
 
 template <typename MODEL, typename OBS>
-void GetValues<MODEL, OBS>::fillGeoVaLs(GeoVaLs_ & geovals) {
+void GetValues<MODEL, OBS>::fillGeoVaLs(GeoVaLs_ & geovals, const size_t member) {
   Log::trace() << "GetValues::fillGeoVaLs start" << std::endl;
-  util::Timer timer("oops::GetValues", "fillGeoVaLs");
+  static const util::TimerId timerId("oops::GetValues", "fillGeoVaLs");
+  util::Timer timer(timerId);
+  ASSERT(member < nmembers_);
+
+  if (streaming_ && nmembers_ == 1) {
+    receiveCompleted(geovals, varsizes_);
+    Log::trace() << "GetValues::fillGeoVaLs done" << std::endl;
+    return;
+  }
 
+  if (nmembers_ == 1) {
 // Wait for received interpolated values and store in GeoVaLs
-  ASSERT(recvinterp_.size() == ntasks_);
-  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
-    int itask = -1;
-    eckit::mpi::Status rst = comm_.waitAny(recv_req_, itask);
-    ASSERT(rst.error() == 0);
-    ASSERT(itask >=0 && (size_t)itask < ntasks_);
-    geovals.fill(myobs_index_by_task_[itask], recvinterp_[itask], this->levelsTopDown_);
+    ASSERT(recvinterp_.size() == ntasks_);
+    for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+      int itask = -1;
+      eckit::mpi::Status rst = comm_.waitAny(recv_req_, itask);
+      ASSERT(rst.error() == 0);
+      ASSERT(itask >=0 && (size_t)itask < ntasks_);
+      geovals.fill(myobs_index_by_task_[itask], recvinterp_[itask], this->levelsTopDown_);
+    }
+  } else {
+// Wait for the values of all members (on the first call), then store this member's values
+    ASSERT(nfinalized_ == nmembers_);
+    ASSERT(recvinterp_.size() == ntasks_);
+    if (nfilled_ == 0) {
+      for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+        int itask = -1;
+        eckit::mpi::Status rst = comm_.waitAny(recv_req_, itask);
+        ASSERT(rst.error() == 0);
+      }
+    }
+    for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+      const size_t nvals = myobs_index_by_task_[jtask].size() * varsizes_;
+      const std::vector<double>::const_iterator values =
+        recvinterp_[jtask].begin() + member * nvals;
+      const std::vector<double> memvals(values, values + nvals);
+      geovals.fill(myobs_index_by_task_[jtask], memvals, this->levelsTopDown_);
+    }
+    if (++nfilled_ < nmembers_) {
+      Log::trace() << "GetValues::fillGeoVaLs done" << std::endl;
+      return;
+    }
   }
   recv_req_.clear();
   recvinterp_.clear();
@@ -383,6 +540,114 @@ void GetValues<MODEL, OBS>::fillGeoVaLs(GeoVaLs_ & geovals) {
   Log::trace() << "GetValues::fillGeoVaLs done" << std::endl;
 }
 
+// -----------------------------------------------------------------------------
+//  Streaming helpers (used by the nonlinear and TL methods)
+// -----------------------------------------------------------------------------
+
+template <typename MODEL, typename OBS>
+void GetValues<MODEL, OBS>::resetStreams() {
+  ASSERT(send_req_.empty() && recv_req_.empty());
+  nsent_.assign(ntasks_, 0);
+  nposted_.assign(ntasks_, 0);
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL, typename OBS>
+void GetValues<MODEL, OBS>::sendCompleted(const util::DateTime & tlast, const bool all,
+                                          const size_t nlevs) {
+  Log::trace() << "GetValues::sendCompleted start" << std::endl;
+  static const util::TimerId timerId("oops::GetValues", "sendCompleted");
+  util::Timer timer(timerId);
+
+// Obs are taken in time order from where the previous call stopped, so each call only looks
+// at the obs it sends (times are non decreasing between calls)
+  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+//  Values interpolated here for obs owned by jtask
+    const std::vector<util::DateTime> & times = sorted_times_[jtask];
+    const size_t nobs = times.size();
+    size_t last = all ? nobs : std::upper_bound(times.begin() + nsent_[jtask], times.end(), tlast)
+                               - times.begin();
+    if (last > nsent_[jtask]) {
+      const auto first = obs_by_time_[jtask].begin() + nsent_[jtask];
+      const auto end = obs_by_time_[jtask].begin() + last;
+      std::vector<double> buf;
+      buf.reserve((last - nsent_[jtask]) * nlevs);
+      for (size_t jlev = 0; jlev < nlevs; ++jlev) {
+        const double * values = locinterp_[jtask].data() + jlev * nobs;
+        for (auto jobs = first; jobs != end; ++jobs) buf.push_back(values[*jobs]);
+      }
+      sendbufs_.push_back(std::move(buf));
+      send_req_.push_back(comm_.iSend(sendbufs_.back().data(), sendbufs_.back().size(),
+                                      jtask, tag_));
+      nsent_[jtask] = last;
+    }
+
+//  Values interpolated on jtask for obs owned here (same selection as on jtask)
+    const std::vector<util::DateTime> & mytimes = mysorted_times_[jtask];
+    last = all ? mytimes.size() : std::upper_bound(mytimes.begin() + nposted_[jtask],
+                                                   mytimes.end(), tlast) - mytimes.begin();
+    if (last > nposted_[jtask]) {
+      recvbufs_.emplace_back((last - nposted_[jtask]) * nlevs);
+      recv_req_.push_back(comm_.iReceive(recvbufs_.back().data(), recvbufs_.back().size(),
+                                         jtask, tag_));
+      recvtask_.push_back(jtask);
+      recvobs_.emplace_back(myobs_by_time_[jtask].begin() + nposted_[jtask],
+                            myobs_by_time_[jtask].begin() + last);
+      nposted_[jtask] = last;
+    }
+  }
+
+  Log::trace() << "GetValues::sendCompleted done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL, typename OBS>
+void GetValues<MODEL, OBS>::receiveCompleted(GeoVaLs_ & geovals, const size_t nlevs) {
+  Log::trace() << "GetValues::receiveCompleted start" << std::endl;
+
+// Wait for received interpolated values and unpack them by task
+  ASSERT(recvinterp_.empty());
+  recvinterp_.resize(ntasks_);
+  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+    recvinterp_[jtask].resize(myobs_index_by_task_[jtask].size() * nlevs);
+  }
+  for (size_t jmsg = 0; jmsg < recv_req_.size(); ++jmsg) {
+    int imsg = -1;
+    eckit::mpi::Status rst = comm_.waitAny(recv_req_, imsg);
+    ASSERT(rst.error() == 0);
+    ASSERT(imsg >= 0 && (size_t)imsg < recv_req_.size());
+    const std::vector<size_t> & obs = recvobs_[imsg];
+    std::vector<double> & values = recvinterp_[recvtask_[imsg]];
+    const size_t nobs = myobs_index_by_task_[recvtask_[imsg]].size();
+    size_t ii = 0;
+    for (size_t jlev = 0; jlev < nlevs; ++jlev) {
+      for (const size_t jobs : obs) values[jlev * nobs + jobs] = recvbufs_[imsg][ii++];
+    }
+  }
+  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+    geovals.fill(myobs_index_by_task_[jtask], recvinterp_[jtask], this->levelsTopDown_);
+  }
+  recv_req_.clear();
+  recvbufs_.clear();
+  recvtask_.clear();
+  recvobs_.clear();
+  recvinterp_.clear();
+
+// Clean-up send buffers (after making sure data has been sent)
+  for (size_t jmsg = 0; jmsg < send_req_.size(); ++jmsg) {
+    int imsg = -1;
+    eckit::mpi::Status sst = comm_.waitAny(send_req_, imsg);
+    ASSERT(sst.error() == 0);
+  }
+  send_req_.clear();
+  sendbufs_.clear();
+  locinterp_.clear();
+
+  Log::trace() << "GetValues::receiveCompleted done" << std::endl;
+}
+
 // -----------------------------------------------------------------------------
 //  TL methods
 // -----------------------------------------------------------------------------
@@ -397,6 +662,7 @@ void GetValues<MODEL, OBS>::initializeTL(const util::Duration & tstep) {
     locinterp_[jtask].resize(obs_times_by_task_[jtask].size() * linsizes_, missing);
   }
   hslot_ = tstep/2;
+  if (streaming_) resetStreams();
   Log::trace() << "GetValues::initializeTL done" << std::endl;
 }
 
@@ -405,22 +671,20 @@ void GetValues<MODEL, OBS>::initializeTL(const util::Duration & tstep) {
 template <typename MODEL, typename OBS>
 void GetValues<MODEL, OBS>::processTL(const Increment_ & dx) {
   Log::trace() << "GetValues::processTL start" << std::endl;
-  util::Timer timer("oops::GetValues", "processTL");
+  static const util::TimerId timerId("oops::GetValues", "processTL");
+  util::Timer timer(timerId);
 
   util::DateTime t1 = std::max(dx.validTime()-hslot_, winbgn_);
   util::DateTime t2 = std::min(dx.validTime()+hslot_, winend_);
 
   for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
-//  Mask obs outside time slot
-    std::vector<bool> mask(obs_times_by_task_[jtask].size());
-    for (size_t jobs = 0; jobs < obs_times_by_task_[jtask].size(); ++jobs) {
-      mask[jobs] = obs_times_by_task_[jtask][jobs] > t1 && obs_times_by_task_[jtask][jobs] <= t2;
-    }
-
-//  Local interpolation
-    interp_[jtask]->apply(linvars_, dx, mask, locinterp_[jtask]);
+//  Local interpolation for obs in time slot
+    const std::vector<size_t> & obs = obsInSlot(jtask, t1, t2);
+    interp_[jtask]->apply(linvars_, dx, obs, locinterp_[jtask]);
   }
 
+  if (streaming_) sendCompleted(t2, false, linsizes_);
+
   Log::trace() << "GetValues::processTL done" << std::endl;
 }
 
@@ -429,7 +693,14 @@ void GetValues<MODEL, OBS>::processTL(const Increment_ & dx) {
 template <typename MODEL, typename OBS>
 void GetValues<MODEL, OBS>::finalizeTL() {
   Log::trace() << "GetValues::finalizeTL start" << std::endl;
-  util::Timer timer("oops::GetValues", "finalizeTL");
+  static const util::TimerId timerId("oops::GetValues", "finalizeTL");
+  util::Timer timer(timerId);
+
+  if (streaming_) {
+    sendCompleted(winend_, true, linsizes_);
+    Log::trace() << "GetValues::finalizeTL done" << std::endl;
+    return;
+  }
 
 // Send values interpolated locally (non-blocking)
   send_req_.resize(ntasks_);
@@ -455,7 +726,14 @@ void GetValues<MODEL, OBS>::finalizeTL() {
 template <typename MODEL, typename OBS>
 void GetValues<MODEL, OBS>::fillGeoVaLsTL(GeoVaLs_ & geovals) {
   Log::trace() << "GetValues::fillGeoVaLsTL start" << std::endl;
-  util::Timer timer("oops::GetValues", "fillGeoVaLsTL");
+  static const util::TimerId timerId("oops::GetValues", "fillGeoVaLsTL");
+  util::Timer timer(timerId);
+
+  if (streaming_) {
+    receiveCompleted(geovals, linsizes_);
+    Log::trace() << "GetValues::fillGeoVaLsTL done" << std::endl;
+    return;
+  }
 
 // Wait for received interpolated values and store in GeoVaLs
   ASSERT(recvinterp_.size() == ntasks_);
@@ -497,20 +775,16 @@ void GetValues<MODEL, OBS>::initializeAD() {
 template <typename MODEL, typename OBS>
 void GetValues<MODEL, OBS>::processAD(Increment_ & dx) {
   Log::trace() << "GetValues::processAD start" << std::endl;
-  util::Timer timer("oops::GetValues", "processAD");
+  static const util::TimerId timerId("oops::GetValues", "processAD");
+  util::Timer timer(timerId);
 
   util::DateTime t1 = std::max(dx.validTime()-hslot_, winbgn_);
   util::DateTime t2 = std::min(dx.validTime()+hslot_, winend_);
 
   for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
-//  Mask obs outside time slot
-    std::vector<bool> mask(obs_times_by_task_[jtask].size());
-    for (size_t jobs = 0; jobs < obs_times_by_task_[jtask].size(); ++jobs) {
-      mask[jobs] = obs_times_by_task_[jtask][jobs] > t1 && obs_times_by_task_[jtask][jobs] <= t2;
-    }
-
-//  (Adjoint of) Local interpolation
-    interp_[jtask]->applyAD(linvars_, dx, mask, locinterp_[jtask]);
+//  (Adjoint of) Local interpolation for obs in time slot
+    const std::vector<size_t> & obs = obsInSlot(jtask, t1, t2);
+    interp_[jtask]->applyAD(linvars_, dx, obs, locinterp_[jtask]);
   }
 
   Log::trace() << "GetValues::processAD done" << std::endl;
@@ -521,7 +795,8 @@ void GetValues<MODEL, OBS>::processAD(Increment_ & dx) {
 template <typename MODEL, typename OBS>
 void GetValues<MODEL, OBS>::finalizeAD(const util::Duration & tstep) {
   Log::trace() << "GetValues::finalizeAD start" << std::endl;
-  util::Timer timer("oops::GetValues", "finalizeAD");
+  static const util::TimerId timerId("oops::GetValues", "finalizeAD");
+  util::Timer timer(timerId);
 
   hslot_ = tstep/2;
 
@@ -555,7 +830,8 @@ void GetValues<MODEL, OBS>::finalizeAD(const util::Duration & tstep) {
 template <typename MODEL, typename OBS>
 void GetValues<MODEL, OBS>::fillGeoVaLsAD(const GeoVaLs_ & geovals) {
   Log::trace() << "GetValues::fillGeoVaLsAD start" << std::endl;
-  util::Timer timer("oops::GetValues", "fillGeoVaLsAD");
+  static const util::TimerId timerId("oops::GetValues", "fillGeoVaLsAD");
+  util::Timer timer(timerId);
 
   const double missing = util::missingValue(double());
 
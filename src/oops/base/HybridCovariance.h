@@ -67,7 +67,8 @@ HybridCovariance<MODEL>::HybridCovariance(const Geometry_ & resol, const Variabl
   : ModelSpaceCovarianceBase<MODEL>(resol, config, xb, fg)
 {
   Log::trace() << "HybridCovariance::HybridCovariance start" << std::endl;
-  util::Timer timer("oops::Covariance", "HybridCovariance");
+  static const util::TimerId timerId("oops::Covariance", "HybridCovariance");
+  util::Timer timer(timerId);
   std::vector<eckit::LocalConfiguration> confs;
   config.get("components", confs);
   for (const auto & conf : confs) {
@@ -42,9 +42,14 @@ namespace oops {
 /// - toAtlas, atlas
 ///
 /// Adds communication through time to the following Increment methods:
-/// - dot_product_with
+/// - dot_product_with, dot_products_with, dot_products
 /// - norm
 /// - print
+///
+/// If MODEL::Increment provides local_dot_products (see interface::HasLocalDotProducts),
+/// dot_products_with and dot_products sum all the dot products over space with one reduction,
+/// followed by one reduction across time (if distributed in time); otherwise each dot product
+/// is reduced over space by the model and only the reduction across time is shared.
 
 template <typename MODEL>
 class Increment : public interface::Increment<MODEL> {
@@ -80,12 +85,27 @@ class Increment : public interface::Increment<MODEL> {
 
   /// dot product with the \p other increment
   double dot_product_with(const Increment & other) const;
+  /// dot products with each of the \p others, reduced together
+  std::vector<double> dot_products_with(const std::vector<const Increment *> & others) const;
+  /// dot products of \p lhs[i] with \p rhs[i], reduced together
+  static std::vector<double> dot_products(const std::vector<const Increment *> & lhs,
+                                          const std::vector<const Increment *> & rhs);
   /// Norm for diagnostics
   double norm() const;
+  /// Add \p w[i] * \p dx[i] to this increment for all i
+  void multi_axpy(const std::vector<double> & w, const std::vector<const Increment *> & dx);
+  /// Add the Schur products of \p dx[i] with \p w[i] to this increment for all i (the \p dx
+  /// are overwritten)
+  void schur_accumul(const std::vector<Increment *> & dx, const std::vector<const Increment *> & w);
 
  private:
   void print(std::ostream &) const override;
 
+  static std::vector<double> dotProducts(const std::vector<const Increment *> &,
+                                         const std::vector<const Increment *> &, std::true_type);
+  static std::vector<double> dotProducts(const std::vector<const Increment *> &,
+                                         const std::vector<const Increment *> &, std::false_type);
+
   const Geometry_ & resol_;
   const eckit::mpi::Comm * timeComm_;  /// pointer to the MPI communicator in time
 };
@@ -136,6 +156,87 @@ double Increment<MODEL>::dot_product_with(const Increment & dx) const {
 
 // -----------------------------------------------------------------------------
 
+template<typename MODEL>
+std::vector<double> Increment<MODEL>::dot_products_with(
+                                        const std::vector<const Increment *> & others) const {
+  if (interface::HasLocalDotProducts<typename MODEL::Increment>::value) {
+    const std::vector<const Increment *> lhs(others.size(), this);
+    return dot_products(lhs, others);
+  }
+  const std::vector<const interface::Increment<MODEL> *> incs(others.begin(), others.end());
+  std::vector<double> zz = interface::Increment<MODEL>::dot_products_with(incs);
+  timeComm_->allReduceInPlace(zz.begin(), zz.end(), eckit::mpi::Operation::SUM);
+  return zz;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void Increment<MODEL>::multi_axpy(const std::vector<double> & ww,
+                                  const std::vector<const Increment *> & dx) {
+  const std::vector<const interface::Increment<MODEL> *> incs(dx.begin(), dx.end());
+  interface::Increment<MODEL>::multi_axpy(ww, incs);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void Increment<MODEL>::schur_accumul(const std::vector<Increment *> & dx,
+                                     const std::vector<const Increment *> & ww) {
+  const std::vector<interface::Increment<MODEL> *> incs(dx.begin(), dx.end());
+  const std::vector<const interface::Increment<MODEL> *> wgts(ww.begin(), ww.end());
+  interface::Increment<MODEL>::schur_accumul(incs, wgts);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+std::vector<double> Increment<MODEL>::dot_products(const std::vector<const Increment *> & lhs,
+                                                   const std::vector<const Increment *> & rhs) {
+  ASSERT(lhs.size() == rhs.size());
+  if (lhs.empty()) return std::vector<double>();
+  for (size_t jj = 0; jj < lhs.size(); ++jj) {
+    ASSERT(lhs[jj]->timeComm_ == lhs[0]->timeComm_);
+  }
+  std::vector<double> zz = dotProducts(lhs, rhs,
+                                       interface::HasLocalDotProducts<typename MODEL::Increment>());
+  if (lhs[0]->timeComm_->size() > 1) {
+    lhs[0]->timeComm_->allReduceInPlace(zz.begin(), zz.end(), eckit::mpi::Operation::SUM);
+  }
+  return zz;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+std::vector<double> Increment<MODEL>::dotProducts(const std::vector<const Increment *> & lhs,
+                                                  const std::vector<const Increment *> & rhs,
+                                                  std::true_type) {
+  // Local contributions from the model, summed over space with one reduction
+  const std::vector<const interface::Increment<MODEL> *> lhsinc(lhs.begin(), lhs.end());
+  const std::vector<const interface::Increment<MODEL> *> rhsinc(rhs.begin(), rhs.end());
+  std::vector<double> zz = interface::Increment<MODEL>::local_dot_products(lhsinc, rhsinc);
+  lhs[0]->geometry().getComm().allReduceInPlace(zz.begin(), zz.end(),
+                                                eckit::mpi::Operation::SUM);
+  return zz;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+std::vector<double> Increment<MODEL>::dotProducts(const std::vector<const Increment *> & lhs,
+                                                  const std::vector<const Increment *> & rhs,
+                                                  std::false_type) {
+  // The model reduces each dot product over space
+  std::vector<double> zz(lhs.size());
+  for (size_t jj = 0; jj < lhs.size(); ++jj) {
+    zz[jj] = lhs[jj]->interface::Increment<MODEL>::dot_product_with(*rhs[jj]);
+  }
+  return zz;
+}
+
+// -----------------------------------------------------------------------------
+
 template<typename MODEL>
 double Increment<MODEL>::norm() const {
   double zz = interface::Increment<MODEL>::norm();
@@ -260,7 +361,8 @@ void Increment<MODEL>::print(std::ostream & os) const {
 template <typename MODEL>
 State<MODEL> & operator+=(State<MODEL> & xx, const Increment<MODEL> & dx) {
   Log::trace() << "operator+=(State, Increment) starting" << std::endl;
-  util::Timer timer("oops::Increment", "operator+=(State, Increment)");
+  static const util::TimerId timerId("oops::Increment", "operator+=(State, Increment)");
+  util::Timer timer(timerId);
   xx.state() += dx.increment();
   Log::trace() << "operator+=(State, Increment) done" << std::endl;
   return xx;
@@ -16,6 +16,8 @@
 #include <string>
 #include <vector>
 
+#include "eckit/exception/Exceptions.h"
+
 #include "oops/base/Geometry.h"
 #include "oops/base/Increment4D.h"
 #include "oops/base/LocalIncrement.h"
@@ -54,9 +56,24 @@ template<typename MODEL> class IncrementEnsemble4D {
   Increment4D_ & operator[](const size_t ii) {return ensemblePerturbs_[ii];}
   const Increment4D_ & operator[](const size_t ii) const {return ensemblePerturbs_[ii];}
 
+  /// Drop the ATLAS fieldsets cached by the members (setEigen can then be called from several
+  /// threads for distinct grid points)
+  void dropFieldSets();
+
   /// Eigen interface
-  void packEigen(Eigen::MatrixXd &, const GeometryIterator_ &, const size_t &) const;
-  void setEigen(const Eigen::MatrixXd &, const GeometryIterator_ &, const size_t &);
+  /// These call the MODEL::Increment getLocal/setLocal directly, without trace or timer, as
+  /// they are called from the threads of the local ensemble solvers.
+  /// pack/unpack the ensemble at grid point \p gi and time \p itime into/from \p X
+  /// (one row per value at the grid point, one column per member)
+  void packEigen(Eigen::MatrixXd & X, const GeometryIterator_ & gi, const size_t & itime) const;
+  void setEigen(const Eigen::MatrixXd & X, const GeometryIterator_ & gi, const size_t & itime);
+  /// pack/unpack the ensemble for a tile of grid points: values at consecutive points are
+  /// stacked in consecutive rows of \p X (one column per member). \p X is only reallocated
+  /// when its size changes, so the same buffer can be reused for all tiles.
+  void packEigen(Eigen::MatrixXd & X, const std::vector<GeometryIterator_> & tile,
+                 const size_t & itime) const;
+  void setEigen(const Eigen::MatrixXd & X, const std::vector<GeometryIterator_> & tile,
+                const size_t & itime);
 
  private:
   std::vector<Increment4D_> ensemblePerturbs_;
@@ -95,20 +112,29 @@ IncrementEnsemble4D<MODEL>::IncrementEnsemble4D(const StateEnsemble4D_ & ensembl
 
 // -----------------------------------------------------------------------------
 
+template<typename MODEL>
+void IncrementEnsemble4D<MODEL>::dropFieldSets() {
+  // the non-const accessor to the model increment drops the fieldset
+  for (Increment4D_ & incr : ensemblePerturbs_) {
+    for (size_t itime = 0; itime < incr.size(); ++itime) incr[itime].increment();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 template<typename MODEL>
 void IncrementEnsemble4D<MODEL>::packEigen(Eigen::MatrixXd & X,
                                          const GeometryIterator_ & gi,
                                          const size_t & itime) const
 {
-  size_t ngp = ensemblePerturbs_[0][itime].getLocal(gi).getVals().size();
-  size_t nens = ensemblePerturbs_.size();
-  X.resize(ngp, nens);
+  const size_t nens = ensemblePerturbs_.size();
   for (size_t iens=0; iens < nens; ++iens) {
-    LocalIncrement gp = ensemblePerturbs_[iens][itime].getLocal(gi);
-    std::vector<double> tmp1 = gp.getVals();
-    for (size_t iv=0; iv < ngp; ++iv) {
-      X(iv, iens) = tmp1[iv];
-    }
+    const LocalIncrement gp =
+      ensemblePerturbs_[iens][itime].increment().getLocal(gi.geometryiter());
+    const std::vector<double> & vals = gp.getVals();
+    if (iens == 0) X.resize(vals.size(), nens);
+    ASSERT(vals.size() == static_cast<size_t>(X.rows()));
+    X.col(iens) = Eigen::Map<const Eigen::VectorXd>(vals.data(), vals.size());
   }
 }
 
@@ -119,19 +145,82 @@ void IncrementEnsemble4D<MODEL>::setEigen(const Eigen::MatrixXd & X,
                                         const GeometryIterator_ & gi,
                                         const size_t & itime)
 {
-  size_t ngp = ensemblePerturbs_[0][itime].getLocal(gi).getVals().size();
-  size_t nens = ensemblePerturbs_.size();
+  const size_t nens = ensemblePerturbs_.size();
+  ASSERT(static_cast<size_t>(X.cols()) == nens);
 
-  LocalIncrement gptmp = ensemblePerturbs_[0][itime].getLocal(gi);
-  std::vector<double> tmp = gptmp.getVals();
+  // local increment of the first member provides the variables and levels
+  LocalIncrement gptmp = ensemblePerturbs_[0][itime].increment().getLocal(gi.geometryiter());
+  ASSERT(gptmp.getVals().size() == static_cast<size_t>(X.rows()));
 
   for (size_t iens=0; iens < nens; ++iens) {
-    for (size_t iv=0; iv < ngp; ++iv) {
-      tmp[iv] = X(iv, iens);
+    gptmp.setVals(X.col(iens).data());
+    ensemblePerturbs_[iens][itime].increment().setLocal(gptmp, gi.geometryiter());
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void IncrementEnsemble4D<MODEL>::packEigen(Eigen::MatrixXd & X,
+                                         const std::vector<GeometryIterator_> & tile,
+                                         const size_t & itime) const
+{
+  const size_t nens = ensemblePerturbs_.size();
+
+  // local increments of the first member give the number of rows for each point
+  std::vector<LocalIncrement> gps;
+  gps.reserve(tile.size());
+  size_t nrows = 0;
+  for (const GeometryIterator_ & gi : tile) {
+    gps.push_back(ensemblePerturbs_[0][itime].increment().getLocal(gi.geometryiter()));
+    nrows += gps.back().getVals().size();
+  }
+  X.resize(nrows, nens);
+
+  size_t row = 0;
+  for (const LocalIncrement & gp : gps) {
+    const std::vector<double> & vals = gp.getVals();
+    X.block(row, 0, vals.size(), 1) = Eigen::Map<const Eigen::VectorXd>(vals.data(), vals.size());
+    row += vals.size();
+  }
+  for (size_t iens=1; iens < nens; ++iens) {
+    row = 0;
+    for (size_t jj=0; jj < tile.size(); ++jj) {
+      const LocalIncrement gp =
+        ensemblePerturbs_[iens][itime].increment().getLocal(tile[jj].geometryiter());
+      const std::vector<double> & vals = gp.getVals();
+      ASSERT(vals.size() == gps[jj].getVals().size());
+      X.block(row, iens, vals.size(), 1) =
+        Eigen::Map<const Eigen::VectorXd>(vals.data(), vals.size());
+      row += vals.size();
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void IncrementEnsemble4D<MODEL>::setEigen(const Eigen::MatrixXd & X,
+                                        const std::vector<GeometryIterator_> & tile,
+                                        const size_t & itime)
+{
+  const size_t nens = ensemblePerturbs_.size();
+  ASSERT(static_cast<size_t>(X.cols()) == nens);
+
+  size_t row = 0;
+  for (const GeometryIterator_ & gi : tile) {
+    // local increment of the first member provides the variables and levels
+    LocalIncrement gptmp = ensemblePerturbs_[0][itime].increment().getLocal(gi.geometryiter());
+    const size_t ngp = gptmp.getVals().size();
+    ASSERT(row + ngp <= static_cast<size_t>(X.rows()));
+    for (size_t iens=0; iens < nens; ++iens) {
+      // X is column-major: values of a member at one point are contiguous
+      gptmp.setVals(&X(row, iens));
+      ensemblePerturbs_[iens][itime].increment().setLocal(gptmp, gi.geometryiter());
     }
-    gptmp.setVals(tmp);
-    ensemblePerturbs_[iens][itime].setLocal(gptmp, gi);
+    row += ngp;
   }
+  ASSERT(row == static_cast<size_t>(X.rows()));
 }
 
 }  // namespace oops
@@ -116,7 +116,8 @@ LinearModel<MODEL>::LinearModel(const Geometry_ & resol, const LinearModelParame
   : linearmodel_()
 {
   Log::trace() << "LinearModel<MODEL>::LinearModel starting" << std::endl;
-  util::Timer timer(classname(), "LinearModel");
+  static const util::TimerId timerId(classname(), "LinearModel");
+  util::Timer timer(timerId);
   Log::info() << "LinearModel configuration is:" << params << std::endl;
   linearmodel_.reset(LinearModelFactory<MODEL>::create(resol, params));
   Log::trace() << "LinearModel<MODEL>::LinearModel done" << std::endl;
@@ -135,7 +136,8 @@ LinearModel<MODEL>::LinearModel(const Geometry_ & resol, const eckit::Configurat
 template<typename MODEL>
 LinearModel<MODEL>::~LinearModel() {
   Log::trace() << "LinearModel<MODEL>::~LinearModel starting" << std::endl;
-  util::Timer timer(classname(), "~LinearModel");
+  static const util::TimerId timerId(classname(), "~LinearModel");
+  util::Timer timer(timerId);
   linearmodel_.reset();
   Log::trace() << "LinearModel<MODEL>::~LinearModel done" << std::endl;
 }
@@ -225,7 +227,8 @@ void LinearModel<MODEL>::forecastAD(Increment_ & dx, ModelAuxInc_ & maux,
 template<typename MODEL>
 void LinearModel<MODEL>::initializeTL(Increment_ & dx) const {
   Log::trace() << "LinearModel<MODEL>::initializeTL starting" << std::endl;
-  util::Timer timer(classname(), "initializeTL");
+  static const util::TimerId timerId(classname(), "initializeTL");
+  util::Timer timer(timerId);
   linearmodel_->initializeTL(dx);
   Log::trace() << "LinearModel<MODEL>::initializeTL done" << std::endl;
 }
@@ -235,7 +238,8 @@ void LinearModel<MODEL>::initializeTL(Increment_ & dx) const {
 template<typename MODEL>
 void LinearModel<MODEL>::stepTL(Increment_ & dx, const ModelAuxInc_ & maux) const {
   Log::trace() << "LinearModel<MODEL>::stepTL starting" << std::endl;
-  util::Timer timer(classname(), "stepTL");
+  static const util::TimerId timerId(classname(), "stepTL");
+  util::Timer timer(timerId);
   linearmodel_->stepTL(dx, maux);
   Log::trace() << "LinearModel<MODEL>::stepTL done" << std::endl;
 }
@@ -245,7 +249,8 @@ void LinearModel<MODEL>::stepTL(Increment_ & dx, const ModelAuxInc_ & maux) cons
 template<typename MODEL>
 void LinearModel<MODEL>::finalizeTL(Increment_ & dx) const {
   Log::trace() << "LinearModel<MODEL>::finalizeTL starting" << std::endl;
-  util::Timer timer(classname(), "finalizeTL");
+  static const util::TimerId timerId(classname(), "finalizeTL");
+  util::Timer timer(timerId);
   linearmodel_->finalizeTL(dx);
   Log::trace() << "LinearModel<MODEL>::finalizeTL done" << std::endl;
 }
@@ -255,7 +260,8 @@ void LinearModel<MODEL>::finalizeTL(Increment_ & dx) const {
 template<typename MODEL>
 void LinearModel<MODEL>::initializeAD(Increment_ & dx) const {
   Log::trace() << "LinearModel<MODEL>::initializeAD starting" << std::endl;
-  util::Timer timer(classname(), "initializeAD");
+  static const util::TimerId timerId(classname(), "initializeAD");
+  util::Timer timer(timerId);
   linearmodel_->initializeAD(dx);
   Log::trace() << "LinearModel<MODEL>::initializeAD done" << std::endl;
 }
@@ -265,7 +271,8 @@ void LinearModel<MODEL>::initializeAD(Increment_ & dx) const {
 template<typename MODEL>
 void LinearModel<MODEL>::stepAD(Increment_ & dx, ModelAuxInc_ & maux) const {
   Log::trace() << "LinearModel<MODEL>::stepAD starting" << std::endl;
-  util::Timer timer(classname(), "stepAD");
+  static const util::TimerId timerId(classname(), "stepAD");
+  util::Timer timer(timerId);
   linearmodel_->stepAD(dx, maux);
   Log::trace() << "LinearModel<MODEL>::stepAD done" << std::endl;
 }
@@ -275,7 +282,8 @@ void LinearModel<MODEL>::stepAD(Increment_ & dx, ModelAuxInc_ & maux) const {
 template<typename MODEL>
 void LinearModel<MODEL>::finalizeAD(Increment_ & dx) const {
   Log::trace() << "LinearModel<MODEL>::finalizeAD starting" << std::endl;
-  util::Timer timer(classname(), "finalizeAD");
+  static const util::TimerId timerId(classname(), "finalizeAD");
+  util::Timer timer(timerId);
   linearmodel_->finalizeAD(dx);
   Log::trace() << "LinearModel<MODEL>::finalizeAD done" << std::endl;
 }
@@ -285,7 +293,8 @@ void LinearModel<MODEL>::finalizeAD(Increment_ & dx) const {
 template<typename MODEL>
 void LinearModel<MODEL>::print(std::ostream & os) const {
   Log::trace() << "LinearModel<MODEL>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *linearmodel_;
   Log::trace() << "LinearModel<MODEL>::print done" << std::endl;
 }
@@ -296,7 +305,8 @@ template<typename MODEL>
 void LinearModel<MODEL>::setTrajectory(const State_ & xx, State_ & xtraj,
                                        const ModelAuxCtl_ & maux) {
   Log::trace() << "LinearModel<MODEL>::setTrajectory starting" << std::endl;
-  util::Timer timer(classname(), "setTrajectory");
+  static const util::TimerId timerId(classname(), "setTrajectory");
+  util::Timer timer(timerId);
   linearmodel_->setTrajectory(xx, xtraj, maux);
   Log::trace() << "LinearModel<MODEL>::setTrajectory done" << std::endl;
 }
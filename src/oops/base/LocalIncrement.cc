@@ -7,6 +7,8 @@
 
 #include "oops/base/LocalIncrement.h"
 
+#include <algorithm>
+
 #include "eckit/exception/Exceptions.h"
 
 namespace oops {
@@ -24,4 +26,8 @@ namespace oops {
     vals_ = valsIn;
   }
 
+  void LocalIncrement::setVals(const double * valsIn) {
+    std::copy(valsIn, valsIn + vals_.size(), vals_.begin());
+  }
+
 }  // namespace oops
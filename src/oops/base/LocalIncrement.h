@@ -26,6 +26,8 @@ class LocalIncrement: public util::Printable {
   const oops::Variables & getVars() const {return vars_;}
   const std::vector<double> & getVals() const {return vals_;}
   void setVals(std::vector<double> &);
+  /// copies getVals().size() values from contiguous memory starting at \p valsIn
+  void setVals(const double * valsIn);
 
   /// Linear algebra operators
   LocalIncrement & operator*=(const std::vector<double> &);
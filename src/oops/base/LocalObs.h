@@ -0,0 +1,49 @@
+/*
+ * (C) Copyright 2023 UCAR.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#ifndef OOPS_BASE_LOCALOBS_H_
+#define OOPS_BASE_LOCALOBS_H_
+
+#include <vector>
+
+namespace oops {
+
+/// \brief Observations of one obs space that are local to a model grid point.
+/// \details Holds the indices of the local observations in the ObsVector (in ascending
+/// order, i.e. in the order used by ObsVector::packEigen) and their localization values.
+class LocalObs {
+ public:
+  size_t size() const {return indices.size();}
+  void clear() {indices.clear(); values.clear();}
+
+  bool operator==(const LocalObs & other) const {
+    return indices == other.indices && values == other.values;
+  }
+
+  /// keep only observations that are also in \p other, multiplying localization values
+  void intersect(const LocalObs & other) {
+    size_t nlocal = 0;
+    size_t jj = 0;
+    for (size_t ii = 0; ii < indices.size(); ++ii) {
+      while (jj < other.indices.size() && other.indices[jj] < indices[ii]) ++jj;
+      if (jj < other.indices.size() && other.indices[jj] == indices[ii]) {
+        indices[nlocal] = indices[ii];
+        values[nlocal] = values[ii] * other.values[jj];
+        ++nlocal;
+      }
+    }
+    indices.resize(nlocal);
+    values.resize(nlocal);
+  }
+
+  std::vector<size_t> indices;  // indices of local observations
+  std::vector<double> values;   // localization values for the local observations
+};
+
+}  // namespace oops
+
+#endif  // OOPS_BASE_LOCALOBS_H_
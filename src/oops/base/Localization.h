@@ -12,8 +12,10 @@
 #ifndef OOPS_BASE_LOCALIZATION_H_
 #define OOPS_BASE_LOCALIZATION_H_
 
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <boost/noncopyable.hpp>
 
@@ -64,13 +66,30 @@ class Localization : public util::Printable,
   /// (and defined by 3D localization loc_)
   virtual void multiply(Increment_ & dx) const;
 
+  /// Same as randomize() for each of \p dxs, in one call to the 3D localization
+  void randomize(const std::vector<Increment_ *> & dxs) const;
+  /// Same as multiply() for each of \p dxs, in one call to the 3D localization
+  void multiply(const std::vector<Increment_ *> & dxs) const;
+
  private:
   /// Print, used in logging
   void print(std::ostream &) const override;
+  void randomize4D(const std::vector<Increment_ *> &) const;
+  void multiply4D(const std::vector<Increment_ *> &) const;
+  /// Serialize increments into buffer_ (zeroes them), copy one increment back into buffer_,
+  /// or deserialize one increment from buffer_
+  void pack(const std::vector<Increment_ *> &) const;
+  void repack(const Increment_ &, const size_t) const;
+  void unpack(Increment_ &, const size_t) const;
 
   std::unique_ptr<util::Timer> timeConstr_;
   /// Pointer to the Localization implementation
   std::unique_ptr<LocBase_> loc_;
+  // Serialization buffers, reused between calls
+  mutable std::vector<double> buffer_;   // increments (less their zero) summed over timeslots
+  mutable std::vector<double> zeros_;    // serialized zero increments
+  mutable std::vector<size_t> offsets_;  // start of each increment in buffer_ and zeros_
+  mutable std::vector<double> work_;
 };
 
 // -----------------------------------------------------------------------------
@@ -80,7 +99,8 @@ Localization<MODEL>::Localization(const Geometry_ & geometry,
                                   const oops::Variables & incVars,
                                   const eckit::Configuration & conf)
   : timeConstr_(new util::Timer(classname(), "Localization")),
-    loc_(LocalizationFactory<MODEL>::create(geometry, incVars, conf))
+    loc_(LocalizationFactory<MODEL>::create(geometry, incVars, conf)),
+    buffer_(), zeros_(), offsets_(), work_()
 {
   Log::trace() << "Localization<MODEL>::Localization done" << std::endl;
   timeConstr_.reset();
@@ -91,7 +111,8 @@ Localization<MODEL>::Localization(const Geometry_ & geometry,
 template<typename MODEL>
 Localization<MODEL>::~Localization() {
   Log::trace() << "Localization<MODEL>::~Localization starting" << std::endl;
-  util::Timer timer(classname(), "~Localization");
+  static const util::TimerId timerId(classname(), "~Localization");
+  util::Timer timer(timerId);
   loc_.reset();
   Log::trace() << "Localization<MODEL>::~Localization done" << std::endl;
 }
@@ -101,27 +122,9 @@ Localization<MODEL>::~Localization() {
 template <typename MODEL>
 void Localization<MODEL>::randomize(Increment_ & dx) const {
   Log::trace() << "Localization<MODEL>::randomize starting" << std::endl;
-  util::Timer timer(classname(), "randomize");
-  const eckit::mpi::Comm & comm = dx.timeComm();
-  static int tag = 23456;
-  size_t nslots = comm.size();
-  int mytime = comm.rank();
-
-  if (mytime > 0) {
-    util::DateTime dt = dx.validTime();   // Save original time value
-    dx.zero();
-    oops::mpi::receive(comm, dx, 0, tag);
-    dx.updateTime(dt - dx.validTime());  // Set time back to original value
-  } else {
-    // Apply 3D localization
-    loc_->randomize(dx);
-
-    // Copy result to all timeslots
-    for (size_t jj = 1; jj < nslots; ++jj) {
-      oops::mpi::send(comm, dx, jj, tag);
-    }
-  }
-  ++tag;
+  static const util::TimerId timerId(classname(), "randomize");
+  util::Timer timer(timerId);
+  this->randomize4D({&dx});
   Log::trace() << "Localization<MODEL>::randomize done" << std::endl;
 }
 
@@ -130,11 +133,62 @@ void Localization<MODEL>::randomize(Increment_ & dx) const {
 template <typename MODEL>
 void Localization<MODEL>::multiply(Increment_ & dx) const {
   Log::trace() << "Localization<MODEL>::multiply starting" << std::endl;
-  util::Timer timer(classname(), "multiply");
-  const eckit::mpi::Comm & comm = dx.timeComm();
-  static int tag = 23456;
-  size_t nslots = comm.size();
-  int mytime = comm.rank();
+  static const util::TimerId timerId(classname(), "multiply");
+  util::Timer timer(timerId);
+  this->multiply4D({&dx});
+  Log::trace() << "Localization<MODEL>::multiply done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL>
+void Localization<MODEL>::randomize(const std::vector<Increment_ *> & dxs) const {
+  Log::trace() << "Localization<MODEL>::randomize starting" << std::endl;
+  static const util::TimerId timerId(classname(), "randomize");
+  util::Timer timer(timerId);
+  if (!dxs.empty()) this->randomize4D(dxs);
+  Log::trace() << "Localization<MODEL>::randomize done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL>
+void Localization<MODEL>::multiply(const std::vector<Increment_ *> & dxs) const {
+  Log::trace() << "Localization<MODEL>::multiply starting" << std::endl;
+  static const util::TimerId timerId(classname(), "multiply");
+  util::Timer timer(timerId);
+  if (!dxs.empty()) this->multiply4D(dxs);
+  Log::trace() << "Localization<MODEL>::multiply done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL>
+void Localization<MODEL>::randomize4D(const std::vector<Increment_ *> & dxs) const {
+  const eckit::mpi::Comm & comm = dxs[0]->timeComm();
+  if (comm.size() == 1) {
+    loc_->randomizeBatch(dxs);
+    return;
+  }
+
+  // Apply 3D localization on the first timeslot and copy the results to all timeslots
+  if (comm.rank() == 0) loc_->randomizeBatch(dxs);
+  this->pack(dxs);
+  comm.broadcast(buffer_.begin(), buffer_.end(), 0);
+  for (size_t jj = 0; jj < dxs.size(); ++jj) this->unpack(*dxs[jj], jj);
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL>
+void Localization<MODEL>::multiply4D(const std::vector<Increment_ *> & dxs) const {
+  const eckit::mpi::Comm & comm = dxs[0]->timeComm();
+  const size_t nslots = comm.size();
+  const size_t mytime = comm.rank();
+  if (nslots == 1) {
+    loc_->multiplyBatch(dxs);
+    return;
+  }
 
   // Use Mark Buehner's trick to save CPU when applying the same 3D localization for all
   // 3D blocks of the 4D localization matrix:
@@ -150,31 +204,72 @@ void Localization<MODEL>::multiply(Increment_ & dx) const {
   //             (Id)                 (x_2)   (Id)                      (L_3D ( x_1 + x_2 + x_3 ))
   //             (Id)                 (x_3)   (Id)                      (L_3D ( x_1 + x_2 + x_3 ))
   // Reference in section 3.4.2. of https://rmets.onlinelibrary.wiley.com/doi/full/10.1002/qj.2325.
-  if (mytime > 0) {
-    util::DateTime dt = dx.validTime();   // Save original time value
-    oops::mpi::send(comm, dx, 0, tag);
-    dx.zero();
-    oops::mpi::receive(comm, dx, 0, tag);
-    dx.updateTime(dt - dx.validTime());  // Set time back to original value
+  // The sum over timeslots and the copy of the result are collective operations. With several
+  // increments, the 3D localization of increment jj is applied on timeslot jj % nslots.
+  this->pack(dxs);
+  if (dxs.size() == 1) {
+    comm.reduceInPlace(buffer_.begin(), buffer_.end(), eckit::mpi::Operation::SUM, 0);
+    if (mytime == 0) {
+      this->unpack(*dxs[0], 0);
+      loc_->multiplyBatch(dxs);
+      this->repack(*dxs[0], 0);
+    }
+    comm.broadcast(buffer_.begin(), buffer_.end(), 0);
   } else {
-    // Sum over timeslots
-    for (size_t jj = 1; jj < nslots; ++jj) {
-      Increment_ dxtmp(dx);
-      oops::mpi::receive(comm, dxtmp, jj, tag);
-      dx.axpy(1.0, dxtmp, false);
+    comm.allReduceInPlace(buffer_.begin(), buffer_.end(), eckit::mpi::Operation::SUM);
+    std::vector<Increment_ *> mine;
+    for (size_t jj = mytime; jj < dxs.size(); jj += nslots) {
+      this->unpack(*dxs[jj], jj);
+      mine.push_back(dxs[jj]);
     }
+    if (!mine.empty()) loc_->multiplyBatch(mine);
+    std::fill(buffer_.begin(), buffer_.end(), 0.0);
+    for (size_t jj = mytime; jj < dxs.size(); jj += nslots) this->repack(*dxs[jj], jj);
+    comm.allReduceInPlace(buffer_.begin(), buffer_.end(), eckit::mpi::Operation::SUM);
+  }
+  for (size_t jj = 0; jj < dxs.size(); ++jj) this->unpack(*dxs[jj], jj);
+}
 
-    // Apply 3D localization
-    loc_->multiply(dx);
+// -----------------------------------------------------------------------------
 
-    // Copy result to all timeslots
-    for (size_t jj = 1; jj < nslots; ++jj) {
-      oops::mpi::send(comm, dx, jj, tag);
-    }
+template <typename MODEL>
+void Localization<MODEL>::pack(const std::vector<Increment_ *> & dxs) const {
+  // Serialized increments also hold data that must not be summed over timeslots (e.g. the
+  // valid time): the serialized zero increment is subtracted here and added back in unpack.
+  buffer_.clear();
+  zeros_.clear();
+  offsets_.resize(dxs.size());
+  for (size_t jj = 0; jj < dxs.size(); ++jj) {
+    offsets_[jj] = buffer_.size();
+    dxs[jj]->serialize(buffer_);
+    dxs[jj]->zero();
+    dxs[jj]->serialize(zeros_);
   }
-  ++tag;
+  ASSERT(zeros_.size() == buffer_.size());
+  for (size_t ii = 0; ii < buffer_.size(); ++ii) buffer_[ii] -= zeros_[ii];
+}
 
-  Log::trace() << "Localization<MODEL>::multiply done" << std::endl;
+// -----------------------------------------------------------------------------
+
+template <typename MODEL>
+void Localization<MODEL>::repack(const Increment_ & dx, const size_t jj) const {
+  work_.clear();
+  dx.serialize(work_);
+  const size_t ibgn = offsets_[jj];
+  for (size_t ii = 0; ii < work_.size(); ++ii) buffer_[ibgn + ii] = work_[ii] - zeros_[ibgn + ii];
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL>
+void Localization<MODEL>::unpack(Increment_ & dx, const size_t jj) const {
+  const size_t ibgn = offsets_[jj];
+  const size_t iend = (jj + 1 < offsets_.size()) ? offsets_[jj + 1] : buffer_.size();
+  work_.resize(iend - ibgn);
+  for (size_t ii = ibgn; ii < iend; ++ii) work_[ii - ibgn] = zeros_[ii] + buffer_[ii];
+  size_t index = 0;
+  dx.deserialize(work_, index);
+  ASSERT(index == work_.size());
 }
 
 // -----------------------------------------------------------------------------
@@ -182,7 +277,8 @@ void Localization<MODEL>::multiply(Increment_ & dx) const {
 template <typename MODEL>
 void Localization<MODEL>::print(std::ostream & os) const {
   Log::trace() << "Localization<MODEL>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *loc_;
   Log::trace() << "Localization<MODEL>::print done" << std::endl;
 }
@@ -9,9 +9,11 @@
 #ifndef OOPS_BASE_MODEL_H_
 #define OOPS_BASE_MODEL_H_
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <boost/noncopyable.hpp>
 
@@ -61,6 +63,14 @@ class Model : public util::Printable,
   /// Does not need to be implemented in the models
   void forecast(State_ & xx, const ModelAux_ &,
                 const util::Duration & len, PostProcessor<State_> & post) const;
+  /// \brief Run the forecasts from all states \p xx (valid at the same time) for \p len time,
+  /// with \p post[jm] postprocessors for \p xx[jm]. All states are stepped together and the
+  /// steps of the states are distributed over \p nthreads OpenMP threads (MODEL::step must be
+  /// safe to call concurrently for distinct states). Models implementing a batched step
+  /// step one contiguous batch of states per thread. The postprocessors are called serially
+  /// after each step of all the states.
+  void forecast(const std::vector<State_ *> & xx, const ModelAux_ &, const util::Duration & len,
+                std::vector<PostProcessor<State_>> & post, const int nthreads = 1) const;
 
   /// \brief Time step for running Model's forecast in oops (frequency with which the
   /// State will be updated)
@@ -73,6 +83,8 @@ class Model : public util::Printable,
   void initialize(State_ &) const;
   /// \brief Forecast "step", called during forecast run; updates state to the next time
   void step(State_ &, const ModelAux_ &) const;
+  /// \brief Forecast "step" of several states valid at the same time
+  void stepBatch(const std::vector<State_ *> &, const ModelAux_ &) const;
   /// \brief Forecast finalization; called after each forecast run
   void finalize(State_ &) const;
   /// \brief Print, used in logging
@@ -89,7 +101,8 @@ Model<MODEL>::Model(const Geometry_ & resol, const ModelParametersBase & params)
   : model_()
 {
   Log::trace() << "Model<MODEL>::Model starting" << std::endl;
-  util::Timer timer(classname(), "Model");
+  static const util::TimerId timerId(classname(), "Model");
+  util::Timer timer(timerId);
   Log::info() << "Model configuration is:" << params << std::endl;
   model_.reset(ModelFactory<MODEL>::create(resol, params));
   Log::trace() << "Model<MODEL>::Model done" << std::endl;
@@ -116,7 +129,8 @@ Model<MODEL>::Model(std::unique_ptr<ModelBase_> model)
 template<typename MODEL>
 Model<MODEL>::~Model() {
   Log::trace() << "Model<MODEL>::~Model starting" << std::endl;
-  util::Timer timer(classname(), "~Model");
+  static const util::TimerId timerId(classname(), "~Model");
+  util::Timer timer(timerId);
   model_.reset();
   Log::trace() << "Model<MODEL>::~Model done" << std::endl;
 }
@@ -148,10 +162,80 @@ void Model<MODEL>::forecast(State_ & xx, const ModelAux_ & maux,
 
 // -----------------------------------------------------------------------------
 
+template<typename MODEL>
+void Model<MODEL>::forecast(const std::vector<State_ *> & xx, const ModelAux_ & maux,
+                            const util::Duration & len,
+                            std::vector<PostProcessor<State_>> & post,
+                            const int nthreads) const {
+  Log::trace() << "Model<MODEL>::forecast starting" << std::endl;
+  ASSERT(post.size() == xx.size());
+  if (xx.empty()) return;
+
+  const util::DateTime end(xx[0]->validTime() + len);
+  const int nmembers = xx.size();
+  Log::info() << "Model:forecast: " << nmembers << " forecasts starting from "
+              << xx[0]->validTime() << std::endl;
+  for (int jm = 0; jm < nmembers; ++jm) {
+    ASSERT(xx[jm]->validTime() + len == end);
+    this->initialize(*xx[jm]);
+    post[jm].initialize(*xx[jm], end, model_->timeResolution());
+    post[jm].process(*xx[jm]);
+  }
+  if (model_->hasStepBatch()) {
+//  Contiguous batches of states, one per thread
+    const int nbatch = std::max(1, std::min(nthreads, nmembers));
+    std::vector<std::vector<State_ *>> batches(nbatch);
+    for (int jb = 0; jb < nbatch; ++jb) {
+      batches[jb].assign(xx.begin() + (jb * nmembers) / nbatch,
+                         xx.begin() + ((jb + 1) * nmembers) / nbatch);
+    }
+//  The model is called directly in the threads: the trace is written outside of them
+    static const util::TimerId timerId(classname(), "stepBatch");
+    while (xx[0]->validTime() < end) {
+      Log::trace() << "Model<MODEL>::stepBatch starting" << std::endl;
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+      for (int jb = 0; jb < nbatch; ++jb) {
+        util::Timer timer(timerId);
+        model_->stepBatch(batches[jb], maux);
+      }
+      Log::trace() << "Model<MODEL>::stepBatch done" << std::endl;
+      for (int jm = 0; jm < nmembers; ++jm) {
+        post[jm].process(*xx[jm]);
+      }
+    }
+  } else {
+//  The model is called directly in the threads: the trace is written outside of them
+    static const util::TimerId timerId(classname(), "step");
+    while (xx[0]->validTime() < end) {
+      Log::trace() << "Model<MODEL>::step starting" << std::endl;
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+      for (int jm = 0; jm < nmembers; ++jm) {
+        util::Timer timer(timerId);
+        model_->step(*xx[jm], maux);
+      }
+      Log::trace() << "Model<MODEL>::step done" << std::endl;
+      for (int jm = 0; jm < nmembers; ++jm) {
+        post[jm].process(*xx[jm]);
+      }
+    }
+  }
+  for (int jm = 0; jm < nmembers; ++jm) {
+    post[jm].finalize(*xx[jm]);
+    this->finalize(*xx[jm]);
+    ASSERT(xx[jm]->validTime() == end);
+  }
+  Log::info() << "Model:forecast: " << nmembers << " forecasts finished at " << end << std::endl;
+
+  Log::trace() << "Model<MODEL>::forecast done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
 template<typename MODEL>
 void Model<MODEL>::initialize(State_ & xx) const {
   Log::trace() << "Model<MODEL>::initialize starting" << std::endl;
-  util::Timer timer(classname(), "initialize");
+  static const util::TimerId timerId(classname(), "initialize");
+  util::Timer timer(timerId);
   model_->initialize(xx);
   Log::trace() << "Model<MODEL>::initialize done" << std::endl;
 }
@@ -161,17 +245,30 @@ void Model<MODEL>::initialize(State_ & xx) const {
 template<typename MODEL>
 void Model<MODEL>::step(State_ & xx, const ModelAux_ & maux) const {
   Log::trace() << "Model<MODEL>::step starting" << std::endl;
-  util::Timer timer(classname(), "step");
+  static const util::TimerId timerId(classname(), "step");
+  util::Timer timer(timerId);
   model_->step(xx, maux);
   Log::trace() << "Model<MODEL>::step done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
+template<typename MODEL>
+void Model<MODEL>::stepBatch(const std::vector<State_ *> & xx, const ModelAux_ & maux) const {
+  Log::trace() << "Model<MODEL>::stepBatch starting" << std::endl;
+  static const util::TimerId timerId(classname(), "stepBatch");
+  util::Timer timer(timerId);
+  model_->stepBatch(xx, maux);
+  Log::trace() << "Model<MODEL>::stepBatch done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
 template<typename MODEL>
 void Model<MODEL>::finalize(State_ & xx) const {
   Log::trace() << "Model<MODEL>::finalize starting" << std::endl;
-  util::Timer timer(classname(), "finalize");
+  static const util::TimerId timerId(classname(), "finalize");
+  util::Timer timer(timerId);
   model_->finalize(xx);
   Log::trace() << "Model<MODEL>::finalize done" << std::endl;
 }
@@ -181,7 +278,8 @@ void Model<MODEL>::finalize(State_ & xx) const {
 template<typename MODEL>
 void Model<MODEL>::print(std::ostream & os) const {
   Log::trace() << "Model<MODEL>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *model_;
   Log::trace() << "Model<MODEL>::print done" << std::endl;
 }
@@ -77,7 +77,8 @@ template <typename OBS>
 ObsError<OBS>::ObsError(const ObsErrorParametersBase & params, const ObsSpace_ & os) {
   Log::trace() << "ObsError<OBS>::ObsError starting" << std::endl;
 
-  util::Timer timer(classname(), "ObsErrors");
+  static const util::TimerId timerId(classname(), "ObsErrors");
+  util::Timer timer(timerId);
   size_t init = eckit::system::ResourceUsage().maxResidentSetSize();
 
   err_ = ObsErrorFactory<OBS>::create(params, os);
@@ -92,7 +93,8 @@ ObsError<OBS>::ObsError(const ObsErrorParametersBase & params, const ObsSpace_ &
 template <typename OBS>
 ObsError<OBS>::~ObsError() {
   Log::trace() << "ObsError<OBS>::~ObsError starting" << std::endl;
-  util::Timer timer(classname(), "~ObsError");
+  static const util::TimerId timerId(classname(), "~ObsError");
+  util::Timer timer(timerId);
   err_.reset();
   Log::trace() << "ObsError<OBS>::~ObsError done" << std::endl;
 }
@@ -102,7 +104,8 @@ ObsError<OBS>::~ObsError() {
 template <typename OBS>
 void ObsError<OBS>::multiply(ObsVector_ & dy) const {
   Log::trace() << "ObsError<OBS>::multiply starting" << std::endl;
-  util::Timer timer(classname(), "multiply");
+  static const util::TimerId timerId(classname(), "multiply");
+  util::Timer timer(timerId);
   err_->multiply(dy);
   Log::trace() << "ObsError<OBS>::multiply done" << std::endl;
 }
@@ -112,7 +115,8 @@ void ObsError<OBS>::multiply(ObsVector_ & dy) const {
 template <typename OBS>
 void ObsError<OBS>::inverseMultiply(ObsVector_ & dy) const {
   Log::trace() << "ObsError<OBS>::inverseMultiply starting" << std::endl;
-  util::Timer timer(classname(), "inverseMultiply");
+  static const util::TimerId timerId(classname(), "inverseMultiply");
+  util::Timer timer(timerId);
   err_->inverseMultiply(dy);
   Log::trace() << "ObsError<OBS>::inverseMultiply done" << std::endl;
 }
@@ -122,7 +126,8 @@ void ObsError<OBS>::inverseMultiply(ObsVector_ & dy) const {
 template <typename OBS>
 void ObsError<OBS>::randomize(ObsVector_ & dy) const {
   Log::trace() << "ObsError<OBS>::randomize starting" << std::endl;
-  util::Timer timer(classname(), "randomize");
+  static const util::TimerId timerId(classname(), "randomize");
+  util::Timer timer(timerId);
   err_->randomize(dy);
   Log::trace() << "ObsError<OBS>::randomize done" << std::endl;
 }
@@ -131,7 +136,8 @@ void ObsError<OBS>::randomize(ObsVector_ & dy) const {
 template <typename OBS>
 void ObsError<OBS>::save(const std::string & name) const {
   Log::trace() << "ObsError<OBS>::save starting" << std::endl;
-  util::Timer timer(classname(), "save");
+  static const util::TimerId timerId(classname(), "save");
+  util::Timer timer(timerId);
   err_->save(name);
   Log::trace() << "ObsError<OBS>::save done" << std::endl;
 }
@@ -141,7 +147,8 @@ void ObsError<OBS>::save(const std::string & name) const {
 template <typename OBS>
 typename ObsError<OBS>::ObsVector_ ObsError<OBS>::obserrors() const {
   Log::trace() << "ObsError<OBS>::obserrors starting" << std::endl;
-  util::Timer timer(classname(), "obserrors");
+  static const util::TimerId timerId(classname(), "obserrors");
+  util::Timer timer(timerId);
   ObsVector_ obserr = err_->obserrors();
   Log::trace() << "ObsError<OBS>::obserrors done" << std::endl;
   return obserr;
@@ -152,7 +159,8 @@ typename ObsError<OBS>::ObsVector_ ObsError<OBS>::obserrors() const {
 template <typename OBS>
 void ObsError<OBS>::update(const ObsVector_ & obserr) {
   Log::trace() << "ObsError<OBS>::update starting" << std::endl;
-  util::Timer timer(classname(), "update");
+  static const util::TimerId timerId(classname(), "update");
+  util::Timer timer(timerId);
   err_->update(obserr);
   Log::trace() << "ObsError<OBS>::update done" << std::endl;
 }
@@ -162,7 +170,8 @@ void ObsError<OBS>::update(const ObsVector_ & obserr) {
 template <typename OBS>
 ObsVector<OBS> ObsError<OBS>::inverseVariance() const {
   Log::trace() << "ObsError<OBS>::inverseVariance starting" << std::endl;
-  util::Timer timer(classname(), "inverseVariance");
+  static const util::TimerId timerId(classname(), "inverseVariance");
+  util::Timer timer(timerId);
   ObsVector_ invar = err_->inverseVariance();
   Log::trace() << "ObsError<OBS>::inverseVariance done" << std::endl;
   return invar;
@@ -173,7 +182,8 @@ ObsVector<OBS> ObsError<OBS>::inverseVariance() const {
 template <typename OBS>
 double ObsError<OBS>::getRMSE() const {
   Log::trace() << "ObsError<OBS>::getRMSE starting" << std::endl;
-  util::Timer timer(classname(), "getRMSE");
+  static const util::TimerId timerId(classname(), "getRMSE");
+  util::Timer timer(timerId);
   double zz = err_->getRMSE();
   Log::trace() << "ObsError<OBS>::getRMSE done" << std::endl;
   return zz;
@@ -184,7 +194,8 @@ double ObsError<OBS>::getRMSE() const {
 template<typename OBS>
 void ObsError<OBS>::print(std::ostream & os) const {
   Log::trace() << "ObsError<OBS>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << (*err_);
   Log::trace() << "ObsError<OBS>::print done" << std::endl;
 }
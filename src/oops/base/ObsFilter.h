@@ -115,7 +115,8 @@ ObsFilter<OBS>::ObsFilter(const ObsSpace_ & os,
   : ofilt_(), filterName_("oops::ObsFilter::"+parameters.filter.value().value())
 {
   Log::trace() << "ObsFilter<OBS>::ObsFilter starting" << std::endl;
-  util::Timer timer(classname(), "ObsFilter");
+  static const util::TimerId timerId(classname(), "ObsFilter");
+  util::Timer timer(timerId);
   util::Timer timef(filterName_, "ObsFilter");
   ofilt_ = FilterFactory<OBS>::create(os, parameters, flags, obserr);
   Log::trace() << "ObsFilter<OBS>::ObsFilter done" << std::endl;
@@ -126,7 +127,8 @@ ObsFilter<OBS>::ObsFilter(const ObsSpace_ & os,
 template <typename OBS>
 ObsFilter<OBS>::~ObsFilter() {
   Log::trace() << "ObsFilter<OBS>::~ObsFilter starting" << std::endl;
-  util::Timer timer(classname(), "~ObsFilter");
+  static const util::TimerId timerId(classname(), "~ObsFilter");
+  util::Timer timer(timerId);
   ofilt_.reset();
   Log::trace() << "ObsFilter<OBS>::~ObsFilter done" << std::endl;
 }
@@ -136,7 +138,8 @@ ObsFilter<OBS>::~ObsFilter() {
 template <typename OBS>
 void ObsFilter<OBS>::preProcess() {
   Log::trace() << "ObsFilter<OBS>::preProcess starting" << std::endl;
-  util::Timer timer(classname(), "preProcess");
+  static const util::TimerId timerId(classname(), "preProcess");
+  util::Timer timer(timerId);
   util::Timer timef(filterName_, "preProcess");
   ofilt_->preProcess();
   Log::trace() << "ObsFilter<OBS>::preProcess done" << std::endl;
@@ -147,7 +150,8 @@ void ObsFilter<OBS>::preProcess() {
 template <typename OBS>
 void ObsFilter<OBS>::priorFilter(const GeoVaLs_ & gv) {
   Log::trace() << "ObsFilter<OBS>::priorFilter starting" << std::endl;
-  util::Timer timer(classname(), "priorFilter");
+  static const util::TimerId timerId(classname(), "priorFilter");
+  util::Timer timer(timerId);
   util::Timer timef(filterName_, "priorFilter");
   ofilt_->priorFilter(gv);
   Log::trace() << "ObsFilter<OBS>::priorFilter done" << std::endl;
@@ -161,7 +165,8 @@ void ObsFilter<OBS>::postFilter(const GeoVaLs_ & gv,
                                 const ObsVector_ & bv,
                                 const ObsDiags_ & dv) {
   Log::trace() << "ObsFilter<OBS>::postFilter starting" << std::endl;
-  util::Timer timer(classname(), "postFilter");
+  static const util::TimerId timerId(classname(), "postFilter");
+  util::Timer timer(timerId);
   util::Timer timef(filterName_, "postFilter");
   ofilt_->postFilter(gv, ov, bv, dv);
   Log::trace() << "ObsFilter<OBS>::postFilter done" << std::endl;
@@ -188,7 +193,8 @@ Variables ObsFilter<OBS>::requiredHdiagnostics() const {
 template <typename OBS>
 void ObsFilter<OBS>::print(std::ostream & os) const {
   Log::trace() << "ObsFilter<OBS>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *ofilt_;
   Log::trace() << "ObsFilter<OBS>::print done" << std::endl;
 }
@@ -198,7 +204,8 @@ void ObsFilter<OBS>::print(std::ostream & os) const {
 template <typename OBS>
 void ObsFilter<OBS>::checkFilterData(const FilterStage filterStage) {
   Log::trace() << "ObsFilter<OBS>::checkFilterData starting" << std::endl;
-  util::Timer timer(classname(), "checkFilterData");
+  static const util::TimerId timerId(classname(), "checkFilterData");
+  util::Timer timer(timerId);
   ofilt_->checkFilterData(filterStage);
   Log::trace() << "ObsFilter<OBS>::checkFilterData done" << std::endl;
 }
@@ -14,6 +14,7 @@
 #include <vector>
 #include <boost/noncopyable.hpp>
 
+#include "oops/base/LocalObs.h"
 #include "oops/base/ObsLocalizationParametersBase.h"
 #include "oops/base/ObsVector.h"
 #include "oops/interface/GeometryIterator.h"
@@ -55,6 +56,22 @@ class ObsLocalizationBase : public util::Printable,
   /// Set \p locfactor to missing value for observations that are not local.
   virtual void computeLocalization(const GeometryIterator_ & point,
                                    ObsVector_ & locfactor) const = 0;
+
+  /// compute obs-space localization only for the observations local to \p point:
+  /// on return \p local holds the indices of observations within the localization
+  /// radius and their localization values.
+  /// Returns false if the implementation doesn't support the sparse computation, in which
+  /// case callers fall back on the full-length computeLocalization.
+  bool computeLocalObs(const GeometryIterator<MODEL> & point, LocalObs & local) const {
+    return computeLocalObs(point.geometryiter(), local);
+  }
+
+  /// compute obs-space localization only for the observations local to \p point.
+  /// Implementations should use a spatial index of the obs locations (e.g. ObsSpatialIndex)
+  /// so that the cost doesn't scale with the total number of observations.
+  virtual bool computeLocalObs(const GeometryIterator_ & point, LocalObs & local) const {
+    return false;
+  }
 };
 
 template <typename MODEL, typename OBS> class ObsLocalizationFactory;
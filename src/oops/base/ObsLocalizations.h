@@ -16,6 +16,7 @@
 #include <boost/noncopyable.hpp>
 
 #include "oops/base/Departures.h"
+#include "oops/base/LocalObs.h"
 #include "oops/base/ObsLocalizationBase.h"
 #include "oops/base/ObsSpaces.h"
 #include "oops/util/Printable.h"
@@ -42,6 +43,12 @@ class ObsLocalizations : public util::Printable,
   void computeLocalization(const GeometryIterator_ & point,
                            Observations_ & obsvectors) const;
 
+  /// sparse variant of computeLocalization: \p local[jj] holds the observations of
+  /// obs space jj that are local to \p point. Returns false (with \p local unusable)
+  /// if an obs space has no localization or a localization doesn't support it.
+  bool computeLocalization(const GeometryIterator_ & point,
+                           std::vector<LocalObs> & local) const;
+
  private:
   void print(std::ostream &) const;
   std::vector< std::vector<std::unique_ptr<ObsLocalization_> >> local_;
@@ -78,8 +85,9 @@ template <typename MODEL, typename OBS>
 void ObsLocalizations<MODEL, OBS>::computeLocalization(const GeometryIterator_ & point,
                                                        Observations_ & locfactor) const {
   //  initialize locafactors to ones and then update them in the loop bellow
-  locfactor.ones();
+  //  (called from the threads of LocalEnsembleSolver: the OBS methods are called directly)
   for (size_t jj = 0; jj < local_.size(); ++jj) {
+    locfactor[jj].obsvector().ones();
     for (size_t oli = 0; oli < local_[jj].size(); ++oli) {
       if (local_[jj][oli]) local_[jj][oli]->computeLocalization(point, locfactor[jj]);
     }
@@ -88,6 +96,27 @@ void ObsLocalizations<MODEL, OBS>::computeLocalization(const GeometryIterator_ &
 
 // -----------------------------------------------------------------------------
 
+template <typename MODEL, typename OBS>
+bool ObsLocalizations<MODEL, OBS>::computeLocalization(const GeometryIterator_ & point,
+                                                       std::vector<LocalObs> & local) const {
+  local.resize(local_.size());
+  LocalObs tmp;
+  for (size_t jj = 0; jj < local_.size(); ++jj) {
+    // without localization all observations are local
+    if (local_[jj].empty()) return false;
+    for (size_t oli = 0; oli < local_[jj].size(); ++oli) {
+      if (!local_[jj][oli]) return false;
+      // the first localization selects the local obs, the others are combined with it
+      LocalObs & current = (oli == 0) ? local[jj] : tmp;
+      if (!local_[jj][oli]->computeLocalObs(point, current)) return false;
+      if (oli > 0) local[jj].intersect(tmp);
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
 template<typename MODEL, typename OBS>
 void ObsLocalizations<MODEL, OBS>::print(std::ostream & os) const {
   for (size_t jj = 0; jj < local_.size(); ++jj) {
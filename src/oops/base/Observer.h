@@ -86,11 +86,18 @@ class Observer {
 /// different iterations
   std::shared_ptr<GetValues_> initialize(const Geometry_ &, const ObsAuxCtrl_ &,
                                          ObsError_ &, const eckit::Configuration &);
+/// \brief Same as above for member \p member of an ensemble of H(x) computations sharing
+/// GetValues \p getvals (returned by the initialize call of the first member)
+  void initialize(const Geometry_ &, const ObsAuxCtrl_ &, ObsError_ &,
+                  const eckit::Configuration &, std::shared_ptr<GetValues_> getvals,
+                  const size_t member);
 
 /// \brief Computes H(x) from the filled in GeoVaLs
   void finalize(ObsVector_ &);
 
  private:
+  void setup(const Geometry_ &, const ObsAuxCtrl_ &, ObsError_ &, const eckit::Configuration &);
+
   Parameters_                   parameters_;
   const ObsSpace_ &             obspace_;    // ObsSpace used in H(x)
   Variables                     geovars_;
@@ -103,6 +110,7 @@ class Observer {
   std::unique_ptr<ObsDataVector_> obserrfilter_;  // Obs error std dev for processed variables
   std::shared_ptr<GetValues_>   getvals_;    // Postproc passed to the model during integration.
   std::shared_ptr<ObsDataInt_>  qcflags_;    // QC flags (should not be a pointer)
+  size_t                        member_;     // ensemble member index in getvals_
   bool                          initialized_;
   std::unique_ptr<eckit::LocalConfiguration> iterconf_;
 };
@@ -112,7 +120,7 @@ class Observer {
 template <typename MODEL, typename OBS>
 Observer<MODEL, OBS>::Observer(const ObsSpace_ & obspace, const Parameters_ & params)
   : parameters_(params), obspace_(obspace), geovars_(), varsizes_(), obsop_(), locations_(),
-    biascoeff_(nullptr), filters_(), qcflags_(), initialized_(false)
+    biascoeff_(nullptr), filters_(), qcflags_(), member_(0), initialized_(false)
 {
   Log::trace() << "Observer::Observer start" << std::endl;
   /// Set up observation operators
@@ -129,6 +137,42 @@ std::shared_ptr<GetValues<MODEL, OBS>>
 Observer<MODEL, OBS>::initialize(const Geometry_ & geom, const ObsAuxCtrl_ & biascoeff,
                                  ObsError_ & R, const eckit::Configuration & conf) {
   Log::trace() << "Observer<MODEL, OBS>::initialize start" << std::endl;
+  this->setup(geom, biascoeff, R, conf);
+
+// Set up GetValues
+  getvals_.reset(new GetValues_(parameters_.getValues, geom, obspace_.windowStart(),
+                                obspace_.windowEnd(), *locations_, geovars_));
+  member_ = 0;
+
+  initialized_ = true;
+  Log::trace() << "Observer<MODEL, OBS>::initialize done" << std::endl;
+  return getvals_;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL, typename OBS>
+void Observer<MODEL, OBS>::initialize(const Geometry_ & geom, const ObsAuxCtrl_ & biascoeff,
+                                      ObsError_ & R, const eckit::Configuration & conf,
+                                      std::shared_ptr<GetValues_> getvals, const size_t member) {
+  Log::trace() << "Observer<MODEL, OBS>::initialize start" << std::endl;
+  this->setup(geom, biascoeff, R, conf);
+
+// Use the GetValues of the ensemble (same locations and variables for all members)
+  ASSERT(getvals);
+  ASSERT(getvals->requiredVariables() == geovars_);
+  getvals_ = getvals;
+  member_ = member;
+
+  initialized_ = true;
+  Log::trace() << "Observer<MODEL, OBS>::initialize done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL, typename OBS>
+void Observer<MODEL, OBS>::setup(const Geometry_ & geom, const ObsAuxCtrl_ & biascoeff,
+                                 ObsError_ & R, const eckit::Configuration & conf) {
 // Save information for finalize
   iterconf_.reset(new eckit::LocalConfiguration(conf));
   biascoeff_ = &biascoeff;
@@ -147,14 +191,7 @@ Observer<MODEL, OBS>::initialize(const Geometry_ & geom, const ObsAuxCtrl_ & bia
   geovars_ += filters_->requiredVars();
   varsizes_ = geom.variableSizes(geovars_);
 
-// Set up GetValues
   locations_.reset(new Locations_(obsop_->locations()));
-  getvals_.reset(new GetValues_(parameters_.getValues, geom, obspace_.windowStart(),
-                                obspace_.windowEnd(), *locations_, geovars_));
-
-  initialized_ = true;
-  Log::trace() << "Observer<MODEL, OBS>::initialize done" << std::endl;
-  return getvals_;
 }
 
 // -----------------------------------------------------------------------------
@@ -167,7 +204,7 @@ void Observer<MODEL, OBS>::finalize(ObsVector_ & yobsim) {
   GeoVaLs_ geovals(*locations_, geovars_, varsizes_);
 
   // Fill GeoVaLs
-  getvals_->fillGeoVaLs(geovals);
+  getvals_->fillGeoVaLs(geovals, member_);
 
   /// Call prior filters
   filters_->priorFilter(geovals);
@@ -15,6 +15,7 @@
 #include "eckit/config/LocalConfiguration.h"
 
 #include "oops/base/Geometry.h"
+#include "oops/base/GetValues.h"
 #include "oops/base/GetValuePosts.h"
 #include "oops/base/ObsAuxControls.h"
 #include "oops/base/ObsErrors.h"
@@ -52,6 +53,7 @@ class ObserversParameters : public oops::Parameters {
 template <typename MODEL, typename OBS>
 class Observers {
   typedef Geometry<MODEL>               Geometry_;
+  typedef GetValues<MODEL, OBS>         GetValues_;
   typedef GetValuePosts<MODEL, OBS>     GetValuePosts_;
   typedef GetValuesParameters<MODEL>    GetValuesParameters_;
   typedef ObsAuxControls<OBS>           ObsAuxCtrls_;
@@ -77,6 +79,18 @@ class Observers {
   void initialize(const Geometry_ &, const ObsAuxCtrls_ &, ObsErrors_ &,
                   PostProc_ &, const eckit::Configuration & = eckit::LocalConfiguration());
 
+/// \brief Initializes the first of \p nmembers Observers computing H(x) for an ensemble
+/// with the same observations: the interpolation to the obs locations (GetValues) is set up
+/// once, shared by all members and the interpolated values of all members are exchanged
+/// between MPI tasks together. The other members are initialized with the method below and
+/// all members have to be run before finalize is called for any of them.
+  void initialize(const Geometry_ &, const ObsAuxCtrls_ &, ObsErrors_ &,
+                  PostProc_ &, const eckit::Configuration &, const size_t nmembers);
+/// \brief Initializes member \p member sharing the interpolation set up by \p first
+  void initialize(const Geometry_ &, const ObsAuxCtrls_ &, ObsErrors_ &,
+                  PostProc_ &, const eckit::Configuration &, const Observers & first,
+                  const size_t member);
+
 /// \brief Computes H(x) from the filled in GeoVaLs
   void finalize(Observations_ &);
 
@@ -86,6 +100,7 @@ class Observers {
 
  private:
   std::vector<std::unique_ptr<Observer_>>  observers_;
+  std::vector<std::shared_ptr<GetValues_>> getvals_;
   GetValuesParameters_ getValuesParams_;
 };
 
@@ -95,7 +110,7 @@ template <typename MODEL, typename OBS>
 Observers<MODEL, OBS>::Observers(const ObsSpaces_ & obspaces,
                                  const std::vector<ObserverParameters_> & params,
                                  const GetValuesParameters_ & getValuesParams)
-  : observers_(), getValuesParams_(getValuesParams)
+  : observers_(), getvals_(), getValuesParams_(getValuesParams)
 {
   Log::trace() << "Observers<MODEL, OBS>::Observers start" << std::endl;
 
@@ -125,8 +140,42 @@ void Observers<MODEL, OBS>::initialize(const Geometry_ & geom, const ObsAuxCtrls
   Log::trace() << "Observers<MODEL, OBS>::initialize start" << std::endl;
 
   std::shared_ptr<GetValuePosts_> getvals(new GetValuePosts_(getValuesParams_));
+  getvals_.clear();
+  for (size_t jj = 0; jj < observers_.size(); ++jj) {
+    getvals_.push_back(observers_[jj]->initialize(geom, obsaux[jj], Rmat[jj], conf));
+    getvals->append(getvals_.back());
+  }
+  pp.enrollProcessor(getvals);
+
+  Log::trace() << "Observers<MODEL, OBS>::initialize done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL, typename OBS>
+void Observers<MODEL, OBS>::initialize(const Geometry_ & geom, const ObsAuxCtrls_ & obsaux,
+                                       ObsErrors_ & Rmat, PostProc_ & pp,
+                                       const eckit::Configuration & conf,
+                                       const size_t nmembers) {
+  this->initialize(geom, obsaux, Rmat, pp, conf);
+  for (std::shared_ptr<GetValues_> getval : getvals_) getval->setEnsembleSize(nmembers);
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL, typename OBS>
+void Observers<MODEL, OBS>::initialize(const Geometry_ & geom, const ObsAuxCtrls_ & obsaux,
+                                       ObsErrors_ & Rmat, PostProc_ & pp,
+                                       const eckit::Configuration & conf,
+                                       const Observers & first, const size_t member) {
+  Log::trace() << "Observers<MODEL, OBS>::initialize start" << std::endl;
+
+  ASSERT(first.getvals_.size() == observers_.size());
+  std::shared_ptr<GetValuePosts_> getvals(new GetValuePosts_(getValuesParams_, member));
+  getvals_ = first.getvals_;
   for (size_t jj = 0; jj < observers_.size(); ++jj) {
-    getvals->append(observers_[jj]->initialize(geom, obsaux[jj], Rmat[jj], conf));
+    observers_[jj]->initialize(geom, obsaux[jj], Rmat[jj], conf, getvals_[jj], member);
+    getvals->append(getvals_[jj]);
   }
   pp.enrollProcessor(getvals);
 
@@ -0,0 +1,281 @@
+/*
+ * (C) Copyright 2023 UCAR.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#ifndef OOPS_GENERIC_CHECKPOINTEDLINEARMODEL_H_
+#define OOPS_GENERIC_CHECKPOINTEDLINEARMODEL_H_
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "eckit/config/LocalConfiguration.h"
+#include "eckit/exception/Exceptions.h"
+
+#include "oops/base/Geometry.h"
+#include "oops/base/Model.h"
+#include "oops/base/PostBase.h"
+#include "oops/base/PostProcessor.h"
+#include "oops/base/State.h"
+#include "oops/base/Variables.h"
+#include "oops/generic/LinearModelBase.h"
+#include "oops/interface/ModelAuxControl.h"
+#include "oops/util/DateTime.h"
+#include "oops/util/Duration.h"
+#include "oops/util/Logger.h"
+#include "oops/util/parameters/Parameters.h"
+#include "oops/util/parameters/RequiredParameter.h"
+#include "oops/util/Timer.h"
+
+namespace oops {
+
+// -----------------------------------------------------------------------------
+
+class CheckpointedLinearModelParameters : public LinearModelParametersBase {
+  OOPS_CONCRETE_PARAMETERS(CheckpointedLinearModelParameters, LinearModelParametersBase)
+
+ public:
+  RequiredParameter<eckit::LocalConfiguration> linearModel{"linear model",
+    "linear model run between the checkpoints", this};
+  RequiredParameter<eckit::LocalConfiguration> model{"model",
+    "nonlinear model that computed the trajectory, used to recompute it from the checkpoints",
+    this};
+  RequiredParameter<util::Duration> interval{"checkpoint interval",
+    "time between checkpoints (a multiple of the model time step)", this};
+};
+
+// -----------------------------------------------------------------------------
+
+/// Post-processor setting the trajectory of a linear model during a forecast.
+template <typename MODEL>
+class TrajectoryFeeder : public PostBase<State<MODEL>> {
+  typedef Geometry<MODEL>          Geometry_;
+  typedef LinearModelBase<MODEL>   LinearModelBase_;
+  typedef ModelAuxControl<MODEL>   ModelAuxCtl_;
+  typedef State<MODEL>             State_;
+
+ public:
+  TrajectoryFeeder(const Geometry_ & resol, LinearModelBase_ & tlm, const ModelAuxCtl_ & maux)
+    : resol_(resol), tlm_(tlm), maux_(maux) {}
+
+ private:
+  void doProcessing(const State_ & xx) override {
+    State_ xlr(resol_, xx);
+    tlm_.setTrajectory(xx, xlr, maux_);
+  }
+
+  const Geometry_ & resol_;
+  LinearModelBase_ & tlm_;
+  const ModelAuxCtl_ & maux_;
+};
+
+// -----------------------------------------------------------------------------
+
+/// Linear model keeping only checkpoints of the trajectory.
+///
+/// Wraps another linear model. Instead of passing the whole trajectory to it, the states are
+/// only saved every "checkpoint interval". When the TL or AD needs the trajectory within an
+/// interval, the nonlinear model is re-run from the checkpoint at the start of the interval and
+/// a new instance of the wrapped linear model is given the trajectory of that interval only.
+/// Memory use is bounded by the checkpoints plus the trajectory of one interval, at the cost of
+/// one extra nonlinear forecast per TL or AD run (when there is more than one interval).
+template <typename MODEL>
+class CheckpointedLinearModel : public LinearModelBase<MODEL> {
+  typedef Geometry<MODEL>                          Geometry_;
+  typedef Increment<MODEL>                         Increment_;
+  typedef LinearModelBase<MODEL>                   LinearModelBase_;
+  typedef LinearModelFactory<MODEL>                LinearModelFactory_;
+  typedef LinearModelParametersWrapper<MODEL>      LinearModelParametersWrapper_;
+  typedef Model<MODEL>                             Model_;
+  typedef ModelAuxControl<MODEL>                   ModelAuxCtl_;
+  typedef ModelAuxIncrement<MODEL>                 ModelAuxInc_;
+  typedef State<MODEL>                             State_;
+
+ public:
+  typedef CheckpointedLinearModelParameters        Parameters_;
+
+  static const std::string classname() {return "oops::CheckpointedLinearModel";}
+
+  CheckpointedLinearModel(const Geometry_ &, const Parameters_ &);
+
+  void initializeTL(Increment_ &) const override;
+  void stepTL(Increment_ &, const ModelAuxInc_ &) const override;
+  void finalizeTL(Increment_ &) const override;
+
+  void initializeAD(Increment_ &) const override;
+  void stepAD(Increment_ &, ModelAuxInc_ &) const override;
+  void finalizeAD(Increment_ &) const override;
+
+  void setTrajectory(const State_ &, State_ &, const ModelAuxCtl_ &) override;
+
+  const util::Duration & timeResolution() const override {return tlm_->timeResolution();}
+  const oops::Variables & variables() const override {return tlm_->variables();}
+
+ private:
+  size_t checkpoint(const util::DateTime &) const;
+  void loadTrajectory(const size_t) const;
+  void print(std::ostream &) const override;
+
+  const Geometry_ & resol_;
+  const util::Duration interval_;
+  const eckit::LocalConfiguration modelConf_;
+  LinearModelParametersWrapper_ tlmParams_;
+  mutable std::unique_ptr<LinearModelBase_> tlm_;  // holds the trajectory of one interval
+  std::unique_ptr<Model_> model_;
+  std::unique_ptr<ModelAuxCtl_> maux_;             // model aux for the nonlinear model
+  std::unique_ptr<ModelAuxCtl_> lrmaux_;           // model aux for the linear model
+  std::vector<std::unique_ptr<State_>> checkpoints_;
+  util::DateTime last_;                            // time of last trajectory state
+  mutable size_t current_;                         // interval in tlm_ (npos if none)
+  static constexpr size_t npos = std::numeric_limits<size_t>::max();
+};
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+CheckpointedLinearModel<MODEL>::CheckpointedLinearModel(const Geometry_ & resol,
+                                                        const Parameters_ & params)
+  : resol_(resol), interval_(params.interval.value()), modelConf_(params.model.value()), tlmParams_(),
+    tlm_(), model_(), maux_(), lrmaux_(), checkpoints_(), last_(), current_(npos)
+{
+  Log::trace() << "CheckpointedLinearModel<MODEL>::CheckpointedLinearModel starting" << std::endl;
+  ASSERT(interval_.toSeconds() > 0);
+  tlmParams_.validateAndDeserialize(params.linearModel.value());
+  tlm_.reset(LinearModelFactory_::create(resol_, tlmParams_.linearModelParameters));
+  Log::trace() << "CheckpointedLinearModel<MODEL>::CheckpointedLinearModel done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void CheckpointedLinearModel<MODEL>::setTrajectory(const State_ & xx, State_ &,
+                                                   const ModelAuxCtl_ & maux) {
+  Log::trace() << "CheckpointedLinearModel<MODEL>::setTrajectory starting" << std::endl;
+  // A new trajectory starts
+  if (!checkpoints_.empty() && xx.validTime() <= last_) {
+    checkpoints_.clear();
+    current_ = npos;
+  }
+  if (checkpoints_.empty()) {
+    if (!model_) model_.reset(new Model_(xx.geometry(), modelConf_));
+    maux_.reset(new ModelAuxCtl_(xx.geometry(), maux));
+    lrmaux_.reset(new ModelAuxCtl_(resol_, maux));
+  }
+  const util::DateTime bgn = checkpoints_.empty() ? xx.validTime()
+                                                  : checkpoints_.front()->validTime();
+  if ((xx.validTime() - bgn).toSeconds() % interval_.toSeconds() == 0) {
+    checkpoints_.emplace_back(new State_(xx));
+  }
+  last_ = xx.validTime();
+  Log::trace() << "CheckpointedLinearModel<MODEL>::setTrajectory done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+size_t CheckpointedLinearModel<MODEL>::checkpoint(const util::DateTime & tt) const {
+  // Index of the checkpoint starting the interval that contains tt
+  ASSERT(!checkpoints_.empty());
+  const util::DateTime bgn = checkpoints_.front()->validTime();
+  ASSERT(tt >= bgn && tt <= last_);
+  return std::min(static_cast<size_t>((tt - bgn).toSeconds() / interval_.toSeconds()),
+                  checkpoints_.size() - 1);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void CheckpointedLinearModel<MODEL>::loadTrajectory(const size_t jchk) const {
+  if (jchk == current_) return;
+  Log::trace() << "CheckpointedLinearModel<MODEL>::loadTrajectory starting" << std::endl;
+  static const util::TimerId timerId(classname(), "loadTrajectory");
+  util::Timer timer(timerId);
+  // New linear model with no trajectory, then recompute the trajectory of this interval
+  tlm_.reset();
+  tlm_.reset(LinearModelFactory_::create(resol_, tlmParams_.linearModelParameters));
+  State_ xx(*checkpoints_[jchk]);
+  const util::DateTime end = (jchk + 1 < checkpoints_.size())
+                             ? checkpoints_[jchk + 1]->validTime() : last_;
+  PostProcessor<State_> post;
+  post.enrollProcessor(new TrajectoryFeeder<MODEL>(resol_, *tlm_, *lrmaux_));
+  model_->forecast(xx, *maux_, end - xx.validTime(), post);
+  current_ = jchk;
+  Log::trace() << "CheckpointedLinearModel<MODEL>::loadTrajectory done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void CheckpointedLinearModel<MODEL>::initializeTL(Increment_ & dx) const {
+  loadTrajectory(checkpoint(dx.validTime()));
+  tlm_->initializeTL(dx);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void CheckpointedLinearModel<MODEL>::stepTL(Increment_ & dx, const ModelAuxInc_ & merr) const {
+  // Each instance of the wrapped linear model runs between its own initialize and finalize
+  const size_t jchk = checkpoint(dx.validTime());
+  if (jchk != current_) {
+    tlm_->finalizeTL(dx);
+    loadTrajectory(jchk);
+    tlm_->initializeTL(dx);
+  }
+  tlm_->stepTL(dx, merr);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void CheckpointedLinearModel<MODEL>::finalizeTL(Increment_ & dx) const {
+  tlm_->finalizeTL(dx);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void CheckpointedLinearModel<MODEL>::initializeAD(Increment_ & dx) const {
+  loadTrajectory(checkpoint(dx.validTime() - tlm_->timeResolution()));
+  tlm_->initializeAD(dx);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void CheckpointedLinearModel<MODEL>::stepAD(Increment_ & dx, ModelAuxInc_ & merr) const {
+  // The adjoint step from t uses the trajectory at t - tstep
+  const size_t jchk = checkpoint(dx.validTime() - tlm_->timeResolution());
+  if (jchk != current_) {
+    tlm_->finalizeAD(dx);
+    loadTrajectory(jchk);
+    tlm_->initializeAD(dx);
+  }
+  tlm_->stepAD(dx, merr);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void CheckpointedLinearModel<MODEL>::finalizeAD(Increment_ & dx) const {
+  tlm_->finalizeAD(dx);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void CheckpointedLinearModel<MODEL>::print(std::ostream & os) const {
+  os << "CheckpointedLinearModel: " << checkpoints_.size() << " checkpoints every "
+     << interval_ << std::endl << *tlm_;
+}
+
+// -----------------------------------------------------------------------------
+
+}  // namespace oops
+
+#endif  // OOPS_GENERIC_CHECKPOINTEDLINEARMODEL_H_
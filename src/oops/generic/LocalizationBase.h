@@ -15,6 +15,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <boost/noncopyable.hpp>
 
@@ -53,6 +54,15 @@ class LocalizationBase : public util::Printable,
   virtual void randomize(Increment_ & dx) const = 0;
   /// Apply 3D localization to \p dx
   virtual void multiply(Increment_ & dx) const = 0;
+
+  /// Randomize each of \p dxs and apply 3D localization. The default calls randomize() for each
+  /// increment; implementations can override it to share work between the increments.
+  virtual void randomizeBatch(const std::vector<Increment_ *> & dxs) const
+    {for (Increment_ * dx : dxs) this->randomize(*dx);}
+  /// Apply 3D localization to each of \p dxs. The default calls multiply() for each increment;
+  /// implementations can override it to share work between the increments.
+  virtual void multiplyBatch(const std::vector<Increment_ *> & dxs) const
+    {for (Increment_ * dx : dxs) this->multiply(*dx);}
 };
 
 // -----------------------------------------------------------------------------
@@ -75,6 +75,14 @@ class ModelBase : public util::Printable,
   /// \brief Forecast finalization; called after each forecast run
   virtual void finalize(State_ &) const = 0;
 
+  /// \brief Forecast "step" of several states valid at the same time, called during ensemble
+  /// forecasts when hasStepBatch() is true; the default steps the states one at a time
+  virtual void stepBatch(const std::vector<State_ *> & xx, const ModelAux_ & maux) const
+       { for (State_ * jx : xx) this->step(*jx, maux); }
+  /// \brief Whether stepBatch is more efficient than stepping the states one at a time
+  /// (otherwise ensemble forecasts step the states concurrently with step)
+  virtual bool hasStepBatch() const {return false;}
+
   /// \brief Time step for running Model's forecast in oops (frequency with which the
   /// State will be updated)
   virtual const util::Duration & timeResolution() const = 0;
@@ -0,0 +1,69 @@
+/*
+ * (C) Copyright 2023 UCAR.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#include "oops/generic/ObsSpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "eckit/geometry/Point2.h"
+#include "eckit/geometry/Sphere.h"
+
+namespace oops {
+
+// -----------------------------------------------------------------------------
+
+ObsSpatialIndex::ObsSpatialIndex(const std::vector<eckit::geometry::Point3> & points)
+  : tree_(new KDTree()), npoints_(points.size())
+{
+  std::vector<KDTree::Value> values;
+  values.reserve(npoints_);
+  for (size_t jj = 0; jj < npoints_; ++jj) {
+    values.emplace_back(points[jj], jj);
+  }
+  if (npoints_ > 0) tree_->build(values.begin(), values.end());
+}
+
+// -----------------------------------------------------------------------------
+
+ObsSpatialIndex::~ObsSpatialIndex() {}
+
+// -----------------------------------------------------------------------------
+
+void ObsSpatialIndex::findInSphere(const eckit::geometry::Point3 & center, const double radius,
+                                   std::vector<size_t> & indices) const {
+  indices.clear();
+  if (npoints_ == 0) return;
+  const KDTree::NodeList found = tree_->findInSphere(center, radius);
+  indices.reserve(found.size());
+  for (const auto & node : found) {
+    indices.push_back(node.payload());
+  }
+  std::sort(indices.begin(), indices.end());
+}
+
+// -----------------------------------------------------------------------------
+
+eckit::geometry::Point3 ObsSpatialIndex::lonLatToCartesian(const double lon, const double lat,
+                                                           const double radius) {
+  eckit::geometry::Point3 xyz;
+  eckit::geometry::Sphere::convertSphericalToCartesian(radius, eckit::geometry::Point2(lon, lat),
+                                                       xyz);
+  return xyz;
+}
+
+// -----------------------------------------------------------------------------
+
+double ObsSpatialIndex::chordLength(const double dist, const double radius) {
+  const double angle = std::min(dist / radius, M_PI);
+  // slightly enlarged so that points exactly at distance dist are not lost to round-off
+  return 2.0 * radius * std::sin(0.5 * angle) * (1.0 + 1.e-10);
+}
+
+// -----------------------------------------------------------------------------
+
+}  // namespace oops
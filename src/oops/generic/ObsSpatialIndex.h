@@ -0,0 +1,60 @@
+/*
+ * (C) Copyright 2023 UCAR.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#ifndef OOPS_GENERIC_OBSSPATIALINDEX_H_
+#define OOPS_GENERIC_OBSSPATIALINDEX_H_
+
+#include <memory>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+#include "eckit/container/KDTree.h"
+#include "eckit/geometry/Point3.h"
+
+namespace oops {
+
+// -----------------------------------------------------------------------------
+/// \brief KD-tree over observation locations in 3D cartesian space.
+/// \details Built once per obs space, it lets obs-space localizations find the
+/// observations within the localization radius of a model grid point without
+/// computing the distance to every observation.
+class ObsSpatialIndex : private boost::noncopyable {
+  struct TreeTrait {
+    typedef eckit::geometry::Point3 Point;
+    typedef size_t                  Payload;
+  };
+  typedef eckit::KDTreeMemory<TreeTrait> KDTree;
+
+ public:
+  /// Index of \p points in cartesian coordinates; the index of points[jj] is jj.
+  explicit ObsSpatialIndex(const std::vector<eckit::geometry::Point3> & points);
+  ~ObsSpatialIndex();
+
+  /// Returns in \p indices (ascending) the points within \p radius of \p center.
+  void findInSphere(const eckit::geometry::Point3 & center, const double radius,
+                    std::vector<size_t> & indices) const;
+
+  size_t size() const {return npoints_;}
+
+  /// Cartesian coordinates of \p lon, \p lat (degrees) on a sphere of radius \p radius.
+  static eckit::geometry::Point3 lonLatToCartesian(const double lon, const double lat,
+                                                   const double radius);
+  /// Chord length between two points at great-circle distance \p dist on a sphere of
+  /// radius \p radius (search radius equivalent to \p dist).
+  static double chordLength(const double dist, const double radius);
+
+ private:
+  std::unique_ptr<KDTree> tree_;
+  size_t npoints_;
+};
+
+// -----------------------------------------------------------------------------
+
+}  // namespace oops
+
+#endif  // OOPS_GENERIC_OBSSPATIALINDEX_H_
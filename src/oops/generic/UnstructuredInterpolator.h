@@ -8,9 +8,15 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <ostream>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -23,11 +29,14 @@
 #include "atlas/util/Metadata.h"
 #include "eckit/config/Configuration.h"
 #include "eckit/exception/Exceptions.h"
+#include "eckit/filesystem/PathName.h"
 
 #include "oops/base/Geometry.h"
 #include "oops/base/Increment.h"
 #include "oops/base/State.h"
 #include "oops/base/Variables.h"
+#include "oops/mpi/mpi.h"
+#include "oops/util/hashValues.h"
 #include "oops/util/Logger.h"
 #include "oops/util/missingValues.h"
 #include "oops/util/ObjectCounter.h"
@@ -73,6 +82,21 @@ class UnstructuredInterpolator : public util::Printable,
   void applyAD(const Variables &, atlas::FieldSet &, const std::vector<bool> &,
                const std::vector<double> &) const;
 
+  // Interpolator interface with a list of target points, i.e., interpolates to the target points
+  // whose indices are listed. The return vector holds values for all target points (ordered as
+  // with the other interfaces) and is unmodified at the points not listed.
+  void apply(const Variables &, const State_ &, const std::vector<size_t> &,
+             std::vector<double> &) const;
+  void apply(const Variables &, const Increment_ &, const std::vector<size_t> &,
+             std::vector<double> &) const;
+  void applyAD(const Variables &, Increment_ &, const std::vector<size_t> &,
+               const std::vector<double> &) const;
+
+  void apply(const Variables &, const atlas::FieldSet &, const std::vector<size_t> &,
+             std::vector<double> &) const;
+  void applyAD(const Variables &, atlas::FieldSet &, const std::vector<size_t> &,
+               const std::vector<double> &) const;
+
   // Unscramble MPI buffer into the model's FieldSet representation
   // Methods are static because they do NOT rely on any internal state of the interpolator; they
   // only encode the inverse of the transformation done in apply() to get an MPI buffer from the
@@ -82,40 +106,75 @@ class UnstructuredInterpolator : public util::Printable,
   static void bufferToFieldSetAD(const Variables &, const std::vector<size_t> &,
                                  std::vector<double> &, const atlas::FieldSet &);
 
+  // Release the interpolation matrices shared between interpolators (see below)
+  static void clearCache();
+
  private:
-  // Small struct to help organize the interpolation matrices (= stencils and weights)
+  // Small struct to help organize the interpolation matrices (= stencils and weights), stored
+  // in compressed sparse row format: the stencil of target point jloc is made of source points
+  // indices[offsets[jloc]:offsets[jloc+1]] with weights weights[offsets[jloc]:offsets[jloc+1]]
   struct InterpMatrix {
     std::vector<bool> targetHasValidStencil;
-    std::vector<std::vector<size_t>> stencils;
-    std::vector<std::vector<double>> weights;
+    std::vector<size_t> offsets;
+    std::vector<size_t> indices;
+    std::vector<double> weights;
   };
 
-  void applyPerLevel(const InterpMatrix &,
-                     const std::string &,
-                     const std::vector<bool> &,
-                     const atlas::array::ArrayView<double, 2> &,
-                     std::vector<double>::iterator &, const size_t &) const;
-  void applyPerLevelAD(const InterpMatrix &,
-                       const std::string &,
-                       const std::vector<bool> &,
-                       atlas::array::ArrayView<double, 2> &,
-                       std::vector<double>::const_iterator &, const size_t &) const;
+  // Interpolation types, resolved from the field metadata once per field
+  enum class InterpType {Default, Integer, Nearest};
+  static InterpType interpType(const std::string &);
+
+  // Indices of the target points for which a mask is true
+  std::vector<size_t> maskedTargets(const std::vector<bool> &) const;
+
+  // Interpolate all levels of a field, one stencil at a time
+  template <InterpType TYPE>
+  void applyAllLevels(const InterpMatrix &,
+                      const std::vector<size_t> &,
+                      const atlas::array::ArrayView<double, 2> &,
+                      std::vector<double>::iterator &) const;
+  void applyAllLevelsAD(const InterpMatrix &,
+                        const InterpType,
+                        const std::vector<size_t> &,
+                        atlas::array::ArrayView<double, 2> &,
+                        std::vector<double>::const_iterator &) const;
   void print(std::ostream &) const override;
 
-  void computeUnmaskedInterpMatrix(std::vector<double>, std::vector<double>) const;
-  void computeMaskedInterpMatrix(const std::string &,
-                                 const atlas::array::ArrayView<double, 2> &) const;
+  typedef std::shared_ptr<const InterpMatrix> InterpMatrixPtr;
+
+  InterpMatrix computeUnmaskedInterpMatrix(const std::vector<double> &,
+                                           const std::vector<double> &) const;
+  InterpMatrix computeMaskedInterpMatrix(const InterpMatrix &,
+                                         const atlas::array::ArrayView<double, 2> &) const;
+  const InterpMatrix & interpMatrix(const atlas::Field &) const;
+
+  // Process-wide cache, shared by all interpolators for MODEL
+  std::string cacheKey(const std::string &, const uint64_t) const;
+  InterpMatrixPtr findCachedMatrix(const std::string &) const;
+  InterpMatrixPtr cacheMatrix(const std::string &, InterpMatrix &&) const;
+  bool readMatrix(const std::string &, InterpMatrix &) const;
+  void writeMatrix(const std::string &, const InterpMatrix &) const;
+  std::string cacheFileName(const std::string &) const;
+  static std::mutex & cacheMutex();
+  static std::unordered_map<std::string, InterpMatrixPtr> & cache();
 
   const Geometry_ & geom_;
   std::string interp_method_;
   int nninterp_;
   size_t nout_;
+  std::vector<size_t> allTargets_;     // 0, ..., nout_ - 1
+  uint64_t targetHash_;
+  bool useCache_;
+  std::string cacheDir_;
 
   // The interpolation matrices depend on the mask used at runtime. We cache the matrices as they
   // are computed, to save computations across multiple interpolations using the same mask.
-  // The caching is an implementation detail, so is done using a mutable member to preserve a
-  // const interpolation interface. This may break threadsafety!
-  mutable std::unordered_map<std::string, InterpMatrix> interp_matrices_;
+  // The caching is an implementation detail, so is done using a mutable member (guarded by a
+  // mutex so apply and applyAD can be called concurrently) to preserve a const interface.
+  // When the cache is enabled the matrices are also shared with other interpolators from the
+  // same local grid to the same target locations, and optionally saved to disk.
+  mutable std::unordered_map<std::string, InterpMatrixPtr> interp_matrices_;
+  mutable std::mutex mutex_;
   const std::string unmaskedName_{"unmasked"};
 };
 
@@ -126,10 +185,13 @@ UnstructuredInterpolator<MODEL>::UnstructuredInterpolator(const eckit::Configura
                                                           const Geometry_ & grid,
                                                           const std::vector<double> & lats_out,
                                                           const std::vector<double> & lons_out)
-  : geom_(grid), interp_method_(), nninterp_(0), nout_(0), interp_matrices_{}
+  : geom_(grid), interp_method_(), nninterp_(0), nout_(0), allTargets_(), targetHash_(0),
+    useCache_(false),
+    cacheDir_(), interp_matrices_{}
 {
   Log::trace() << "UnstructuredInterpolator::UnstructuredInterpolator start" << std::endl;
-  util::Timer timer("oops::UnstructuredInterpolator", "UnstructuredInterpolator");
+  static const util::TimerId timerId("oops::UnstructuredInterpolator", "UnstructuredInterpolator");
+  util::Timer timer(timerId);
 
   // This is a new option for this class, so isn't in any YAMLs yet!
   interp_method_ = config.getString("interpolation method", "barycentric");
@@ -137,10 +199,33 @@ UnstructuredInterpolator<MODEL>::UnstructuredInterpolator(const eckit::Configura
 
   ASSERT(lats_out.size() == lons_out.size());
   nout_ = lats_out.size();
+  allTargets_.resize(nout_);
+  for (size_t jloc = 0; jloc < nout_; ++jloc) allTargets_[jloc] = jloc;
 
   nninterp_ = config.getInt("nnearest", 4);
 
-  computeUnmaskedInterpMatrix(lats_out, lons_out);
+  // Sharing the interpolation matrices between interpolators is opt-in, as they are held until
+  // the end of the run (or until clearCache is called)
+  cacheDir_ = config.getString("interpolation matrix cache directory", "");
+  useCache_ = config.getBool("cache interpolation matrices", !cacheDir_.empty());
+  targetHash_ = util::hashValues(lons_out, util::hashValues(lats_out));
+
+  InterpMatrixPtr matrix;
+  std::string key;
+  if (useCache_) {
+    key = cacheKey(unmaskedName_, 0);
+    matrix = findCachedMatrix(key);
+  }
+  if (!matrix) {
+    InterpMatrix unmasked = computeUnmaskedInterpMatrix(lats_out, lons_out);
+    if (useCache_) {
+      matrix = cacheMatrix(key, std::move(unmasked));
+    } else {
+      matrix = std::make_shared<const InterpMatrix>(std::move(unmasked));
+    }
+  }
+  ASSERT(matrix->offsets.size() == nout_ + 1);
+  interp_matrices_.insert(std::make_pair(unmaskedName_, matrix));
 
   Log::trace() << "UnstructuredInterpolator::UnstructuredInterpolator done" << std::endl;
 }
@@ -151,8 +236,7 @@ template<typename MODEL>
 void UnstructuredInterpolator<MODEL>::apply(const Variables & vars, const State_ & xx,
                                             std::vector<double> & locvals) const
 {
-  std::vector<bool> target_mask(nout_, true);
-  this->apply(vars, xx.fieldSet(), target_mask, locvals);
+  this->apply(vars, xx.fieldSet(), allTargets_, locvals);
 }
 
 // -----------------------------------------------------------------------------
@@ -161,8 +245,7 @@ template<typename MODEL>
 void UnstructuredInterpolator<MODEL>::apply(const Variables & vars, const Increment_ & dx,
                                             std::vector<double> & locvals) const
 {
-  std::vector<bool> target_mask(nout_, true);
-  this->apply(vars, dx.fieldSet(), target_mask, locvals);
+  this->apply(vars, dx.fieldSet(), allTargets_, locvals);
 }
 
 // -----------------------------------------------------------------------------
@@ -170,8 +253,7 @@ void UnstructuredInterpolator<MODEL>::apply(const Variables & vars, const Increm
 template<typename MODEL>
 void UnstructuredInterpolator<MODEL>::applyAD(const Variables & vars, Increment_ & dx,
                                               const std::vector<double> & vals) const {
-  std::vector<bool> target_mask(nout_, true);
-  this->applyAD(vars, dx.fieldSet(), target_mask, vals);
+  this->applyAD(vars, dx.fieldSet(), allTargets_, vals);
 }
 
 // -----------------------------------------------------------------------------
@@ -180,8 +262,7 @@ template<typename MODEL>
 void UnstructuredInterpolator<MODEL>::apply(const Variables & vars, const atlas::FieldSet & fset,
                                             std::vector<double> & locvals) const
 {
-  std::vector<bool> target_mask(nout_, true);
-  this->apply(vars, fset, target_mask, locvals);
+  this->apply(vars, fset, allTargets_, locvals);
 }
 
 // -----------------------------------------------------------------------------
@@ -189,8 +270,7 @@ void UnstructuredInterpolator<MODEL>::apply(const Variables & vars, const atlas:
 template<typename MODEL>
 void UnstructuredInterpolator<MODEL>::applyAD(const Variables & vars, atlas::FieldSet & fset,
                                               const std::vector<double> & vals) const {
-  std::vector<bool> target_mask(nout_, true);
-  this->applyAD(vars, fset, target_mask, vals);
+  this->applyAD(vars, fset, allTargets_, vals);
 }
 
 // -----------------------------------------------------------------------------
@@ -229,10 +309,57 @@ template<typename MODEL>
 void UnstructuredInterpolator<MODEL>::apply(const Variables & vars, const atlas::FieldSet & fset,
                                             const std::vector<bool> & target_mask,
                                             std::vector<double> & vals) const {
-  Log::trace() << "UnstructuredInterpolator::apply starting" << std::endl;
-  util::Timer timer("oops::UnstructuredInterpolator", "apply");
+  this->apply(vars, fset, this->maskedTargets(target_mask), vals);
+}
 
-  ASSERT(target_mask.size() == nout_);
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void UnstructuredInterpolator<MODEL>::applyAD(const Variables & vars, atlas::FieldSet & fset,
+                                              const std::vector<bool> & target_mask,
+                                              const std::vector<double> & vals) const {
+  this->applyAD(vars, fset, this->maskedTargets(target_mask), vals);
+}
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void UnstructuredInterpolator<MODEL>::apply(const Variables & vars, const State_ & xx,
+                                            const std::vector<size_t> & targets,
+                                            std::vector<double> & locvals) const
+{
+  this->apply(vars, xx.fieldSet(), targets, locvals);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void UnstructuredInterpolator<MODEL>::apply(const Variables & vars, const Increment_ & dx,
+                                            const std::vector<size_t> & targets,
+                                            std::vector<double> & locvals) const
+{
+  this->apply(vars, dx.fieldSet(), targets, locvals);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void UnstructuredInterpolator<MODEL>::applyAD(const Variables & vars, Increment_ & dx,
+                                              const std::vector<size_t> & targets,
+                                              const std::vector<double> & vals) const {
+  this->applyAD(vars, dx.fieldSet(), targets, vals);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void UnstructuredInterpolator<MODEL>::apply(const Variables & vars, const atlas::FieldSet & fset,
+                                            const std::vector<size_t> & targets,
+                                            std::vector<double> & vals) const {
+  Log::trace() << "UnstructuredInterpolator::apply starting" << std::endl;
+  static const util::TimerId timerId("oops::UnstructuredInterpolator", "apply");
+  util::Timer timer(timerId);
 
   size_t nflds = 0;
   for (size_t jf = 0; jf < vars.size(); ++jf) {
@@ -246,35 +373,22 @@ void UnstructuredInterpolator<MODEL>::apply(const Variables & vars, const atlas:
     const std::string & fname = vars[jf];
     atlas::Field & fld = fset.field(fname);  // const in principle, but intel can't compile that
 
-    const std::string interp_type = fld.metadata().get<std::string>("interp_type");
-    ASSERT(interp_type == "default" || interp_type == "integer" || interp_type == "nearest");
-
-    // Mask is optional -- no metadata signals unmasked interpolation
-    // Warning: if the model code typoes the name of the metadata field "interp_source_point_mask",
-    // then the code below will silently skip the masking and proceed with unmasked interpolation.
-    // Requiring the mask metadata to be always present would increase robustness, but would require
-    // all models to adapt.
-    std::string maskName = unmaskedName_;
-    if (fld.metadata().has("interp_source_point_mask")) {
-      maskName = fld.metadata().get<std::string>("interp_source_point_mask");
-      ASSERT(geom_.hasMask(maskName));
-      const atlas::Field & source_mask_fld = geom_.getMask(maskName);
-      ASSERT(source_mask_fld.shape(0) == fld.shape(0));
-      ASSERT(source_mask_fld.shape(1) == 1);  // For now, support 2D masks only
-      const auto source_mask = atlas::array::make_view<double, 2>(source_mask_fld);
-
-      // Compute the masked interpolation matrix for this mask, if not previously done
-      if (interp_matrices_.find(maskName) == interp_matrices_.end()) {
-        computeMaskedInterpMatrix(maskName, source_mask);
-      }
-    }
+    const InterpType interp_type = interpType(fld.metadata().get<std::string>("interp_type"));
 
-    // Get interpolation matrix for this mask
-    const auto & interpMatrix = interp_matrices_.at(maskName);
+    // Get interpolation matrix for this field's mask
+    const InterpMatrix & interpMatrix = this->interpMatrix(fld);
 
     const atlas::array::ArrayView<double, 2> fldin = atlas::array::make_view<double, 2>(fld);
-    for (size_t jlev = 0; jlev < fldin.shape(1); ++jlev) {
-      this->applyPerLevel(interpMatrix, interp_type, target_mask, fldin, current, jlev);
+    switch (interp_type) {
+      case InterpType::Default:
+        this->template applyAllLevels<InterpType::Default>(interpMatrix, targets, fldin, current);
+        break;
+      case InterpType::Integer:
+        this->template applyAllLevels<InterpType::Integer>(interpMatrix, targets, fldin, current);
+        break;
+      case InterpType::Nearest:
+        this->template applyAllLevels<InterpType::Nearest>(interpMatrix, targets, fldin, current);
+        break;
     }
   }
   Log::trace() << "UnstructuredInterpolator::apply done" << std::endl;
@@ -284,45 +398,25 @@ void UnstructuredInterpolator<MODEL>::apply(const Variables & vars, const atlas:
 
 template<typename MODEL>
 void UnstructuredInterpolator<MODEL>::applyAD(const Variables & vars, atlas::FieldSet & fset,
-                                              const std::vector<bool> & target_mask,
+                                              const std::vector<size_t> & targets,
                                               const std::vector<double> & vals) const {
   Log::trace() << "UnstructuredInterpolator::applyAD starting" << std::endl;
-  util::Timer timer("oops::UnstructuredInterpolator", "applyAD");
-
-  ASSERT(target_mask.size() == nout_);
+  static const util::TimerId timerId("oops::UnstructuredInterpolator", "applyAD");
+  util::Timer timer(timerId);
 
   std::vector<double>::const_iterator current = vals.begin();
   for (size_t jf = 0; jf < vars.size(); ++jf) {
     const std::string & fname = vars[jf];
     atlas::Field & fld = fset.field(fname);
 
-//    const std::string interp_type = fld.metadata().get<std::string>("interp_type");
-//    ASSERT(interp_type == "default" || interp_type == "integer" || interp_type == "nearest");
-    const std::string interp_type = "default";
-
-    // Mask is optional -- no metadata signals unmasked interpolation
-    std::string maskName = unmaskedName_;
-    if (fld.metadata().has("interp_source_point_mask")) {
-      maskName = fld.metadata().get<std::string>("interp_source_point_mask");
-      ASSERT(geom_.hasMask(maskName));
-      const atlas::Field & source_mask_fld = geom_.getMask(maskName);
-      ASSERT(source_mask_fld.shape(0) == fld.shape(0));
-      ASSERT(source_mask_fld.shape(1) == 1);  // For now, support 2D masks only
-      const auto source_mask = atlas::array::make_view<double, 2>(source_mask_fld);
-
-      // Compute the masked interpolation matrix for this mask, if not previously done
-      if (interp_matrices_.find(maskName) == interp_matrices_.end()) {
-        computeMaskedInterpMatrix(maskName, source_mask);
-      }
-    }
+//    const InterpType interp_type = interpType(fld.metadata().get<std::string>("interp_type"));
+    const InterpType interp_type = InterpType::Default;
 
-    // Get interpolation matrix for this mask
-    const auto & interpMatrix = interp_matrices_.at(maskName);
+    // Get interpolation matrix for this field's mask
+    const InterpMatrix & interpMatrix = this->interpMatrix(fld);
 
     atlas::array::ArrayView<double, 2> fldin = atlas::array::make_view<double, 2>(fld);
-    for (size_t jlev = 0; jlev < fldin.shape(1); ++jlev) {
-      this->applyPerLevelAD(interpMatrix, interp_type, target_mask, fldin, current, jlev);
-    }
+    this->applyAllLevelsAD(interpMatrix, interp_type, targets, fldin, current);
   }
   Log::trace() << "UnstructuredInterpolator::applyAD done" << std::endl;
 }
@@ -330,106 +424,150 @@ void UnstructuredInterpolator<MODEL>::applyAD(const Variables & vars, atlas::Fie
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
-void UnstructuredInterpolator<MODEL>::applyPerLevel(
+std::vector<size_t> UnstructuredInterpolator<MODEL>::maskedTargets(
+    const std::vector<bool> & target_mask) const {
+  ASSERT(target_mask.size() == nout_);
+  std::vector<size_t> targets;
+  for (size_t jloc = 0; jloc < nout_; ++jloc) {
+    if (target_mask[jloc]) targets.push_back(jloc);
+  }
+  return targets;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+typename UnstructuredInterpolator<MODEL>::InterpType
+UnstructuredInterpolator<MODEL>::interpType(const std::string & interp_type) {
+  if (interp_type == "default") return InterpType::Default;
+  if (interp_type == "integer") return InterpType::Integer;
+  if (interp_type == "nearest") return InterpType::Nearest;
+  throw eckit::BadValue("Unknown interpolation type " + interp_type);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+template<typename UnstructuredInterpolator<MODEL>::InterpType TYPE>
+void UnstructuredInterpolator<MODEL>::applyAllLevels(
     const InterpMatrix & interpMatrix,
-    const std::string & interp_type,
-    const std::vector<bool> & target_mask,
+    const std::vector<size_t> & targets,
     const atlas::array::ArrayView<double, 2> & gridin,
-    std::vector<double>::iterator & gridout, const size_t & ilev) const {
-  for (size_t jloc = 0; jloc < nout_; ++jloc) {
-    if (target_mask[jloc]) {
-      *gridout = 0.0;
-
-      // Edge case: all source points for this stencil are masked out, return missingValue
-      if (!interpMatrix.targetHasValidStencil[jloc]) {
-        *gridout = util::missingValue(double());
-        ++gridout;
-        continue;
-      }
+    std::vector<double>::iterator & gridout) const {
+  // Output values are ordered level by level; each stencil is applied to all levels of the
+  // (point, level) ordered input field while its indices and weights are in cache.
+  const size_t nlevs = gridin.shape(1);
+  if (nout_ == 0 || nlevs == 0) return;
+  const double missing = util::missingValue(double());
+  double * out = &*gridout;
+  const size_t nout = nout_;
+  const int ntargets = targets.size();
+
+#pragma omp parallel for schedule(static)
+  for (int jt = 0; jt < ntargets; ++jt) {
+    const size_t jloc = targets[jt];
+
+    // Edge case: all source points for this stencil are masked out, return missingValue
+    if (!interpMatrix.targetHasValidStencil[jloc]) {
+      for (size_t jlev = 0; jlev < nlevs; ++jlev) out[jlev * nout + jloc] = missing;
+      continue;
+    }
 
-      const std::vector<size_t> & interp_is = interpMatrix.stencils[jloc];
-      const std::vector<double> & interp_ws = interpMatrix.weights[jloc];
+    const size_t * interp_is = interpMatrix.indices.data() + interpMatrix.offsets[jloc];
+    const double * interp_ws = interpMatrix.weights.data() + interpMatrix.offsets[jloc];
+    const size_t nn = interpMatrix.offsets[jloc + 1] - interpMatrix.offsets[jloc];
 
-      if (interp_type == "default") {
-        for (size_t jj = 0; jj < nninterp_; ++jj) {
-          *gridout += interp_ws[jj] * gridin(interp_is[jj], ilev);
+    if (TYPE == InterpType::Default) {
+      for (size_t jlev = 0; jlev < nlevs; ++jlev) {
+        double value = 0.0;
+        for (size_t jj = 0; jj < nn; ++jj) {
+          value += interp_ws[jj] * gridin(interp_is[jj], jlev);
         }
-      } else if (interp_type == "integer") {
-        // Find which integer value has largest weight in the stencil. We do this by taking two
-        // passes through the (usually short) data: first to identify range of values, then to
-        // determine weights for each integer.
-        // Note that a std::map would be shorter to code, because it would avoid needing to find
-        // the range of possible integer values, but vectors are almost always much more efficient.
+        out[jlev * nout + jloc] = value;
+      }
+    } else if (TYPE == InterpType::Integer) {
+      // Find which integer value has largest weight in the stencil. We do this by taking two
+      // passes through the (usually short) data: first to identify range of values, then to
+      // determine weights for each integer.
+      // Note that a std::map would be shorter to code, because it would avoid needing to find
+      // the range of possible integer values, but vectors are almost always much more efficient.
+      std::vector<double> int_weights;
+      for (size_t jlev = 0; jlev < nlevs; ++jlev) {
         int minval = std::numeric_limits<int>().max();
         int maxval = std::numeric_limits<int>().min();
-        for (size_t jj = 0; jj < nninterp_; ++jj) {
-          minval = std::min(minval, static_cast<int>(std::round(gridin(interp_is[jj], ilev))));
-          maxval = std::max(maxval, static_cast<int>(std::round(gridin(interp_is[jj], ilev))));
+        for (size_t jj = 0; jj < nn; ++jj) {
+          minval = std::min(minval, static_cast<int>(std::round(gridin(interp_is[jj], jlev))));
+          maxval = std::max(maxval, static_cast<int>(std::round(gridin(interp_is[jj], jlev))));
         }
-        std::vector<double> int_weights(maxval - minval + 1, 0.0);
-        for (size_t jj = 0; jj < nninterp_; ++jj) {
-          const int this_int = std::round(gridin(interp_is[jj], ilev));
+        int_weights.assign(maxval - minval + 1, 0.0);
+        for (size_t jj = 0; jj < nn; ++jj) {
+          const int this_int = std::round(gridin(interp_is[jj], jlev));
           int_weights[this_int - minval] += interp_ws[jj];
         }
-        *gridout = minval + std::distance(int_weights.begin(),
+        out[jlev * nout + jloc] = minval + std::distance(int_weights.begin(),
             std::max_element(int_weights.begin(), int_weights.end()));
-      } else if (interp_type == "nearest") {
-        // Return value from closest unmasked source point
-        for (size_t jj = 0; jj < nninterp_; ++jj) {
-          if (interp_ws[jj] > 1.0e-9) {  // use a small tolerance to allow for roundoff in weights
-            *gridout = gridin(interp_is[jj], ilev);
-            break;
+      }
+    } else {
+      // Return value from closest unmasked source point
+      for (size_t jlev = 0; jlev < nlevs; ++jlev) out[jlev * nout + jloc] = 0.0;
+      for (size_t jj = 0; jj < nn; ++jj) {
+        if (interp_ws[jj] > 1.0e-9) {  // use a small tolerance to allow for roundoff in weights
+          for (size_t jlev = 0; jlev < nlevs; ++jlev) {
+            out[jlev * nout + jloc] = gridin(interp_is[jj], jlev);
           }
+          break;
         }
-      } else {
-        throw eckit::BadValue("Unknown interpolation type");
       }
     }
-    ++gridout;
   }
+  gridout += nlevs * nout_;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
-void UnstructuredInterpolator<MODEL>::applyPerLevelAD(
+void UnstructuredInterpolator<MODEL>::applyAllLevelsAD(
     const InterpMatrix & interpMatrix,
-    const std::string & interp_type,
-    const std::vector<bool> & target_mask,
+    const InterpType interp_type,
+    const std::vector<size_t> & targets,
     atlas::array::ArrayView<double, 2> & gridin,
-    std::vector<double>::const_iterator & gridout,
-    const size_t & ilev) const {
-  for (size_t jloc = 0; jloc < nout_; ++jloc) {
-    if (target_mask[jloc]) {
-      // (Adjoint of) All source points for this stencil are masked out, return missingValue
-      if (!interpMatrix.targetHasValidStencil[jloc]) {
-        ++gridout;
-        continue;
-      }
-
-      const std::vector<size_t> & interp_is = interpMatrix.stencils[jloc];
-      const std::vector<double> & interp_ws = interpMatrix.weights[jloc];
-
-      if (interp_type == "default") {
-        for (size_t jj = 0; jj < nninterp_; ++jj) {
-          gridin(interp_is[jj], ilev) += interp_ws[jj] * *gridout;
+    std::vector<double>::const_iterator & gridout) const {
+  // Serial loop: different target points can share source points
+  if (interp_type == InterpType::Integer) {
+    throw eckit::BadValue("No adjoint for integer interpolation");
+  }
+  const size_t nlevs = gridin.shape(1);
+  if (nout_ == 0 || nlevs == 0) return;
+  const double * out = &*gridout;
+
+  for (const size_t jloc : targets) {
+    ASSERT(jloc < nout_);
+    // (Adjoint of) All source points for this stencil are masked out, return missingValue
+    if (!interpMatrix.targetHasValidStencil[jloc]) continue;
+
+    const size_t * interp_is = interpMatrix.indices.data() + interpMatrix.offsets[jloc];
+    const double * interp_ws = interpMatrix.weights.data() + interpMatrix.offsets[jloc];
+    const size_t nn = interpMatrix.offsets[jloc + 1] - interpMatrix.offsets[jloc];
+
+    if (interp_type == InterpType::Default) {
+      for (size_t jj = 0; jj < nn; ++jj) {
+        for (size_t jlev = 0; jlev < nlevs; ++jlev) {
+          gridin(interp_is[jj], jlev) += interp_ws[jj] * out[jlev * nout_ + jloc];
         }
-      } else if (interp_type == "integer") {
-        throw eckit::BadValue("No adjoint for integer interpolation");
-      } else if (interp_type == "nearest") {
-        // (Adjoint of) Return value from closest unmasked source point
-        for (size_t jj = 0; jj < nninterp_; ++jj) {
-          if (interp_ws[jj] > 1.0e-9) {  // use a small tolerance to allow for roundoff in weights
-            gridin(interp_is[jj], ilev) += *gridout;
-            break;
+      }
+    } else {
+      // (Adjoint of) Return value from closest unmasked source point
+      for (size_t jj = 0; jj < nn; ++jj) {
+        if (interp_ws[jj] > 1.0e-9) {  // use a small tolerance to allow for roundoff in weights
+          for (size_t jlev = 0; jlev < nlevs; ++jlev) {
+            gridin(interp_is[jj], jlev) += out[jlev * nout_ + jloc];
           }
+          break;
         }
-      } else {
-        throw eckit::BadValue("Unknown interpolation type");
       }
     }
-    ++gridout;
   }
+  gridout += nlevs * nout_;
 }
 
 // -----------------------------------------------------------------------------
@@ -511,18 +649,19 @@ void UnstructuredInterpolator<MODEL>::print(std::ostream & os) const
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
-void UnstructuredInterpolator<MODEL>::computeUnmaskedInterpMatrix(
-    std::vector<double> lats_out,
-    std::vector<double> lons_out) const {
-  // Check matrix hasn't already been set
-  ASSERT(interp_matrices_.find(unmaskedName_) == interp_matrices_.end());
+typename UnstructuredInterpolator<MODEL>::InterpMatrix
+UnstructuredInterpolator<MODEL>::computeUnmaskedInterpMatrix(
+    const std::vector<double> & lats_out,
+    const std::vector<double> & lons_out) const {
+  static const util::TimerId timerId("oops::UnstructuredInterpolator",
+                                     "computeUnmaskedInterpMatrix");
+  util::Timer timer(timerId);
 
   // Compute interpolation matrix with no source-point mask
-  interp_matrices_.insert(
-      std::make_pair(unmaskedName_, InterpMatrix{
-        std::vector<bool>(nout_, true),
-        std::vector<std::vector<size_t>>(nout_, std::vector<size_t>(nninterp_)),
-        std::vector<std::vector<double>>(nout_, std::vector<double>(nninterp_, 0.0))}));
+  InterpMatrix matrix{std::vector<bool>(nout_, true), std::vector<size_t>(nout_ + 1),
+                      std::vector<size_t>(nout_ * nninterp_),
+                      std::vector<double>(nout_ * nninterp_, 0.0)};
+  for (size_t jloc = 0; jloc <= nout_; ++jloc) matrix.offsets[jloc] = jloc * nninterp_;
 
   const atlas::Geometry earth(atlas::util::Earth::radius());
   const double close = 1.0e-10;
@@ -531,8 +670,8 @@ void UnstructuredInterpolator<MODEL>::computeUnmaskedInterpMatrix(
     const atlas::util::KDTree<size_t>::ValueList neighbours =
                           geom_.closestPoints(lats_out[jloc], lons_out[jloc], nninterp_);
 
-    std::vector<size_t> & interp_is = interp_matrices_.at(unmaskedName_).stencils[jloc];
-    std::vector<double> & interp_ws = interp_matrices_.at(unmaskedName_).weights[jloc];
+    size_t * interp_is = matrix.indices.data() + matrix.offsets[jloc];
+    double * interp_ws = matrix.weights.data() + matrix.offsets[jloc];
 
     // Barycentric and inverse-distance interpolation both rely on indices, 1/distances
     size_t jj = 0;
@@ -580,44 +719,250 @@ void UnstructuredInterpolator<MODEL>::computeUnmaskedInterpMatrix(
       }
     }
   }
+  return matrix;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
-void UnstructuredInterpolator<MODEL>::computeMaskedInterpMatrix(
-    const std::string & maskName,
+typename UnstructuredInterpolator<MODEL>::InterpMatrix
+UnstructuredInterpolator<MODEL>::computeMaskedInterpMatrix(
+    const InterpMatrix & unmasked,
     const atlas::array::ArrayView<double, 2> & source_mask) const
 {
-  // Check unmasked matrix is already computed
-  ASSERT(interp_matrices_.find(unmaskedName_) != interp_matrices_.end());
-  // Check matrix hasn't already been computed for this mask
-  ASSERT(interp_matrices_.find(maskName) == interp_matrices_.end());
+  static const util::TimerId timerId("oops::UnstructuredInterpolator", "computeMaskedInterpMatrix");
+  util::Timer timer(timerId);
 
   // Copy unmasked matrix, then modify it below
-  interp_matrices_[maskName] = interp_matrices_[unmaskedName_];
-
+  InterpMatrix matrix = unmasked;
   for (size_t jloc = 0; jloc < nout_; ++jloc) {
-    std::vector<size_t> & interp_is = interp_matrices_[maskName].stencils[jloc];
-    std::vector<double> & interp_ws = interp_matrices_[maskName].weights[jloc];
+    const size_t * interp_is = matrix.indices.data() + matrix.offsets[jloc];
+    double * interp_ws = matrix.weights.data() + matrix.offsets[jloc];
+    const size_t nn = matrix.offsets[jloc + 1] - matrix.offsets[jloc];
 
     // Sum up mask weights, will be used to renormalize interpolation weights
     double normalization = 0.0;
-    for (size_t jj = 0; jj < nninterp_; ++jj) {
+    for (size_t jj = 0; jj < nn; ++jj) {
       ASSERT(source_mask(interp_is[jj], 0) >= 0.0 && source_mask(interp_is[jj], 0) <= 1.0);
       normalization += interp_ws[jj] * source_mask(interp_is[jj], 0);
     }
 
     if (normalization <= 1e-9) {
       // Edge case: all source points are masked out, so can't interpolate to this target point
-      interp_matrices_[maskName].targetHasValidStencil[jloc] = false;
+      matrix.targetHasValidStencil[jloc] = false;
     } else {
       // Standard case: renormalize
-      for (size_t jj = 0; jj < nninterp_; ++jj) {
+      for (size_t jj = 0; jj < nn; ++jj) {
         interp_ws[jj] *= source_mask(interp_is[jj], 0) / normalization;
       }
     }
   }
+  return matrix;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+const typename UnstructuredInterpolator<MODEL>::InterpMatrix &
+UnstructuredInterpolator<MODEL>::interpMatrix(const atlas::Field & fld) const {
+  // Mask is optional -- no metadata signals unmasked interpolation
+  // Warning: if the model code typoes the name of the metadata field "interp_source_point_mask",
+  // then the code below will silently skip the masking and proceed with unmasked interpolation.
+  // Requiring the mask metadata to be always present would increase robustness, but would require
+  // all models to adapt.
+  std::string maskName = unmaskedName_;
+  if (fld.metadata().has("interp_source_point_mask")) {
+    maskName = fld.metadata().get<std::string>("interp_source_point_mask");
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto it = interp_matrices_.find(maskName);
+  if (it != interp_matrices_.end()) return *it->second;
+
+  // Compute the masked interpolation matrix for this mask, as not previously done
+  ASSERT(geom_.hasMask(maskName));
+  const atlas::Field & source_mask_fld = geom_.getMask(maskName);
+  ASSERT(source_mask_fld.shape(0) == fld.shape(0));
+  ASSERT(source_mask_fld.shape(1) == 1);  // For now, support 2D masks only
+  const auto source_mask = atlas::array::make_view<double, 2>(source_mask_fld);
+
+  InterpMatrixPtr matrix;
+  std::string key;
+  if (useCache_) {
+    // The mask values are part of the key: masks can change, e.g. with the model state
+    std::vector<double> values(source_mask.shape(0));
+    for (size_t jj = 0; jj < values.size(); ++jj) values[jj] = source_mask(jj, 0);
+    key = cacheKey(maskName, util::hashValues(values));
+    matrix = findCachedMatrix(key);
+  }
+  if (!matrix) {
+    InterpMatrix masked = computeMaskedInterpMatrix(*interp_matrices_.at(unmaskedName_),
+                                                    source_mask);
+    if (useCache_) {
+      matrix = cacheMatrix(key, std::move(masked));
+    } else {
+      matrix = std::make_shared<const InterpMatrix>(std::move(masked));
+    }
+  }
+  interp_matrices_.insert(std::make_pair(maskName, matrix));
+  return *matrix;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+std::string UnstructuredInterpolator<MODEL>::cacheKey(const std::string & maskName,
+                                                      const uint64_t maskHash) const {
+  std::ostringstream key;
+  key << MODEL::name() << ":" << std::hex << geom_.localGridHash() << ":" << targetHash_
+      << std::dec << ":" << nout_ << ":" << interp_method_ << ":" << nninterp_
+      << ":" << maskName << ":" << std::hex << maskHash;
+  return key.str();
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+typename UnstructuredInterpolator<MODEL>::InterpMatrixPtr
+UnstructuredInterpolator<MODEL>::findCachedMatrix(const std::string & key) const {
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex());
+    const auto it = cache().find(key);
+    if (it != cache().end()) {
+      Log::debug() << "UnstructuredInterpolator reusing matrix " << key << std::endl;
+      return it->second;
+    }
+  }
+  InterpMatrix matrix;
+  if (!cacheDir_.empty() && readMatrix(key, matrix)) {
+    Log::debug() << "UnstructuredInterpolator read matrix " << key << std::endl;
+    std::lock_guard<std::mutex> lock(cacheMutex());
+    return cache().emplace(key, std::make_shared<const InterpMatrix>(std::move(matrix)))
+                  .first->second;
+  }
+  return InterpMatrixPtr();
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+typename UnstructuredInterpolator<MODEL>::InterpMatrixPtr
+UnstructuredInterpolator<MODEL>::cacheMatrix(const std::string & key,
+                                             InterpMatrix && matrix) const {
+  // Matrices are computed outside the lock; if another thread cached the same matrix in the
+  // meantime, the first one in is kept (they are identical)
+  InterpMatrixPtr ptr = std::make_shared<const InterpMatrix>(std::move(matrix));
+  bool inserted = false;
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex());
+    const auto res = cache().emplace(key, ptr);
+    ptr = res.first->second;
+    inserted = res.second;
+  }
+  if (inserted && !cacheDir_.empty()) writeMatrix(key, *ptr);
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+std::string UnstructuredInterpolator<MODEL>::cacheFileName(const std::string & key) const {
+  std::ostringstream fname;
+  fname << cacheDir_ << "/interp_matrix_" << std::hex << std::setw(16) << std::setfill('0')
+        << util::hashValues(key) << ".bin";
+  return fname.str();
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+bool UnstructuredInterpolator<MODEL>::readMatrix(const std::string & key,
+                                                 InterpMatrix & matrix) const {
+  std::ifstream in(cacheFileName(key), std::ios::binary);
+  if (!in) return false;
+
+  // The file starts with the full key, to guard against hash collisions
+  size_t len = 0;
+  in.read(reinterpret_cast<char *>(&len), sizeof(len));
+  if (!in || len != key.size()) return false;
+  std::string stored(len, ' ');
+  in.read(&stored[0], len);
+  if (!in || stored != key) return false;
+
+  size_t nout = 0;
+  size_t nnz = 0;
+  in.read(reinterpret_cast<char *>(&nout), sizeof(nout));
+  in.read(reinterpret_cast<char *>(&nnz), sizeof(nnz));
+  if (!in || nout != nout_) return false;
+
+  std::vector<char> valid(nout);
+  matrix.offsets.resize(nout + 1);
+  matrix.indices.resize(nnz);
+  matrix.weights.resize(nnz);
+  in.read(valid.data(), nout);
+  in.read(reinterpret_cast<char *>(matrix.offsets.data()), (nout + 1) * sizeof(size_t));
+  in.read(reinterpret_cast<char *>(matrix.indices.data()), nnz * sizeof(size_t));
+  in.read(reinterpret_cast<char *>(matrix.weights.data()), nnz * sizeof(double));
+  if (!in || matrix.offsets[nout] != nnz) return false;
+  matrix.targetHasValidStencil.assign(valid.begin(), valid.end());
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void UnstructuredInterpolator<MODEL>::writeMatrix(const std::string & key,
+                                                  const InterpMatrix & matrix) const {
+  const std::string fname = cacheFileName(key);
+  // Several tasks may write the same matrix: write to a task-specific file then rename it,
+  // so readers never see a partially written file
+  const std::string tmpname = fname + "." + std::to_string(oops::mpi::world().rank()) + ".tmp";
+  eckit::PathName(cacheDir_).mkdir();
+  {
+    std::ofstream out(tmpname, std::ios::binary);
+    if (!out) {
+      Log::warning() << "UnstructuredInterpolator cannot write " << tmpname << std::endl;
+      return;
+    }
+    const size_t nnz = matrix.indices.size();
+    const std::vector<char> valid(matrix.targetHasValidStencil.begin(),
+                                  matrix.targetHasValidStencil.end());
+    const size_t len = key.size();
+    out.write(reinterpret_cast<const char *>(&len), sizeof(len));
+    out.write(key.data(), len);
+    out.write(reinterpret_cast<const char *>(&nout_), sizeof(nout_));
+    out.write(reinterpret_cast<const char *>(&nnz), sizeof(nnz));
+    out.write(valid.data(), nout_);
+    out.write(reinterpret_cast<const char *>(matrix.offsets.data()), (nout_ + 1) * sizeof(size_t));
+    out.write(reinterpret_cast<const char *>(matrix.indices.data()), nnz * sizeof(size_t));
+    out.write(reinterpret_cast<const char *>(matrix.weights.data()), nnz * sizeof(double));
+  }
+  std::rename(tmpname.c_str(), fname.c_str());
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+std::mutex & UnstructuredInterpolator<MODEL>::cacheMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+std::unordered_map<std::string, typename UnstructuredInterpolator<MODEL>::InterpMatrixPtr> &
+UnstructuredInterpolator<MODEL>::cache() {
+  static std::unordered_map<std::string, InterpMatrixPtr> matrices;
+  return matrices;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void UnstructuredInterpolator<MODEL>::clearCache() {
+  std::lock_guard<std::mutex> lock(cacheMutex());
+  cache().clear();
 }
 
 // -----------------------------------------------------------------------------
@@ -335,12 +335,14 @@ Eigen::MatrixXd VerticalLocEV<MODEL>::modulateIncrement(
                                   const GeometryIterator_ & gi,
                                   size_t itime) const {
   // modulate an increment at grid point
+  // (called from the threads of GETKFSolver: the MODEL::Increment methods are called directly)
+  const IncrementEnsemble_ & sqrtVertLoc = *sqrtVertLoc_;
 
   oops::Variables vars = incrs[0][0].variables();
   size_t nv = 0;
   std::vector<double> EvecRepl;
   if (EVsStoredAs3D_) {
-    nv = (*sqrtVertLoc_)[0].getLocal(gi).getVals().size();
+    nv = sqrtVertLoc[0].increment().getLocal(gi.geometryiter()).getVals().size();
   } else {
     EvecRepl = replicateEigenVector(vars, 0);
     nv = EvecRepl.size();
@@ -351,10 +353,10 @@ Eigen::MatrixXd VerticalLocEV<MODEL>::modulateIncrement(
 
   size_t ii = 0;
   for (size_t iens=0; iens < nens; ++iens) {
-    etmp2 =  incrs[iens][itime].getLocal(gi).getVals();
+    etmp2 =  incrs[iens][itime].increment().getLocal(gi.geometryiter()).getVals();
     for (size_t ieig=0; ieig < neig_; ++ieig) {
       if (EVsStoredAs3D_) {
-        EvecRepl = (*sqrtVertLoc_)[ieig].getLocal(gi).getVals();
+        EvecRepl = sqrtVertLoc[ieig].increment().getLocal(gi.geometryiter()).getVals();
       } else {
         EvecRepl = replicateEigenVector(vars, ieig);
       }
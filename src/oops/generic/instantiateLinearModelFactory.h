@@ -8,6 +8,7 @@
 #ifndef OOPS_GENERIC_INSTANTIATELINEARMODELFACTORY_H_
 #define OOPS_GENERIC_INSTANTIATELINEARMODELFACTORY_H_
 
+#include "oops/generic/CheckpointedLinearModel.h"
 #include "oops/generic/HybridLinearModel.h"
 #include "oops/generic/IdentityLinearModel.h"
 #include "oops/generic/LinearModelBase.h"
@@ -19,6 +20,8 @@ namespace oops {
 template <typename MODEL> void instantiateLinearModelFactory() {
   static LinearModelMaker<MODEL, IdentityLinearModel<MODEL> > makerIdentityLinearModel_("Identity");
   static LinearModelMaker<MODEL, HybridLinearModel<MODEL> > makerHybridTangentLinearModel_("HTLM");
+  static LinearModelMaker<MODEL, CheckpointedLinearModel<MODEL> >
+    makerCheckpointedLinearModel_("Checkpointed");
 }
 
 }  // namespace oops
@@ -88,7 +88,8 @@ ErrorCovariance<MODEL>::ErrorCovariance(const Geometry_ & resol, const Variables
   : ModelSpaceCovarianceBase<MODEL>(resol, parameters, xb, fg), covariance_()
 {
   Log::trace() << "ErrorCovariance<MODEL>::ErrorCovariance starting" << std::endl;
-  util::Timer timer(classname(), "ErrorCovariance");
+  static const util::TimerId timerId(classname(), "ErrorCovariance");
+  util::Timer timer(timerId);
   size_t init = eckit::system::ResourceUsage().maxResidentSetSize();
   covariance_.reset(new Covariance_(resol.geometry(), vars,
                                     parametersOrConfiguration<HasParameters_<Covariance_>::value>(
@@ -115,7 +116,8 @@ ErrorCovariance<MODEL>::ErrorCovariance(const Geometry_ & resol, const Variables
 template<typename MODEL>
 ErrorCovariance<MODEL>::~ErrorCovariance() {
   Log::trace() << "ErrorCovariance<MODEL>::~ErrorCovariance starting" << std::endl;
-  util::Timer timer(classname(), "~ErrorCovariance");
+  static const util::TimerId timerId(classname(), "~ErrorCovariance");
+  util::Timer timer(timerId);
   covariance_.reset();
   Log::trace() << "ErrorCovariance<MODEL>::~ErrorCovariance done" << std::endl;
 }
@@ -125,7 +127,8 @@ ErrorCovariance<MODEL>::~ErrorCovariance() {
 template<typename MODEL>
 void ErrorCovariance<MODEL>::doRandomize(Increment_ & dx) const {
   Log::trace() << "ErrorCovariance<MODEL>::doRandomize starting" << std::endl;
-  util::Timer timer(classname(), "doRandomize");
+  static const util::TimerId timerId(classname(), "doRandomize");
+  util::Timer timer(timerId);
   covariance_->randomize(dx.increment());
   Log::trace() << "ErrorCovariance<MODEL>::doRandomize done" << std::endl;
 }
@@ -135,7 +138,8 @@ void ErrorCovariance<MODEL>::doRandomize(Increment_ & dx) const {
 template<typename MODEL>
 void ErrorCovariance<MODEL>::doMultiply(const Increment_ & dx1, Increment_ & dx2) const {
   Log::trace() << "ErrorCovariance<MODEL>::doMultiply starting" << std::endl;
-  util::Timer timer(classname(), "doMultiply");
+  static const util::TimerId timerId(classname(), "doMultiply");
+  util::Timer timer(timerId);
   covariance_->multiply(dx1.increment(), dx2.increment());
   Log::trace() << "ErrorCovariance<MODEL>::doMultiply done" << std::endl;
 }
@@ -145,7 +149,8 @@ void ErrorCovariance<MODEL>::doMultiply(const Increment_ & dx1, Increment_ & dx2
 template<typename MODEL>
 void ErrorCovariance<MODEL>::doInverseMultiply(const Increment_ & dx1, Increment_ & dx2) const {
   Log::trace() << "ErrorCovariance<MODEL>::doInverseMultiply starting" << std::endl;
-  util::Timer timer(classname(), "doInverseMultiply");
+  static const util::TimerId timerId(classname(), "doInverseMultiply");
+  util::Timer timer(timerId);
   covariance_->inverseMultiply(dx1.increment(), dx2.increment());
   Log::trace() << "ErrorCovariance<MODEL>::doInverseMultiply done" << std::endl;
 }
@@ -155,7 +160,8 @@ void ErrorCovariance<MODEL>::doInverseMultiply(const Increment_ & dx1, Increment
 template<typename MODEL>
 void ErrorCovariance<MODEL>::print(std::ostream & os) const {
   Log::trace() << "ErrorCovariance<MODEL>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *covariance_;
   Log::trace() << "ErrorCovariance<MODEL>::print done" << std::endl;
 }
@@ -80,7 +80,8 @@ template <typename OBS>
 GeoVaLs<OBS>::GeoVaLs(const Locations_ & locs, const Variables & vars,
                       const std::vector<size_t> & sizes) : gvals_() {
   Log::trace() << "GeoVaLs<OBS>::GeoVaLs starting" << std::endl;
-  util::Timer timer(classname(), "GeoVaLs");
+  static const util::TimerId timerId(classname(), "GeoVaLs");
+  util::Timer timer(timerId);
   gvals_.reset(new GeoVaLs_(locs.locations(), vars, sizes));
   Log::trace() << "GeoVaLs<OBS>::GeoVaLs done" << std::endl;
 }
@@ -92,7 +93,8 @@ template <typename OBS>
                         const ObsSpace_ & ospace, const Variables & vars)
   : gvals_() {
   Log::trace() << "GeoVaLs<OBS>::GeoVaLs read starting" << std::endl;
-  util::Timer timer(classname(), "GeoVaLs");
+  static const util::TimerId timerId(classname(), "GeoVaLs");
+  util::Timer timer(timerId);
   gvals_.reset(new GeoVaLs_(params, ospace.obsspace(), vars));
   Log::trace() << "GeoVaLs<OBS>::GeoVaLs read done" << std::endl;
 }
@@ -102,7 +104,8 @@ template <typename OBS>
 template <typename OBS>
 GeoVaLs<OBS>::GeoVaLs(const GeoVaLs & other): gvals_() {
   Log::trace() << "GeoVaLs<OBS>::GeoVaLs starting" << std::endl;
-  util::Timer timer(classname(), "GeoVaLs");
+  static const util::TimerId timerId(classname(), "GeoVaLs");
+  util::Timer timer(timerId);
   gvals_.reset(new GeoVaLs_(*other.gvals_));
   Log::trace() << "ObsVector<OBS>::GeoVaLs done" << std::endl;
 }
@@ -112,7 +115,8 @@ GeoVaLs<OBS>::GeoVaLs(const GeoVaLs & other): gvals_() {
 template <typename OBS>
 GeoVaLs<OBS>::~GeoVaLs() {
   Log::trace() << "GeoVaLs<OBS>::~GeoVaLs starting" << std::endl;
-  util::Timer timer(classname(), "~GeoVaLs");
+  static const util::TimerId timerId(classname(), "~GeoVaLs");
+  util::Timer timer(timerId);
   gvals_.reset();
   Log::trace() << "GeoVaLs<OBS>::~GeoVaLs done" << std::endl;
 }
@@ -122,7 +126,8 @@ GeoVaLs<OBS>::~GeoVaLs() {
 template <typename OBS>
 double GeoVaLs<OBS>::dot_product_with(const GeoVaLs & other) const {
   Log::trace() << "GeoVaLs<OBS>::dot_product_with starting" << std::endl;
-  util::Timer timer(classname(), "dot_product_with");
+  static const util::TimerId timerId(classname(), "dot_product_with");
+  util::Timer timer(timerId);
   double zz = gvals_->dot_product_with(*other.gvals_);
   Log::trace() << "GeoVaLs<OBS>::dot_product_with done" << std::endl;
   return zz;
@@ -133,7 +138,8 @@ double GeoVaLs<OBS>::dot_product_with(const GeoVaLs & other) const {
 template <typename OBS>
 GeoVaLs<OBS> & GeoVaLs<OBS>::operator=(const GeoVaLs & rhs) {
   Log::trace() << "GeoVaLs<OBS>::operator= starting" << std::endl;
-  util::Timer timer(classname(), "operator=");
+  static const util::TimerId timerId(classname(), "operator=");
+  util::Timer timer(timerId);
   *gvals_ = *rhs.gvals_;
   Log::trace() << "GeovaLs<OBS>::operator= done" << std::endl;
   return *this;
@@ -144,7 +150,8 @@ GeoVaLs<OBS> & GeoVaLs<OBS>::operator=(const GeoVaLs & rhs) {
 template <typename OBS>
 GeoVaLs<OBS> & GeoVaLs<OBS>::operator+=(const GeoVaLs & rhs) {
   Log::trace() << "GeoVaLs<OBS>::+=(GeoVaLs, GeoVaLs) starting" << std::endl;
-  util::Timer timer(classname(), "operator+=");
+  static const util::TimerId timerId(classname(), "operator+=");
+  util::Timer timer(timerId);
   *gvals_ += *rhs.gvals_;
   Log::trace() << "GeoVaLs<OBS>::+= done" << std::endl;
   return *this;
@@ -155,7 +162,8 @@ GeoVaLs<OBS> & GeoVaLs<OBS>::operator+=(const GeoVaLs & rhs) {
 template <typename OBS>
 GeoVaLs<OBS> & GeoVaLs<OBS>::operator-=(const GeoVaLs & rhs) {
   Log::trace() << "GeoVaLs<OBS>::-=(GeoVaLs, GeoVaLs) starting" << std::endl;
-  util::Timer timer(classname(), "operator-=");
+  static const util::TimerId timerId(classname(), "operator-=");
+  util::Timer timer(timerId);
   *gvals_ -= *rhs.gvals_;
   Log::trace() << "GeoVaLs<OBS>::-= done" << std::endl;
   return *this;
@@ -166,7 +174,8 @@ GeoVaLs<OBS> & GeoVaLs<OBS>::operator-=(const GeoVaLs & rhs) {
 template <typename OBS>
 GeoVaLs<OBS> & GeoVaLs<OBS>::operator*=(const GeoVaLs & rhs) {
   Log::trace() << "GeoVaLs<OBS>::*=(GeoVaLs, GeoVaLs) starting" << std::endl;
-  util::Timer timer(classname(), "operator*=(schur)");
+  static const util::TimerId timerId(classname(), "operator*=(schur)");
+  util::Timer timer(timerId);
   *gvals_ *= *rhs.gvals_;
   Log::trace() << "GeoVaLs<OBS>::*= done" << std::endl;
   return *this;
@@ -177,7 +186,8 @@ GeoVaLs<OBS> & GeoVaLs<OBS>::operator*=(const GeoVaLs & rhs) {
 template<typename OBS>
 GeoVaLs<OBS> & GeoVaLs<OBS>::operator*=(const double & zz) {
   Log::trace() << "GeoVaLs<OBS>::operator*= starting" << std::endl;
-  util::Timer timer(classname(), "operator*=");
+  static const util::TimerId timerId(classname(), "operator*=");
+  util::Timer timer(timerId);
   *gvals_ *= zz;
   Log::trace() << "GeoVaLs<OBS>::operator*= done" << std::endl;
   return *this;
@@ -188,7 +198,8 @@ GeoVaLs<OBS> & GeoVaLs<OBS>::operator*=(const double & zz) {
 template <typename OBS>
 double GeoVaLs<OBS>::rms() const {
   Log::trace() << "GeoVaLs<OBS>::rms starting" << std::endl;
-  util::Timer timer(classname(), "rms");
+  static const util::TimerId timerId(classname(), "rms");
+  util::Timer timer(timerId);
   double zz = gvals_->rms();
   Log::trace() << "GeoVaLs<OBS>::rms done" << std::endl;
   return zz;
@@ -199,7 +210,8 @@ double GeoVaLs<OBS>::rms() const {
 template <typename OBS>
 double GeoVaLs<OBS>::normalizedrms(const GeoVaLs & rhs) const {
   Log::trace() << "GeoVaLs<OBS>::normalizedrms starting" << std::endl;
-  util::Timer timer(classname(), "normalizedrms");
+  static const util::TimerId timerId(classname(), "normalizedrms");
+  util::Timer timer(timerId);
   double zz = gvals_->normalizedrms(*rhs.gvals_);
   Log::trace() << "GeoVaLs<OBS>::normalizedrms done" << std::endl;
   return zz;
@@ -210,7 +222,8 @@ double GeoVaLs<OBS>::normalizedrms(const GeoVaLs & rhs) const {
 template <typename OBS>
 void GeoVaLs<OBS>::zero() {
   Log::trace() << "GeoVaLs<OBS>::zero starting" << std::endl;
-  util::Timer timer(classname(), "zero");
+  static const util::TimerId timerId(classname(), "zero");
+  util::Timer timer(timerId);
   gvals_->zero();
   Log::trace() << "GeoVaLs<OBS>::zero done" << std::endl;
 }
@@ -220,7 +233,8 @@ void GeoVaLs<OBS>::zero() {
 template <typename OBS>
 void GeoVaLs<OBS>::random() {
   Log::trace() << "GeoVaLs<OBS>::random starting" << std::endl;
-  util::Timer timer(classname(), "random");
+  static const util::TimerId timerId(classname(), "random");
+  util::Timer timer(timerId);
   gvals_->random();
   Log::trace() << "GeoVaLs<OBS>::random done" << std::endl;
 }
@@ -231,7 +245,8 @@ template <typename OBS>
 void GeoVaLs<OBS>::fill(const std::vector<size_t> & indx,
                         const std::vector<double> & vals, const bool levelsTopDown) {
   Log::trace() << "GeoVaLs<OBS>::fill starting" << std::endl;
-  util::Timer timer(classname(), "fill");
+  static const util::TimerId timerId(classname(), "fill");
+  util::Timer timer(timerId);
   gvals_->fill(indx, vals, levelsTopDown);
   Log::trace() << "GeoVaLs<OBS>::fill done" << std::endl;
 }
@@ -242,7 +257,8 @@ template <typename OBS>
 void GeoVaLs<OBS>::fillAD(const std::vector<size_t> & indx,
                           std::vector<double> & vals, const bool levelsTopDown) const {
   Log::trace() << "GeoVaLs<OBS>::fillAD starting" << std::endl;
-  util::Timer timer(classname(), "fillAD");
+  static const util::TimerId timerId(classname(), "fillAD");
+  util::Timer timer(timerId);
   gvals_->fillAD(indx, vals, levelsTopDown);
   Log::trace() << "GeoVaLs<OBS>::fillAD done" << std::endl;
 }
@@ -252,7 +268,8 @@ void GeoVaLs<OBS>::fillAD(const std::vector<size_t> & indx,
 template<typename OBS>
 void GeoVaLs<OBS>::read(const Parameters_ & params) {
   Log::trace() << "GeoVaLs<OBS>::read starting" << std::endl;
-  util::Timer timer(classname(), "read");
+  static const util::TimerId timerId(classname(), "read");
+  util::Timer timer(timerId);
   gvals_->read(params);
   Log::trace() << "GeoVaLs<OBS>::read done" << std::endl;
 }
@@ -262,7 +279,8 @@ void GeoVaLs<OBS>::read(const Parameters_ & params) {
 template<typename OBS>
 void GeoVaLs<OBS>::write(const Parameters_ & params) const {
   Log::trace() << "GeoVaLs<OBS>::write starting" << std::endl;
-  util::Timer timer(classname(), "write");
+  static const util::TimerId timerId(classname(), "write");
+  util::Timer timer(timerId);
   gvals_->write(params);
   Log::trace() << "GeoVaLs<OBS>::write done" << std::endl;
 }
@@ -272,7 +290,8 @@ void GeoVaLs<OBS>::write(const Parameters_ & params) const {
 template<typename OBS>
 void GeoVaLs<OBS>::print(std::ostream & os) const {
   Log::trace() << "GeoVaLs<OBS>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *gvals_;
   Log::trace() << "GeoVaLs<OBS>::print done" << std::endl;
 }
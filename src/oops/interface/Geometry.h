@@ -126,7 +126,8 @@ template <typename MODEL>
 Geometry<MODEL>::Geometry(const Parameters_ & parameters,
                           const eckit::mpi::Comm & comm): geom_() {
   Log::trace() << "Geometry<MODEL>::Geometry starting" << std::endl;
-  util::Timer timer(classname(), "Geometry");
+  static const util::TimerId timerId(classname(), "Geometry");
+  util::Timer timer(timerId);
   geom_.reset(new Geometry_(
                 parametersOrConfiguration<HasParameters_<Geometry_>::value>(parameters),
                 comm));
@@ -147,7 +148,8 @@ Geometry<MODEL>::Geometry(std::shared_ptr<const Geometry_> ptr)
 template <typename MODEL>
 Geometry<MODEL>::~Geometry() {
   Log::trace() << "Geometry<MODEL>::~Geometry starting" << std::endl;
-  util::Timer timer(classname(), "~Geometry");
+  static const util::TimerId timerId(classname(), "~Geometry");
+  util::Timer timer(timerId);
   geom_.reset();
   Log::trace() << "Geometry<MODEL>::~Geometry done" << std::endl;
 }
@@ -157,7 +159,8 @@ Geometry<MODEL>::~Geometry() {
 template <typename MODEL>
 GeometryIterator<MODEL> Geometry<MODEL>::begin() const {
   Log::trace() << "Geometry<MODEL>::begin starting" << std::endl;
-  util::Timer timer(classname(), "begin");
+  static const util::TimerId timerId(classname(), "begin");
+  util::Timer timer(timerId);
   Log::trace() << "Geometry<MODEL>::begin done" << std::endl;
   return GeometryIterator_(geom_->begin());
 }
@@ -167,7 +170,8 @@ GeometryIterator<MODEL> Geometry<MODEL>::begin() const {
 template <typename MODEL>
 std::vector<double> Geometry<MODEL>::verticalCoord(std::string & str) const {
   Log::trace() << "Geometry<MODEL>::verticalCoord starting" << std::endl;
-  util::Timer timer(classname(), "verticalCoord");
+  static const util::TimerId timerId(classname(), "verticalCoord");
+  util::Timer timer(timerId);
   Log::trace() << "Geometry<MODEL>::verticalCoord done" << std::endl;
   return geom_->verticalCoord(str);
 }
@@ -177,7 +181,8 @@ std::vector<double> Geometry<MODEL>::verticalCoord(std::string & str) const {
 template <typename MODEL>
 std::vector<size_t> Geometry<MODEL>::variableSizes(const Variables & vars) const {
   Log::trace() << "Geometry<MODEL>::variableSizes starting" << std::endl;
-  util::Timer timer(classname(), "variableSizes");
+  static const util::TimerId timerId(classname(), "variableSizes");
+  util::Timer timer(timerId);
   std::vector<size_t> sizes = geom_->variableSizes(vars);
   Log::trace() << "Geometry<MODEL>::variableSizes done" << std::endl;
   return sizes;
@@ -188,7 +193,8 @@ std::vector<size_t> Geometry<MODEL>::variableSizes(const Variables & vars) const
 template <typename MODEL>
 GeometryIterator<MODEL> Geometry<MODEL>::end() const {
   Log::trace() << "Geometry<MODEL>::end starting" << std::endl;
-  util::Timer timer(classname(), "end");
+  static const util::TimerId timerId(classname(), "end");
+  util::Timer timer(timerId);
   Log::trace() << "Geometry<MODEL>::end done" << std::endl;
   return GeometryIterator_(geom_->end());
 }
@@ -199,7 +205,8 @@ template <typename MODEL>
 void Geometry<MODEL>::latlon(std::vector<double> & lats, std::vector<double> & lons,
                              const bool halo) const {
   Log::trace() << "Geometry<MODEL>::latlon starting" << std::endl;
-  util::Timer timer(classname(), "latlon");
+  static const util::TimerId timerId(classname(), "latlon");
+  util::Timer timer(timerId);
   geom_->latlon(lats, lons, halo);
   ASSERT(lats.size() == lons.size());
   Log::trace() << "Geometry<MODEL>::latlon done" << std::endl;
@@ -210,7 +217,8 @@ void Geometry<MODEL>::latlon(std::vector<double> & lats, std::vector<double> & l
 template <typename MODEL>
 void Geometry<MODEL>::print(std::ostream & os) const {
   Log::trace() << "Geometry<MODEL>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *geom_;
   Log::trace() << "Geometry<MODEL>::print done" << std::endl;
 }
@@ -58,7 +58,8 @@ class GeometryIterator: public std::iterator<std::forward_iterator_tag,
 template<typename TRAIT>
 GeometryIterator<TRAIT>::GeometryIterator(const GeometryIterator& other) {
   Log::trace() << "GeometryIterator<TRAIT>::GeometryIterator starting" << std::endl;
-  util::Timer timer(classname(), "GeometryIterator");
+  static const util::TimerId timerId(classname(), "GeometryIterator");
+  util::Timer timer(timerId);
   geometryiter_.reset(new GeometryIterator_(other.geometryiter()));
   Log::trace() << "GeometryIterator<TRAIT>::GeometryIterator done" << std::endl;
 }
@@ -68,7 +69,8 @@ GeometryIterator<TRAIT>::GeometryIterator(const GeometryIterator& other) {
 template<typename TRAIT>
 GeometryIterator<TRAIT>::GeometryIterator(const GeometryIterator_& iter) {
   Log::trace() << "GeometryIterator<TRAIT>::GeometryIterator starting" << std::endl;
-  util::Timer timer(classname(), "GeometryIterator");
+  static const util::TimerId timerId(classname(), "GeometryIterator");
+  util::Timer timer(timerId);
   geometryiter_.reset(new GeometryIterator_(iter));
   Log::trace() << "GeometryIterator<TRAIT>::GeometryIterator done" << std::endl;
 }
@@ -78,7 +80,8 @@ GeometryIterator<TRAIT>::GeometryIterator(const GeometryIterator_& iter) {
 template<typename TRAIT>
 GeometryIterator<TRAIT>::~GeometryIterator() {
   Log::trace() << "GeometryIterator<TRAIT>::~GeometryIterator starting" << std::endl;
-  util::Timer timer(classname(), "~GeometryIterator");
+  static const util::TimerId timerId(classname(), "~GeometryIterator");
+  util::Timer timer(timerId);
   geometryiter_.reset();
   Log::trace() << "GeometryIterator<TRAIT>::~GeometryIterator done" << std::endl;
 }
@@ -88,7 +91,8 @@ GeometryIterator<TRAIT>::~GeometryIterator() {
 template<typename TRAIT>
 bool GeometryIterator<TRAIT>::operator==(const GeometryIterator& other) {
   Log::trace() << "GeometryIterator<TRAIT>::operator== starting" << std::endl;
-  util::Timer timer(classname(), "operator==");
+  static const util::TimerId timerId(classname(), "operator==");
+  util::Timer timer(timerId);
   bool equals = (*geometryiter_ == other.geometryiter());
   Log::trace() << "GeometryIterator<TRAIT>::operator== done" << std::endl;
   return equals;
@@ -99,7 +103,8 @@ bool GeometryIterator<TRAIT>::operator==(const GeometryIterator& other) {
 template<typename TRAIT>
 bool GeometryIterator<TRAIT>::operator!=(const GeometryIterator& other) {
   Log::trace() << "GeometryIterator<TRAIT>::operator!= starting" << std::endl;
-  util::Timer timer(classname(), "operator!=");
+  static const util::TimerId timerId(classname(), "operator!=");
+  util::Timer timer(timerId);
   bool notequals = (*geometryiter_ != other.geometryiter());
   Log::trace() << "GeometryIterator<TRAIT>::operator!= done" << std::endl;
   return notequals;
@@ -111,7 +116,8 @@ bool GeometryIterator<TRAIT>::operator!=(const GeometryIterator& other) {
 template<typename TRAIT>
 eckit::geometry::Point3 GeometryIterator<TRAIT>::operator*() const {
   Log::trace() << "GeometryIterator<TRAIT>::operator* starting" << std::endl;
-  util::Timer timer(classname(), "operator*");
+  static const util::TimerId timerId(classname(), "operator*");
+  util::Timer timer(timerId);
   eckit::geometry::Point3 loc = *(*geometryiter_);
   Log::trace() << "GeometryIterator<TRAIT>::operator* done" << std::endl;
   return loc;
@@ -122,7 +128,8 @@ eckit::geometry::Point3 GeometryIterator<TRAIT>::operator*() const {
 template<typename TRAIT>
 GeometryIterator<TRAIT> GeometryIterator<TRAIT>::operator++() {
   Log::trace() << "GeometryIterator<TRAIT>::operator++ starting" << std::endl;
-  util::Timer timer(classname(), "operator++");
+  static const util::TimerId timerId(classname(), "operator++");
+  util::Timer timer(timerId);
   ++(*geometryiter_);
   Log::trace() << "GeometryIterator<TRAIT>::operator++ done" << std::endl;
   return *this;
@@ -134,7 +141,8 @@ GeometryIterator<TRAIT> GeometryIterator<TRAIT>::operator++() {
 template<typename TRAIT>
 void GeometryIterator<TRAIT>::print(std::ostream & os) const {
   Log::trace() << "GeometryIterator<TRAIT>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *geometryiter_;
   Log::trace() << "GeometryIterator<TRAIT>::print done" << std::endl;
 }
@@ -14,9 +14,12 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "atlas/field.h"
+#include "eckit/exception/Exceptions.h"
 
 #include "oops/base/GeneralizedDepartures.h"
 #include "oops/base/Geometry.h"
@@ -35,11 +38,57 @@
 #include "oops/util/parameters/ParametersOrConfiguration.h"
 #include "oops/util/Serializable.h"
 #include "oops/util/Timer.h"
+#include "oops/util/TypeTraits.h"
 
 namespace oops {
 
 namespace interface {
 
+/// Detect whether \c T provides the optional block operations
+///
+///     std::vector<double> dot_products_with(const std::vector<const T *> &) const;
+///     void multi_axpy(const std::vector<double> &, const std::vector<const T *> &);
+///     void schur_accumul(const std::vector<const T *> &, const std::vector<const T *> &);
+///     static std::vector<double> local_dot_products(const std::vector<const T *> &,
+///                                                   const std::vector<const T *> &);
+///
+/// local_dot_products returns the contributions of this MPI task to the dot products of pairs
+/// of vectors, without summing over the tasks of the geometry.
+template<typename T, typename = void>
+struct HasDotProductsWith : std::false_type {};
+
+template<typename T>
+struct HasDotProductsWith<T, cpp17::void_t<decltype(std::declval<const T &>().dot_products_with(
+                                 std::declval<const std::vector<const T *> &>()))>>
+    : std::true_type {};
+
+template<typename T, typename = void>
+struct HasMultiAxpy : std::false_type {};
+
+template<typename T>
+struct HasMultiAxpy<T, cpp17::void_t<decltype(std::declval<T &>().multi_axpy(
+                           std::declval<const std::vector<double> &>(),
+                           std::declval<const std::vector<const T *> &>()))>>
+    : std::true_type {};
+
+template<typename T, typename = void>
+struct HasSchurAccumul : std::false_type {};
+
+template<typename T>
+struct HasSchurAccumul<T, cpp17::void_t<decltype(std::declval<T &>().schur_accumul(
+                              std::declval<const std::vector<const T *> &>(),
+                              std::declval<const std::vector<const T *> &>()))>>
+    : std::true_type {};
+
+template<typename T, typename = void>
+struct HasLocalDotProducts : std::false_type {};
+
+template<typename T>
+struct HasLocalDotProducts<T, cpp17::void_t<decltype(T::local_dot_products(
+                                  std::declval<const std::vector<const T *> &>(),
+                                  std::declval<const std::vector<const T *> &>()))>>
+    : std::true_type {};
+
 /// Increment: Difference between two model states.
 /// Some fields that are present in a State may not be present in an Increment.
 ///
@@ -63,6 +112,12 @@ namespace interface {
 ///     void dirac(const DiracParameters_ &);
 ///     void read(const ReadParameters_ &);
 ///     void write(const WriteParameters_ &) const;
+///
+/// Implementations can also provide dot_products_with(), multi_axpy() and schur_accumul() (see
+/// HasDotProductsWith, HasMultiAxpy and HasSchurAccumul) to go through the data once for several
+/// vectors; otherwise these are done one vector at a time with dot_product_with(), axpy() and
+/// schur_product_with(). Implementations that provide local_dot_products() (see
+/// HasLocalDotProducts) let oops sum the dot products of several pairs over the MPI tasks at once.
 
 template <typename MODEL>
 class Increment : public oops::GeneralizedDepartures,
@@ -136,6 +191,17 @@ class Increment : public oops::GeneralizedDepartures,
   void axpy(const double & w, const Increment & dx, const bool check = true);
   /// Compute dot product of this Increment with \p other
   double dot_product_with(const Increment & other) const;
+  /// Compute dot products of this Increment with each of \p others
+  std::vector<double> dot_products_with(const std::vector<const Increment *> & others) const;
+  /// Compute the contributions of this MPI task to the dot products of \p lhs[i] with \p rhs[i]
+  /// (only available if MODEL::Increment provides local_dot_products)
+  static std::vector<double> local_dot_products(const std::vector<const Increment *> & lhs,
+                                                const std::vector<const Increment *> & rhs);
+  /// Add \p w[i] * \p dx[i] to the Increment for all i
+  void multi_axpy(const std::vector<double> & w, const std::vector<const Increment *> & dx);
+  /// Add the Schur products of \p dx[i] with \p w[i] to the Increment for all i. The \p dx
+  /// are used as workspace and their values are undefined on exit.
+  void schur_accumul(const std::vector<Increment *> & dx, const std::vector<const Increment *> & w);
   /// Compute Schur product of this Increment with \p other, assign to this Increment
   void schur_product_with(const Increment & other);
 
@@ -181,9 +247,14 @@ class Increment : public oops::GeneralizedDepartures,
   void deserialize(const std::vector<double> &, size_t &) override;
 
   /// Accessor to MODEL::Increment, used in the other interface classes in oops.
-  /// Does not need to be implemented.
+  /// Does not need to be implemented. The non-const accessor drops the cached ATLAS fieldset;
+  /// it doesn't write to this Increment once the fieldset is empty, so it can then be called
+  /// from several threads.
   const Increment_ & increment() const {return *this->increment_;}
-  Increment_ & increment() {fset_.clear(); return *this->increment_;}
+  Increment_ & increment() {
+    if (fset_.size() > 0) fset_.clear();
+    return *this->increment_;
+  }
 
  protected:
   std::unique_ptr<Increment_> increment_;   /// pointer to the Increment implementation
@@ -191,6 +262,19 @@ class Increment : public oops::GeneralizedDepartures,
 
  private:
   void print(std::ostream &) const override;
+
+  static std::vector<double> dotProducts(const Increment_ &,
+                                         const std::vector<const Increment_ *> &, std::true_type);
+  static std::vector<double> dotProducts(const Increment_ &,
+                                         const std::vector<const Increment_ *> &, std::false_type);
+  static void multiAxpy(Increment_ &, const std::vector<double> &,
+                        const std::vector<const Increment_ *> &, std::true_type);
+  static void multiAxpy(Increment_ &, const std::vector<double> &,
+                        const std::vector<const Increment_ *> &, std::false_type);
+  static void schurAccumul(Increment_ &, const std::vector<Increment_ *> &,
+                           const std::vector<const Increment_ *> &, std::true_type);
+  static void schurAccumul(Increment_ &, const std::vector<Increment_ *> &,
+                           const std::vector<const Increment_ *> &, std::false_type);
 };
 
 // -----------------------------------------------------------------------------
@@ -201,7 +285,8 @@ Increment<MODEL>::Increment(const Geometry_ & resol, const Variables & vars,
   : increment_(), fset_()
 {
   Log::trace() << "Increment<MODEL>::Increment starting" << std::endl;
-  util::Timer timer(classname(), "Increment");
+  static const util::TimerId timerId(classname(), "Increment");
+  util::Timer timer(timerId);
   increment_.reset(new Increment_(resol.geometry(), vars, time));
   this->setObjectSize(increment_->serialSize()*sizeof(double));
   Log::trace() << "Increment<MODEL>::Increment done" << std::endl;
@@ -214,7 +299,8 @@ Increment<MODEL>::Increment(const Geometry_ & resol, const Increment & other)
   : increment_(), fset_()
 {
   Log::trace() << "Increment<MODEL>::Increment chres starting" << std::endl;
-  util::Timer timer(classname(), "Increment");
+  static const util::TimerId timerId(classname(), "Increment");
+  util::Timer timer(timerId);
   increment_.reset(new Increment_(resol.geometry(), *other.increment_));
   this->setObjectSize(increment_->serialSize()*sizeof(double));
   Log::trace() << "Increment<MODEL>::Increment chres done" << std::endl;
@@ -227,7 +313,8 @@ Increment<MODEL>::Increment(const Increment & other, const bool copy)
   : increment_(), fset_()
 {
   Log::trace() << "Increment<MODEL>::Increment copy starting" << std::endl;
-  util::Timer timer(classname(), "Increment");
+  static const util::TimerId timerId(classname(), "Increment");
+  util::Timer timer(timerId);
   increment_.reset(new Increment_(*other.increment_, copy));
   this->setObjectSize(increment_->serialSize()*sizeof(double));
   Log::trace() << "Increment<MODEL>::Increment copy done" << std::endl;
@@ -238,7 +325,8 @@ Increment<MODEL>::Increment(const Increment & other, const bool copy)
 template<typename MODEL>
 Increment<MODEL>::~Increment() {
   Log::trace() << "Increment<MODEL>::~Increment starting" << std::endl;
-  util::Timer timer(classname(), "~Increment");
+  static const util::TimerId timerId(classname(), "~Increment");
+  util::Timer timer(timerId);
   increment_.reset();
   fset_.clear();
   Log::trace() << "Increment<MODEL>::~Increment done" << std::endl;
@@ -249,7 +337,8 @@ Increment<MODEL>::~Increment() {
 template<typename MODEL>
 void Increment<MODEL>::diff(const State_ & x1, const State_ & x2) {
   Log::trace() << "Increment<MODEL>::diff starting" << std::endl;
-  util::Timer timer(classname(), "diff");
+  static const util::TimerId timerId(classname(), "diff");
+  util::Timer timer(timerId);
   fset_.clear();
   increment_->diff(x1.state(), x2.state());
   Log::trace() << "Increment<MODEL>::diff done" << std::endl;
@@ -260,7 +349,8 @@ void Increment<MODEL>::diff(const State_ & x1, const State_ & x2) {
 template<typename MODEL>
 void Increment<MODEL>::zero() {
   Log::trace() << "Increment<MODEL>::zero starting" << std::endl;
-  util::Timer timer(classname(), "zero");
+  static const util::TimerId timerId(classname(), "zero");
+  util::Timer timer(timerId);
   fset_.clear();
   increment_->zero();
   Log::trace() << "Increment<MODEL>::zero done" << std::endl;
@@ -271,7 +361,8 @@ void Increment<MODEL>::zero() {
 template<typename MODEL>
 void Increment<MODEL>::zero(const util::DateTime & tt) {
   Log::trace() << "Increment<MODEL>::zero starting" << std::endl;
-  util::Timer timer(classname(), "zero");
+  static const util::TimerId timerId(classname(), "zero");
+  util::Timer timer(timerId);
   fset_.clear();
   increment_->zero(tt);
   Log::trace() << "Increment<MODEL>::zero done" << std::endl;
@@ -282,7 +373,8 @@ void Increment<MODEL>::zero(const util::DateTime & tt) {
 template<typename MODEL>
 void Increment<MODEL>::ones() {
   Log::trace() << "Increment<MODEL>::ones starting" << std::endl;
-  util::Timer timer(classname(), "ones");
+  static const util::TimerId timerId(classname(), "ones");
+  util::Timer timer(timerId);
   fset_.clear();
   increment_->ones();
   Log::trace() << "Increment<MODEL>::ones done" << std::endl;
@@ -293,7 +385,8 @@ void Increment<MODEL>::ones() {
 template<typename MODEL>
 void Increment<MODEL>::dirac(const DiracParameters_ & parameters) {
   Log::trace() << "Increment<MODEL>::dirac starting" << std::endl;
-  util::Timer timer(classname(), "dirac");
+  static const util::TimerId timerId(classname(), "dirac");
+  util::Timer timer(timerId);
   fset_.clear();
   increment_->dirac(parametersOrConfiguration<HasDiracParameters_<Increment_>::value>(parameters));
   Log::trace() << "Increment<MODEL>::dirac done" << std::endl;
@@ -313,7 +406,8 @@ void Increment<MODEL>::dirac(const eckit::Configuration & config) {
 template<typename MODEL>
 Increment<MODEL> & Increment<MODEL>::operator=(const Increment & rhs) {
   Log::trace() << "Increment<MODEL>::operator= starting" << std::endl;
-  util::Timer timer(classname(), "operator=");
+  static const util::TimerId timerId(classname(), "operator=");
+  util::Timer timer(timerId);
   fset_.clear();
   *increment_ = *rhs.increment_;
   Log::trace() << "Increment<MODEL>::operator= done" << std::endl;
@@ -325,7 +419,8 @@ Increment<MODEL> & Increment<MODEL>::operator=(const Increment & rhs) {
 template<typename MODEL>
 Increment<MODEL> & Increment<MODEL>::operator+=(const Increment & rhs) {
   Log::trace() << "Increment<MODEL>::operator+= starting" << std::endl;
-  util::Timer timer(classname(), "operator+=");
+  static const util::TimerId timerId(classname(), "operator+=");
+  util::Timer timer(timerId);
   fset_.clear();
   *increment_ += *rhs.increment_;
   Log::trace() << "Increment<MODEL>::operator+= done" << std::endl;
@@ -337,7 +432,8 @@ Increment<MODEL> & Increment<MODEL>::operator+=(const Increment & rhs) {
 template<typename MODEL>
 Increment<MODEL> & Increment<MODEL>::operator-=(const Increment & rhs) {
   Log::trace() << "Increment<MODEL>::operator-= starting" << std::endl;
-  util::Timer timer(classname(), "operator-=");
+  static const util::TimerId timerId(classname(), "operator-=");
+  util::Timer timer(timerId);
   fset_.clear();
   *increment_ -= *rhs.increment_;
   Log::trace() << "Increment<MODEL>::operator-= done" << std::endl;
@@ -349,7 +445,8 @@ Increment<MODEL> & Increment<MODEL>::operator-=(const Increment & rhs) {
 template<typename MODEL>
 Increment<MODEL> & Increment<MODEL>::operator*=(const double & zz) {
   Log::trace() << "Increment<MODEL>::operator*= starting" << std::endl;
-  util::Timer timer(classname(), "operator*=");
+  static const util::TimerId timerId(classname(), "operator*=");
+  util::Timer timer(timerId);
   fset_.clear();
   *increment_ *= zz;
   Log::trace() << "Increment<MODEL>::operator*= done" << std::endl;
@@ -361,7 +458,8 @@ Increment<MODEL> & Increment<MODEL>::operator*=(const double & zz) {
 template<typename MODEL>
 void Increment<MODEL>::axpy(const double & zz, const Increment & dx, const bool check) {
   Log::trace() << "Increment<MODEL>::axpy starting" << std::endl;
-  util::Timer timer(classname(), "axpy");
+  static const util::TimerId timerId(classname(), "axpy");
+  util::Timer timer(timerId);
   fset_.clear();
   increment_->axpy(zz, *dx.increment_, check);
   Log::trace() << "Increment<MODEL>::axpy done" << std::endl;
@@ -372,7 +470,8 @@ void Increment<MODEL>::axpy(const double & zz, const Increment & dx, const bool
 template<typename MODEL>
 double Increment<MODEL>::dot_product_with(const Increment & dx) const {
   Log::trace() << "Increment<MODEL>::dot_product_with starting" << std::endl;
-  util::Timer timer(classname(), "dot_product_with");
+  static const util::TimerId timerId(classname(), "dot_product_with");
+  util::Timer timer(timerId);
   double zz = increment_->dot_product_with(*dx.increment_);
   Log::trace() << "Increment<MODEL>::dot_product_with done" << std::endl;
   return zz;
@@ -380,10 +479,140 @@ double Increment<MODEL>::dot_product_with(const Increment & dx) const {
 
 // -----------------------------------------------------------------------------
 
+template<typename MODEL>
+std::vector<double> Increment<MODEL>::dot_products_with(
+                                        const std::vector<const Increment *> & others) const {
+  Log::trace() << "Increment<MODEL>::dot_products_with starting" << std::endl;
+  static const util::TimerId timerId(classname(), "dot_products_with");
+  util::Timer timer(timerId);
+  std::vector<const Increment_ *> incs(others.size());
+  for (size_t jj = 0; jj < others.size(); ++jj) incs[jj] = others[jj]->increment_.get();
+  std::vector<double> zz = dotProducts(*increment_, incs, HasDotProductsWith<Increment_>());
+  Log::trace() << "Increment<MODEL>::dot_products_with done" << std::endl;
+  return zz;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+std::vector<double> Increment<MODEL>::local_dot_products(
+                                        const std::vector<const Increment *> & lhs,
+                                        const std::vector<const Increment *> & rhs) {
+  Log::trace() << "Increment<MODEL>::local_dot_products starting" << std::endl;
+  static const util::TimerId timerId(classname(), "local_dot_products");
+  util::Timer timer(timerId);
+  ASSERT(lhs.size() == rhs.size());
+  std::vector<const Increment_ *> lhsinc(lhs.size());
+  std::vector<const Increment_ *> rhsinc(rhs.size());
+  for (size_t jj = 0; jj < lhs.size(); ++jj) {
+    lhsinc[jj] = lhs[jj]->increment_.get();
+    rhsinc[jj] = rhs[jj]->increment_.get();
+  }
+  std::vector<double> zz = Increment_::local_dot_products(lhsinc, rhsinc);
+  Log::trace() << "Increment<MODEL>::local_dot_products done" << std::endl;
+  return zz;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void Increment<MODEL>::multi_axpy(const std::vector<double> & ww,
+                                  const std::vector<const Increment *> & dx) {
+  Log::trace() << "Increment<MODEL>::multi_axpy starting" << std::endl;
+  static const util::TimerId timerId(classname(), "multi_axpy");
+  util::Timer timer(timerId);
+  ASSERT(ww.size() == dx.size());
+  fset_.clear();
+  std::vector<const Increment_ *> incs(dx.size());
+  for (size_t jj = 0; jj < dx.size(); ++jj) incs[jj] = dx[jj]->increment_.get();
+  multiAxpy(*increment_, ww, incs, HasMultiAxpy<Increment_>());
+  Log::trace() << "Increment<MODEL>::multi_axpy done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+std::vector<double> Increment<MODEL>::dotProducts(const Increment_ & xx,
+                                                  const std::vector<const Increment_ *> & others,
+                                                  std::true_type) {
+  return xx.dot_products_with(others);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+std::vector<double> Increment<MODEL>::dotProducts(const Increment_ & xx,
+                                                  const std::vector<const Increment_ *> & others,
+                                                  std::false_type) {
+  std::vector<double> zz(others.size());
+  for (size_t jj = 0; jj < others.size(); ++jj) zz[jj] = xx.dot_product_with(*others[jj]);
+  return zz;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void Increment<MODEL>::multiAxpy(Increment_ & xx, const std::vector<double> & ww,
+                                 const std::vector<const Increment_ *> & dx, std::true_type) {
+  xx.multi_axpy(ww, dx);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void Increment<MODEL>::multiAxpy(Increment_ & xx, const std::vector<double> & ww,
+                                 const std::vector<const Increment_ *> & dx, std::false_type) {
+  for (size_t jj = 0; jj < dx.size(); ++jj) xx.axpy(ww[jj], *dx[jj], true);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void Increment<MODEL>::schur_accumul(const std::vector<Increment *> & dx,
+                                     const std::vector<const Increment *> & ww) {
+  Log::trace() << "Increment<MODEL>::schur_accumul starting" << std::endl;
+  static const util::TimerId timerId(classname(), "schur_accumul");
+  util::Timer timer(timerId);
+  ASSERT(ww.size() == dx.size());
+  fset_.clear();
+  std::vector<Increment_ *> incs(dx.size());
+  std::vector<const Increment_ *> wgts(ww.size());
+  for (size_t jj = 0; jj < dx.size(); ++jj) {
+    dx[jj]->fset_.clear();
+    incs[jj] = dx[jj]->increment_.get();
+    wgts[jj] = ww[jj]->increment_.get();
+  }
+  schurAccumul(*increment_, incs, wgts, HasSchurAccumul<Increment_>());
+  Log::trace() << "Increment<MODEL>::schur_accumul done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void Increment<MODEL>::schurAccumul(Increment_ & xx, const std::vector<Increment_ *> & dx,
+                                    const std::vector<const Increment_ *> & ww, std::true_type) {
+  const std::vector<const Increment_ *> incs(dx.begin(), dx.end());
+  xx.schur_accumul(incs, ww);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void Increment<MODEL>::schurAccumul(Increment_ & xx, const std::vector<Increment_ *> & dx,
+                                    const std::vector<const Increment_ *> & ww, std::false_type) {
+  for (size_t jj = 0; jj < dx.size(); ++jj) {
+    dx[jj]->schur_product_with(*ww[jj]);
+    xx.axpy(1.0, *dx[jj], false);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 template<typename MODEL>
 void Increment<MODEL>::schur_product_with(const Increment & dx) {
   Log::trace() << "Increment<MODEL>::schur_product_with starting" << std::endl;
-  util::Timer timer(classname(), "schur_product_with");
+  static const util::TimerId timerId(classname(), "schur_product_with");
+  util::Timer timer(timerId);
   fset_.clear();
   increment_->schur_product_with(*dx.increment_);
   Log::trace() << "Increment<MODEL>::schur_product_with done" << std::endl;
@@ -394,7 +623,8 @@ void Increment<MODEL>::schur_product_with(const Increment & dx) {
 template<typename MODEL>
 void Increment<MODEL>::random() {
   Log::trace() << "Increment<MODEL>::random starting" << std::endl;
-  util::Timer timer(classname(), "random");
+  static const util::TimerId timerId(classname(), "random");
+  util::Timer timer(timerId);
   fset_.clear();
   increment_->random();
   Log::trace() << "Increment<MODEL>::random done" << std::endl;
@@ -405,7 +635,8 @@ void Increment<MODEL>::random() {
 template<typename MODEL>
 void Increment<MODEL>::accumul(const double & zz, const State_ & xx) {
   Log::trace() << "Increment<MODEL>::accumul starting" << std::endl;
-  util::Timer timer(classname(), "accumul");
+  static const util::TimerId timerId(classname(), "accumul");
+  util::Timer timer(timerId);
   fset_.clear();
   increment_->accumul(zz, xx.state());
   Log::trace() << "Increment<MODEL>::accumul done" << std::endl;
@@ -416,7 +647,8 @@ void Increment<MODEL>::accumul(const double & zz, const State_ & xx) {
 template<typename MODEL>
 LocalIncrement Increment<MODEL>::getLocal(const GeometryIterator_ & iter) const {
   Log::trace() << "Increment<MODEL>::getLocal starting" << std::endl;
-  util::Timer timer(classname(), "getLocal");
+  static const util::TimerId timerId(classname(), "getLocal");
+  util::Timer timer(timerId);
   LocalIncrement gp = increment_->getLocal(iter.geometryiter());
   Log::trace() << "Increment<MODEL>::getLocal done" << std::endl;
   return gp;
@@ -427,7 +659,8 @@ template<typename MODEL>
 void Increment<MODEL>::setLocal(const LocalIncrement & gp,
                                 const GeometryIterator_ & iter) {
   Log::trace() << "Increment<MODEL>::setLocal starting" << std::endl;
-  util::Timer timer(classname(), "setLocal");
+  static const util::TimerId timerId(classname(), "setLocal");
+  util::Timer timer(timerId);
   fset_.clear();
   increment_->setLocal(gp, iter.geometryiter());
   Log::trace() << "Increment<MODEL>::setLocal done" << std::endl;
@@ -438,7 +671,8 @@ void Increment<MODEL>::setLocal(const LocalIncrement & gp,
 template<typename MODEL>
 void Increment<MODEL>::read(const ReadParameters_ & parameters) {
   Log::trace() << "Increment<MODEL>::read starting" << std::endl;
-  util::Timer timer(classname(), "read");
+  static const util::TimerId timerId(classname(), "read");
+  util::Timer timer(timerId);
   fset_.clear();
   increment_->read(parametersOrConfiguration<HasReadParameters_<Increment_>::value>(parameters));
   Log::trace() << "Increment<MODEL>::read done" << std::endl;
@@ -458,7 +692,8 @@ void Increment<MODEL>::read(const eckit::Configuration & config) {
 template<typename MODEL>
 void Increment<MODEL>::write(const WriteParameters_ & parameters) const {
   Log::trace() << "Increment<MODEL>::write starting" << std::endl;
-  util::Timer timer(classname(), "write");
+  static const util::TimerId timerId(classname(), "write");
+  util::Timer timer(timerId);
   increment_->write(parametersOrConfiguration<HasWriteParameters_<Increment_>::value>(parameters));
   Log::trace() << "Increment<MODEL>::write done" << std::endl;
 }
@@ -477,7 +712,8 @@ void Increment<MODEL>::write(const eckit::Configuration & config) const {
 template<typename MODEL>
 double Increment<MODEL>::norm() const {
   Log::trace() << "Increment<MODEL>::norm starting" << std::endl;
-  util::Timer timer(classname(), "norm");
+  static const util::TimerId timerId(classname(), "norm");
+  util::Timer timer(timerId);
   double zz = increment_->norm();
   Log::trace() << "Increment<MODEL>::norm done" << std::endl;
   return zz;
@@ -488,7 +724,8 @@ double Increment<MODEL>::norm() const {
 template<typename MODEL>
 std::vector<double> Increment<MODEL>::rmsByLevel(const std::string & var) const {
   Log::trace() << "Increment<MODEL>::rmsByLevel starting" << std::endl;
-  util::Timer timer(classname(), "rmsByLevel");
+  static const util::TimerId timerId(classname(), "rmsByLevel");
+  util::Timer timer(timerId);
   std::vector<double> rms = increment_->rmsByLevel(var);
   Log::trace() << "Increment<MODEL>::rmsByLevel done" << std::endl;
   return rms;
@@ -499,7 +736,8 @@ std::vector<double> Increment<MODEL>::rmsByLevel(const std::string & var) const
 template<typename MODEL>
 void Increment<MODEL>::toFieldSet(atlas::FieldSet & fset) const {
   Log::trace() << "Increment<MODEL>::toFieldSet starting" << std::endl;
-  util::Timer timer(classname(), "toFieldSet");
+  static const util::TimerId timerId(classname(), "toFieldSet");
+  util::Timer timer(timerId);
   increment_->toFieldSet(fset);
   Log::trace() << "Increment<MODEL>::toFieldSet done" << std::endl;
 }
@@ -509,7 +747,8 @@ void Increment<MODEL>::toFieldSet(atlas::FieldSet & fset) const {
 template<typename MODEL>
 void Increment<MODEL>::toFieldSetAD(const atlas::FieldSet & fset) {
   Log::trace() << "Increment<MODEL>::toFieldSetAD starting" << std::endl;
-  util::Timer timer(classname(), "toFieldSetAD");
+  static const util::TimerId timerId(classname(), "toFieldSetAD");
+  util::Timer timer(timerId);
   increment_->toFieldSetAD(fset);
   Log::trace() << "Increment<MODEL>::toFieldSetAD done" << std::endl;
 }
@@ -519,7 +758,8 @@ void Increment<MODEL>::toFieldSetAD(const atlas::FieldSet & fset) {
 template<typename MODEL>
 void Increment<MODEL>::fromFieldSet(const atlas::FieldSet & fset) {
   Log::trace() << "Increment<MODEL>::fromFieldSet starting" << std::endl;
-  util::Timer timer(classname(), "fromFieldSet");
+  static const util::TimerId timerId(classname(), "fromFieldSet");
+  util::Timer timer(timerId);
   increment_->fromFieldSet(fset);
   fset_.clear();
   Log::trace() << "Increment<MODEL>::fromFieldSet done" << std::endl;
@@ -530,7 +770,8 @@ void Increment<MODEL>::fromFieldSet(const atlas::FieldSet & fset) {
 template<typename MODEL>
 size_t Increment<MODEL>::serialSize() const {
   Log::trace() << "Increment<MODEL>::serialSize" << std::endl;
-  util::Timer timer(classname(), "serialSize");
+  static const util::TimerId timerId(classname(), "serialSize");
+  util::Timer timer(timerId);
   return increment_->serialSize();
 }
 
@@ -539,7 +780,8 @@ size_t Increment<MODEL>::serialSize() const {
 template<typename MODEL>
 void Increment<MODEL>::serialize(std::vector<double> & vect) const {
   Log::trace() << "Increment<MODEL>::serialize starting" << std::endl;
-  util::Timer timer(classname(), "serialize");
+  static const util::TimerId timerId(classname(), "serialize");
+  util::Timer timer(timerId);
   increment_->serialize(vect);
   Log::trace() << "Increment<MODEL>::serialize done" << std::endl;
 }
@@ -549,7 +791,8 @@ void Increment<MODEL>::serialize(std::vector<double> & vect) const {
 template<typename MODEL>
 void Increment<MODEL>::deserialize(const std::vector<double> & vect, size_t & current) {
   Log::trace() << "Increment<MODEL>::Increment deserialize starting" << std::endl;
-  util::Timer timer(classname(), "deserialize");
+  static const util::TimerId timerId(classname(), "deserialize");
+  util::Timer timer(timerId);
   fset_.clear();
   increment_->deserialize(vect, current);
   Log::trace() << "Increment<MODEL>::Increment deserialize done" << std::endl;
@@ -560,7 +803,8 @@ void Increment<MODEL>::deserialize(const std::vector<double> & vect, size_t & cu
 template<typename MODEL>
 void Increment<MODEL>::print(std::ostream & os) const {
   Log::trace() << "Increment<MODEL>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *increment_;
   Log::trace() << "Increment<MODEL>::print done" << std::endl;
 }
@@ -87,7 +87,8 @@ template<typename MODEL>
 LinearVariableChange<MODEL>::LinearVariableChange(const Geometry_ & resol,
     const Parameters_ & parameters) : chvar_() {
   Log::trace() << "LinearVariableChange<MODEL>::LinearVariableChange starting" << std::endl;
-  util::Timer timer(classname(), "LinearVariableChange");
+  static const util::TimerId timerId(classname(), "LinearVariableChange");
+  util::Timer timer(timerId);
   chvar_.reset(new LinearVariableChange_(resol.geometry(), parameters));
   Log::trace() << "LinearVariableChange<MODEL>::LinearVariableChange done" << std::endl;
 }
@@ -97,7 +98,8 @@ LinearVariableChange<MODEL>::LinearVariableChange(const Geometry_ & resol,
 template<typename MODEL>
 LinearVariableChange<MODEL>::~LinearVariableChange() {
   Log::trace() << "LinearVariableChange<MODEL>::~LinearVariableChange starting" << std::endl;
-  util::Timer timer(classname(), "~LinearVariableChange");
+  static const util::TimerId timerId(classname(), "~LinearVariableChange");
+  util::Timer timer(timerId);
   chvar_.reset();
   Log::trace() << "LinearVariableChange<MODEL>::~LinearVariableChange done" << std::endl;
 }
@@ -107,7 +109,8 @@ LinearVariableChange<MODEL>::~LinearVariableChange() {
 template<typename MODEL>
 void LinearVariableChange<MODEL>::changeVarTL(Increment_ & dx, const Variables & vars) const {
   Log::trace() << "LinearVariableChange<MODEL>::changeVarTL starting" << std::endl;
-  util::Timer timer(classname(), "changeVarTL");
+  static const util::TimerId timerId(classname(), "changeVarTL");
+  util::Timer timer(timerId);
   chvar_->changeVarTL(dx.increment(), vars);
   Log::trace() << "LinearVariableChange<MODEL>::changeVarTL done" << std::endl;
 }
@@ -117,7 +120,8 @@ template<typename MODEL>
 void LinearVariableChange<MODEL>::changeVarInverseTL(Increment_ & dx,
                                                      const Variables & vars) const {
   Log::trace() << "LinearVariableChange<MODEL>::changeVarInverseTL starting" << std::endl;
-  util::Timer timer(classname(), "changeVarInverseTL");
+  static const util::TimerId timerId(classname(), "changeVarInverseTL");
+  util::Timer timer(timerId);
   chvar_->changeVarInverseTL(dx.increment(), vars);
   Log::trace() << "LinearVariableChange<MODEL>::changeVarInverseTL done" << std::endl;
 }
@@ -127,7 +131,8 @@ void LinearVariableChange<MODEL>::changeVarInverseTL(Increment_ & dx,
 template<typename MODEL>
 void LinearVariableChange<MODEL>::changeVarAD(Increment_ & dx, const Variables & vars) const {
   Log::trace() << "LinearVariableChange<MODEL>::changeVarAD starting" << std::endl;
-  util::Timer timer(classname(), "changeVarAD");
+  static const util::TimerId timerId(classname(), "changeVarAD");
+  util::Timer timer(timerId);
   chvar_->changeVarAD(dx.increment(), vars);
   Log::trace() << "LinearVariableChange<MODEL>::changeVarAD done" << std::endl;
 }
@@ -138,7 +143,8 @@ template<typename MODEL>
 void LinearVariableChange<MODEL>::changeVarInverseAD(Increment_ & dx,
                                                      const Variables & vars) const {
   Log::trace() << "LinearVariableChange<MODEL>::changeVarInverseAD starting" << std::endl;
-  util::Timer timer(classname(), "changeVarInverseAD");
+  static const util::TimerId timerId(classname(), "changeVarInverseAD");
+  util::Timer timer(timerId);
   chvar_->changeVarInverseAD(dx.increment(), vars);
   Log::trace() << "LinearVariableChange<MODEL>::changeVarInverseAD done" << std::endl;
 }
@@ -149,7 +155,8 @@ template<typename MODEL>
 void LinearVariableChange<MODEL>::changeVarTraj(const State_ & xFirstGuess,
                                                 const Variables & vars) {
   Log::trace() << "LinearVariableChange<MODEL>::changeVarTraj starting" << std::endl;
-  util::Timer timer(classname(), "changeVarTraj");
+  static const util::TimerId timerId(classname(), "changeVarTraj");
+  util::Timer timer(timerId);
   chvar_->changeVarTraj(xFirstGuess.state(), vars);
   Log::trace() << "LinearVariableChange<MODEL>::changeVarTraj done" << std::endl;
 }
@@ -159,7 +166,8 @@ void LinearVariableChange<MODEL>::changeVarTraj(const State_ & xFirstGuess,
 template<typename MODEL>
 void LinearVariableChange<MODEL>::print(std::ostream & os) const {
   Log::trace() << "LinearVariableChange<MODEL>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *chvar_;
   Log::trace() << "LinearVariableChange<MODEL>::print done" << std::endl;
 }
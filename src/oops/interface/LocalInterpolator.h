@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "eckit/config/Configuration.h"
+#include "eckit/exception/Exceptions.h"
 #include "oops/base/Geometry.h"
 #include "oops/base/Increment.h"
 #include "oops/base/State.h"
@@ -100,8 +101,20 @@ class LocalInterpolator : public util::Printable,
   void applyAD(const Variables &, Increment_ &,
                const std::vector<bool> &, const std::vector<double> &) const;
 
+  /// Same as above for the target points whose indices are listed (converted to a mask, as
+  /// expected by the MODEL interpolator)
+  void apply(const Variables &, const State_ &,
+             const std::vector<size_t> &, std::vector<double> &) const;
+  void apply(const Variables &, const Increment_ &,
+             const std::vector<size_t> &, std::vector<double> &) const;
+  void applyAD(const Variables &, Increment_ &,
+               const std::vector<size_t> &, const std::vector<double> &) const;
+
  private:
+  std::vector<bool> mask(const std::vector<size_t> &) const;
+
   std::unique_ptr<LocalInterpolator_> interpolator_;
+  size_t nout_;
   void print(std::ostream &) const override;
 };
 
@@ -112,10 +125,11 @@ LocalInterpolator<MODEL>::LocalInterpolator(const eckit::Configuration & conf,
                                             const Geometry_ & resol,
                                             const std::vector<double> & lats,
                                             const std::vector<double> & lons)
-  : interpolator_()
+  : interpolator_(), nout_(lats.size())
 {
   Log::trace() << "LocalInterpolator<MODEL>::LocalInterpolator starting" << std::endl;
-  util::Timer timer(classname(), "LocalInterpolator");
+  static const util::TimerId timerId(classname(), "LocalInterpolator");
+  util::Timer timer(timerId);
   interpolator_.reset(new LocalInterpolator_(conf, resol.geometry(), lats, lons));
   Log::trace() << "LocalInterpolator<MODEL>::LocalInterpolator done" << std::endl;
 }
@@ -125,7 +139,8 @@ LocalInterpolator<MODEL>::LocalInterpolator(const eckit::Configuration & conf,
 template<typename MODEL>
 LocalInterpolator<MODEL>::~LocalInterpolator() {
   Log::trace() << "LocalInterpolator<MODEL>::~LocalInterpolator starting" << std::endl;
-  util::Timer timer(classname(), "~LocalInterpolator");
+  static const util::TimerId timerId(classname(), "~LocalInterpolator");
+  util::Timer timer(timerId);
   interpolator_.reset();
   Log::trace() << "LocalInterpolator<MODEL>::~LocalInterpolator done" << std::endl;
 }
@@ -137,7 +152,8 @@ void LocalInterpolator<MODEL>::apply(const Variables & vars, const State_ & xx,
                                      const std::vector<bool> & mask,
                                      std::vector<double> & vect) const {
   Log::trace() << "LocalInterpolator<MODEL>::apply starting" << std::endl;
-  util::Timer timer(classname(), "apply");
+  static const util::TimerId timerId(classname(), "apply");
+  util::Timer timer(timerId);
   detail::ApplyHelper<MODEL>::apply(*interpolator_, vars, xx, mask, vect);
   Log::trace() << "LocalInterpolator<MODEL>::apply done" << std::endl;
 }
@@ -149,7 +165,8 @@ void LocalInterpolator<MODEL>::apply(const Variables & vars, const Increment_ &
                                      const std::vector<bool> & mask,
                                      std::vector<double> & vect) const {
   Log::trace() << "LocalInterpolator<MODEL>::applyTL starting" << std::endl;
-  util::Timer timer(classname(), "applyTL");
+  static const util::TimerId timerId(classname(), "applyTL");
+  util::Timer timer(timerId);
   detail::ApplyHelper<MODEL>::apply(*interpolator_, vars, dx, mask, vect);
   Log::trace() << "LocalInterpolator<MODEL>::applyTL done" << std::endl;
 }
@@ -161,17 +178,58 @@ void LocalInterpolator<MODEL>::applyAD(const Variables & vars, Increment_ & dx,
                                        const std::vector<bool> & mask,
                                        const std::vector<double> & vect) const {
   Log::trace() << "LocalInterpolator<MODEL>::applyAD starting" << std::endl;
-  util::Timer timer(classname(), "applyAD");
+  static const util::TimerId timerId(classname(), "applyAD");
+  util::Timer timer(timerId);
   detail::ApplyHelper<MODEL>::applyAD(*interpolator_, vars, dx, mask, vect);
   Log::trace() << "LocalInterpolator<MODEL>::applyAD done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
+template<typename MODEL>
+void LocalInterpolator<MODEL>::apply(const Variables & vars, const State_ & xx,
+                                     const std::vector<size_t> & targets,
+                                     std::vector<double> & vect) const {
+  this->apply(vars, xx, this->mask(targets), vect);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void LocalInterpolator<MODEL>::apply(const Variables & vars, const Increment_ & dx,
+                                     const std::vector<size_t> & targets,
+                                     std::vector<double> & vect) const {
+  this->apply(vars, dx, this->mask(targets), vect);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void LocalInterpolator<MODEL>::applyAD(const Variables & vars, Increment_ & dx,
+                                       const std::vector<size_t> & targets,
+                                       const std::vector<double> & vect) const {
+  this->applyAD(vars, dx, this->mask(targets), vect);
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+std::vector<bool> LocalInterpolator<MODEL>::mask(const std::vector<size_t> & targets) const {
+  std::vector<bool> mask(nout_, false);
+  for (const size_t jloc : targets) {
+    ASSERT(jloc < nout_);
+    mask[jloc] = true;
+  }
+  return mask;
+}
+
+// -----------------------------------------------------------------------------
+
 template<typename MODEL>
 void LocalInterpolator<MODEL>::print(std::ostream & os) const {
   Log::trace() << "LocalInterpolator<MODEL>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *interpolator_;
   Log::trace() << "LocalInterpolator<MODEL>::print done" << std::endl;
 }
@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "oops/base/Geometry.h"
 #include "oops/base/Increment.h"
@@ -56,11 +57,31 @@ class LocalizationBase : public oops::LocalizationBase<MODEL> {
        { this->randomize(dx.increment()); }
   void multiply(oops::Increment<MODEL> & dx) const final
        { this->multiply(dx.increment()); }
+  void randomizeBatch(const std::vector<oops::Increment<MODEL> *> & dxs) const final
+       { this->randomizeBatch(increments(dxs)); }
+  void multiplyBatch(const std::vector<oops::Increment<MODEL> *> & dxs) const final
+       { this->multiplyBatch(increments(dxs)); }
 
   /// Randomize \p dx and apply 3D localization
   virtual void randomize(Increment_ & dx) const = 0;
   /// Apply 3D localization to \p dx
   virtual void multiply(Increment_ & dx) const = 0;
+
+  /// Randomize each of \p dxs and apply 3D localization (optional, calls randomize() for each
+  /// increment by default)
+  virtual void randomizeBatch(const std::vector<Increment_ *> & dxs) const
+       { for (Increment_ * dx : dxs) this->randomize(*dx); }
+  /// Apply 3D localization to each of \p dxs (optional, calls multiply() for each increment by
+  /// default)
+  virtual void multiplyBatch(const std::vector<Increment_ *> & dxs) const
+       { for (Increment_ * dx : dxs) this->multiply(*dx); }
+
+ private:
+  static std::vector<Increment_ *> increments(const std::vector<oops::Increment<MODEL> *> & dxs) {
+    std::vector<Increment_ *> incs(dxs.size());
+    for (size_t jj = 0; jj < dxs.size(); ++jj) incs[jj] = &dxs[jj]->increment();
+    return incs;
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -76,7 +76,8 @@ Locations<OBS>::Locations(std::unique_ptr<Locations_> locs) : locs_(std::move(lo
 template <typename OBS>
 Locations<OBS>::Locations(const eckit::Configuration & conf, const eckit::mpi::Comm & comm) {
   Log::trace() << "Locations<OBS>::Locations starting" << std::endl;
-  util::Timer timer(classname(), "Locations");
+  static const util::TimerId timerId(classname(), "Locations");
+  util::Timer timer(timerId);
   locs_.reset(new Locations_(conf, comm));
   Log::trace() << "Locations<OBS>::Locations done" << std::endl;
 }
@@ -86,7 +87,8 @@ Locations<OBS>::Locations(const eckit::Configuration & conf, const eckit::mpi::C
 template <typename OBS>
 Locations<OBS>::~Locations() {
   Log::trace() << "Locations<OBS>::~Locations starting" << std::endl;
-  util::Timer timer(classname(), "~Locations");
+  static const util::TimerId timerId(classname(), "~Locations");
+  util::Timer timer(timerId);
   locs_.reset();
   Log::trace() << "Locations<OBS>::~Locations done" << std::endl;
 }
@@ -95,7 +97,8 @@ Locations<OBS>::~Locations() {
 
 template <typename OBS>
 Locations<OBS>::Locations(Locations && other): locs_(std::move(other.locs_)) {
-  util::Timer timer(classname(), "Locations");
+  static const util::TimerId timerId(classname(), "Locations");
+  util::Timer timer(timerId);
   Log::trace() << "Locations<OBS> moved" << std::endl;
 }
 
@@ -104,7 +107,8 @@ Locations<OBS>::Locations(Locations && other): locs_(std::move(other.locs_)) {
 template <typename OBS>
 Locations<OBS> & Locations<OBS>::operator=(Locations<OBS> && other) {
   Log::trace() << "Locations<OBS>::operator= starting" << std::endl;
-  util::Timer timer(classname(), "operator=");
+  static const util::TimerId timerId(classname(), "operator=");
+  util::Timer timer(timerId);
   locs_ = std::move(other.locs_);
   Log::trace() << "Locations<OBS>::operator= done" << std::endl;
   return *this;
@@ -115,7 +119,8 @@ Locations<OBS> & Locations<OBS>::operator=(Locations<OBS> && other) {
 template <typename OBS>
 const std::vector<double> & Locations<OBS>::latitudes() const {
   Log::trace() << "Locations<OBS>::latitudes starting" << std::endl;
-  util::Timer timer(classname(), "latitudes");
+  static const util::TimerId timerId(classname(), "latitudes");
+  util::Timer timer(timerId);
   return locs_->latitudes();
 }
 
@@ -124,7 +129,8 @@ const std::vector<double> & Locations<OBS>::latitudes() const {
 template <typename OBS>
 const std::vector<double> & Locations<OBS>::longitudes() const {
   Log::trace() << "Locations<OBS>::longitudes starting" << std::endl;
-  util::Timer timer(classname(), "longitudes");
+  static const util::TimerId timerId(classname(), "longitudes");
+  util::Timer timer(timerId);
   return locs_->longitudes();
 }
 
@@ -133,7 +139,8 @@ const std::vector<double> & Locations<OBS>::longitudes() const {
 template <typename OBS>
 const std::vector<util::DateTime> & Locations<OBS>::times() const {
   Log::trace() << "Locations<OBS>::times starting" << std::endl;
-  util::Timer timer(classname(), "times");
+  static const util::TimerId timerId(classname(), "times");
+  util::Timer timer(timerId);
   return locs_->times();
 }
 
@@ -142,7 +149,8 @@ const std::vector<util::DateTime> & Locations<OBS>::times() const {
 template<typename OBS>
 void Locations<OBS>::print(std::ostream & os) const {
   Log::trace() << "Locations<OBS>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *locs_;
   Log::trace() << "Locations<OBS>::print done" << std::endl;
 }
@@ -111,7 +111,8 @@ ModelAuxControl<MODEL>::ModelAuxControl(const Geometry_ & resol,
                                         const Parameters_ & parameters) : aux_()
 {
   Log::trace() << "ModelAuxControl<MODEL>::ModelAuxControl starting" << std::endl;
-  util::Timer timer(classname(), "ModelAuxControl");
+  static const util::TimerId timerId(classname(), "ModelAuxControl");
+  util::Timer timer(timerId);
   aux_.reset(new ModelAuxControl_(
                resol.geometry(),
                parametersOrConfiguration<HasParameters_<ModelAuxControl_>::value>(parameters)));
@@ -133,7 +134,8 @@ ModelAuxControl<MODEL>::ModelAuxControl(const Geometry_ & resol,
                                         const ModelAuxControl & other) : aux_()
 {
   Log::trace() << "ModelAuxControl<MODEL>::ModelAuxControl interpolated starting" << std::endl;
-  util::Timer timer(classname(), "ModelAuxControl");
+  static const util::TimerId timerId(classname(), "ModelAuxControl");
+  util::Timer timer(timerId);
   aux_.reset(new ModelAuxControl_(resol.geometry(), *other.aux_));
   Log::trace() << "ModelAuxControl<MODEL>::ModelAuxControl interpolated done" << std::endl;
 }
@@ -145,7 +147,8 @@ ModelAuxControl<MODEL>::ModelAuxControl(const ModelAuxControl & other,
                                         const bool copy) : aux_()
 {
   Log::trace() << "ModelAuxControl<MODEL>::ModelAuxControl copy starting" << std::endl;
-  util::Timer timer(classname(), "ModelAuxControl");
+  static const util::TimerId timerId(classname(), "ModelAuxControl");
+  util::Timer timer(timerId);
   aux_.reset(new ModelAuxControl_(*other.aux_, copy));
   Log::trace() << "ModelAuxControl<MODEL>::ModelAuxControl copy done" << std::endl;
 }
@@ -155,7 +158,8 @@ ModelAuxControl<MODEL>::ModelAuxControl(const ModelAuxControl & other,
 template<typename MODEL>
 ModelAuxControl<MODEL>::~ModelAuxControl() {
   Log::trace() << "ModelAuxControl<MODEL>::~ModelAuxControl starting" << std::endl;
-  util::Timer timer(classname(), "~ModelAuxControl");
+  static const util::TimerId timerId(classname(), "~ModelAuxControl");
+  util::Timer timer(timerId);
   aux_.reset();
   Log::trace() << "ModelAuxControl<MODEL>::~ModelAuxControl done" << std::endl;
 }
@@ -165,7 +169,8 @@ ModelAuxControl<MODEL>::~ModelAuxControl() {
 template<typename MODEL>
 void ModelAuxControl<MODEL>::read(const eckit::Configuration & conf) {
   Log::trace() << "ModelAuxControl<MODEL>::read starting" << std::endl;
-  util::Timer timer(classname(), "read");
+  static const util::TimerId timerId(classname(), "read");
+  util::Timer timer(timerId);
   aux_->read(conf);
   Log::trace() << "ModelAuxControl<MODEL>::read done" << std::endl;
 }
@@ -175,7 +180,8 @@ void ModelAuxControl<MODEL>::read(const eckit::Configuration & conf) {
 template<typename MODEL>
 void ModelAuxControl<MODEL>::write(const eckit::Configuration & conf) const {
   Log::trace() << "ModelAuxControl<MODEL>::write starting" << std::endl;
-  util::Timer timer(classname(), "write");
+  static const util::TimerId timerId(classname(), "write");
+  util::Timer timer(timerId);
   aux_->write(conf);
   Log::trace() << "ModelAuxControl<MODEL>::write done" << std::endl;
 }
@@ -185,7 +191,8 @@ void ModelAuxControl<MODEL>::write(const eckit::Configuration & conf) const {
 template<typename MODEL>
 double ModelAuxControl<MODEL>::norm() const {
   Log::trace() << "ModelAuxControl<MODEL>::norm starting" << std::endl;
-  util::Timer timer(classname(), "norm");
+  static const util::TimerId timerId(classname(), "norm");
+  util::Timer timer(timerId);
   double zz = aux_->norm();
   Log::trace() << "ModelAuxControl<MODEL>::norm done" << std::endl;
   return zz;
@@ -196,7 +203,8 @@ double ModelAuxControl<MODEL>::norm() const {
 template<typename MODEL>
 void ModelAuxControl<MODEL>::print(std::ostream & os) const {
   Log::trace() << "ModelAuxControl<MODEL>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *aux_;
   Log::trace() << "ModelAuxControl<MODEL>::print done" << std::endl;
 }
@@ -108,7 +108,8 @@ ModelAuxCovariance<MODEL>::ModelAuxCovariance(const Parameters_ & parameters,
                                               const Geometry_ & resol) : cov_()
 {
   Log::trace() << "ModelAuxCovariance<MODEL>::ModelAuxCovariance starting" << std::endl;
-  util::Timer timer(classname(), "ModelAuxCovariance");
+  static const util::TimerId timerId(classname(), "ModelAuxCovariance");
+  util::Timer timer(timerId);
   cov_.reset(new ModelAuxCovariance_(
                parametersOrConfiguration<HasParameters_<ModelAuxCovariance_>::value>(parameters),
                resol.geometry()));
@@ -128,7 +129,8 @@ ModelAuxCovariance<MODEL>::ModelAuxCovariance(const eckit::Configuration & conf,
 template<typename MODEL>
 ModelAuxCovariance<MODEL>::~ModelAuxCovariance() {
   Log::trace() << "ModelAuxCovariance<MODEL>::~ModelAuxCovariance starting" << std::endl;
-  util::Timer timer(classname(), "~ModelAuxCovariance");
+  static const util::TimerId timerId(classname(), "~ModelAuxCovariance");
+  util::Timer timer(timerId);
   cov_.reset();
   Log::trace() << "ModelAuxCovariance<MODEL>::~ModelAuxCovariance done" << std::endl;
 }
@@ -138,7 +140,8 @@ ModelAuxCovariance<MODEL>::~ModelAuxCovariance() {
 template<typename MODEL>
 void ModelAuxCovariance<MODEL>::linearize(const ModelAuxControl_ & xx, const Geometry_ & resol) {
   Log::trace() << "ModelAuxCovariance<MODEL>::linearize starting" << std::endl;
-  util::Timer timer(classname(), "linearize");
+  static const util::TimerId timerId(classname(), "linearize");
+  util::Timer timer(timerId);
   cov_->linearize(xx.modelauxcontrol(), resol.geometry());
   Log::trace() << "ModelAuxCovariance<MODEL>::linearize done" << std::endl;
 }
@@ -149,7 +152,8 @@ template<typename MODEL>
 void ModelAuxCovariance<MODEL>::multiply(const ModelAuxIncrement_ & dx1,
                                          ModelAuxIncrement_ & dx2) const {
   Log::trace() << "ModelAuxCovariance<MODEL>::multiply starting" << std::endl;
-  util::Timer timer(classname(), "multiply");
+  static const util::TimerId timerId(classname(), "multiply");
+  util::Timer timer(timerId);
   cov_->multiply(dx1.modelauxincrement(), dx2.modelauxincrement());
   Log::trace() << "ModelAuxCovariance<MODEL>::multiply done" << std::endl;
 }
@@ -160,7 +164,8 @@ template<typename MODEL>
 void ModelAuxCovariance<MODEL>::inverseMultiply(const ModelAuxIncrement_ & dx1,
                                                 ModelAuxIncrement_ & dx2) const {
   Log::trace() << "ModelAuxCovariance<MODEL>::inverseMultiply starting" << std::endl;
-  util::Timer timer(classname(), "inverseMultiply");
+  static const util::TimerId timerId(classname(), "inverseMultiply");
+  util::Timer timer(timerId);
   cov_->inverseMultiply(dx1.modelauxincrement(), dx2.modelauxincrement());
   Log::trace() << "ModelAuxCovariance<MODEL>::inverseMultiply done" << std::endl;
 }
@@ -170,7 +175,8 @@ void ModelAuxCovariance<MODEL>::inverseMultiply(const ModelAuxIncrement_ & dx1,
 template<typename MODEL>
 void ModelAuxCovariance<MODEL>::randomize(ModelAuxIncrement_ & dx) const {
   Log::trace() << "ModelAuxCovariance<MODEL>::randomize starting" << std::endl;
-  util::Timer timer(classname(), "randomize");
+  static const util::TimerId timerId(classname(), "randomize");
+  util::Timer timer(timerId);
   cov_->randomize(dx.modelauxincrement());
   Log::trace() << "ModelAuxCovariance<MODEL>::randomize done" << std::endl;
 }
@@ -180,7 +186,8 @@ void ModelAuxCovariance<MODEL>::randomize(ModelAuxIncrement_ & dx) const {
 template<typename MODEL>
 void ModelAuxCovariance<MODEL>::print(std::ostream & os) const {
   Log::trace() << "ModelAuxCovariance<MODEL>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *cov_;
   Log::trace() << "ModelAuxCovariance<MODEL>::print done" << std::endl;
 }
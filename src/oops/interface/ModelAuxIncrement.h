@@ -128,7 +128,8 @@ template <typename MODEL>
 ModelAuxControl<MODEL> & operator+=(ModelAuxControl<MODEL> & xx,
                                     const ModelAuxIncrement<MODEL> & dx) {
   Log::trace() << "operator+=(ModelAuxControl, ModelAuxIncrement) starting" << std::endl;
-  util::Timer timer("oops::ModelAuxIncrement", "operator+=ModelAuxControl");
+  static const util::TimerId timerId("oops::ModelAuxIncrement", "operator+=ModelAuxControl");
+  util::Timer timer(timerId);
   xx.modelauxcontrol() += dx.modelauxincrement();
   Log::trace() << "operator+=(ModelAuxControl, ModelAuxIncrement) done" << std::endl;
   return xx;
@@ -141,7 +142,8 @@ ModelAuxIncrement<MODEL>::ModelAuxIncrement(const Geometry_ & resol,
                                             const Parameters_ & parameters) : aux_()
 {
   Log::trace() << "ModelAuxIncrement<MODEL>::ModelAuxIncrement starting" << std::endl;
-  util::Timer timer(classname(), "ModelAuxIncrement");
+  static const util::TimerId timerId(classname(), "ModelAuxIncrement");
+  util::Timer timer(timerId);
   aux_.reset(new ModelAuxIncrement_(
                resol.geometry(),
                parametersOrConfiguration<HasParameters_<ModelAuxIncrement_>::value>(parameters)));
@@ -160,7 +162,8 @@ ModelAuxIncrement<MODEL>::ModelAuxIncrement(const ModelAuxIncrement & other,
                                             const bool copy) : aux_()
 {
   Log::trace() << "ModelAuxIncrement<MODEL>::ModelAuxIncrement copy starting" << std::endl;
-  util::Timer timer(classname(), "ModelAuxIncrement");
+  static const util::TimerId timerId(classname(), "ModelAuxIncrement");
+  util::Timer timer(timerId);
   aux_.reset(new ModelAuxIncrement_(*other.aux_, copy));
   this->setObjectSize(aux_->serialSize()*sizeof(double));
   Log::trace() << "ModelAuxIncrement<MODEL>::ModelAuxIncrement copy done" << std::endl;
@@ -171,7 +174,8 @@ ModelAuxIncrement<MODEL>::ModelAuxIncrement(const ModelAuxIncrement & other,
                                             const Parameters_ & parameters) : aux_()
 {
   Log::trace() << "ModelAuxIncrement<MODEL>::ModelAuxIncrement interpolated starting" << std::endl;
-  util::Timer timer(classname(), "ModelAuxIncrement");
+  static const util::TimerId timerId(classname(), "ModelAuxIncrement");
+  util::Timer timer(timerId);
   aux_.reset(new ModelAuxIncrement_(
                *other.aux_,
                parametersOrConfiguration<HasParameters_<ModelAuxIncrement_>::value>(parameters)));
@@ -188,7 +192,8 @@ ModelAuxIncrement<MODEL>::ModelAuxIncrement(const ModelAuxIncrement & other,
 template<typename MODEL>
 ModelAuxIncrement<MODEL>::~ModelAuxIncrement() {
   Log::trace() << "ModelAuxIncrement<MODEL>::~ModelAuxIncrement starting" << std::endl;
-  util::Timer timer(classname(), "~ModelAuxIncrement");
+  static const util::TimerId timerId(classname(), "~ModelAuxIncrement");
+  util::Timer timer(timerId);
   aux_.reset();
   Log::trace() << "ModelAuxIncrement<MODEL>::~ModelAuxIncrement done" << std::endl;
 }
@@ -196,7 +201,8 @@ ModelAuxIncrement<MODEL>::~ModelAuxIncrement() {
 template<typename MODEL>
 void ModelAuxIncrement<MODEL>::diff(const ModelAuxControl_ & x1, const ModelAuxControl_ & x2) {
   Log::trace() << "ModelAuxIncrement<MODEL>::diff starting" << std::endl;
-  util::Timer timer(classname(), "diff");
+  static const util::TimerId timerId(classname(), "diff");
+  util::Timer timer(timerId);
   aux_->diff(x1.modelauxcontrol(), x2.modelauxcontrol());
   Log::trace() << "ModelAuxIncrement<MODEL>::diff done" << std::endl;
 }
@@ -204,7 +210,8 @@ void ModelAuxIncrement<MODEL>::diff(const ModelAuxControl_ & x1, const ModelAuxC
 template<typename MODEL>
 void ModelAuxIncrement<MODEL>::zero() {
   Log::trace() << "ModelAuxIncrement<MODEL>::zero starting" << std::endl;
-  util::Timer timer(classname(), "zero");
+  static const util::TimerId timerId(classname(), "zero");
+  util::Timer timer(timerId);
   aux_->zero();
   Log::trace() << "ModelAuxIncrement<MODEL>::zero done" << std::endl;
 }
@@ -212,7 +219,8 @@ void ModelAuxIncrement<MODEL>::zero() {
 template<typename MODEL>
 ModelAuxIncrement<MODEL> & ModelAuxIncrement<MODEL>::operator=(const ModelAuxIncrement & rhs) {
   Log::trace() << "ModelAuxIncrement<MODEL>::operator= starting" << std::endl;
-  util::Timer timer(classname(), "operator=");
+  static const util::TimerId timerId(classname(), "operator=");
+  util::Timer timer(timerId);
   *aux_ = *rhs.aux_;
   Log::trace() << "ModelAuxIncrement<MODEL>::operator= done" << std::endl;
   return *this;
@@ -221,7 +229,8 @@ ModelAuxIncrement<MODEL> & ModelAuxIncrement<MODEL>::operator=(const ModelAuxInc
 template<typename MODEL>
 ModelAuxIncrement<MODEL> & ModelAuxIncrement<MODEL>::operator+=(const ModelAuxIncrement & rhs) {
   Log::trace() << "ModelAuxIncrement<MODEL>::operator+= starting" << std::endl;
-  util::Timer timer(classname(), "operator+=");
+  static const util::TimerId timerId(classname(), "operator+=");
+  util::Timer timer(timerId);
   *aux_ += *rhs.aux_;
   Log::trace() << "ModelAuxIncrement<MODEL>::operator+= done" << std::endl;
   return *this;
@@ -230,7 +239,8 @@ ModelAuxIncrement<MODEL> & ModelAuxIncrement<MODEL>::operator+=(const ModelAuxIn
 template<typename MODEL>
 ModelAuxIncrement<MODEL> & ModelAuxIncrement<MODEL>::operator-=(const ModelAuxIncrement & rhs) {
   Log::trace() << "ModelAuxIncrement<MODEL>::operator-= starting" << std::endl;
-  util::Timer timer(classname(), "operator-=");
+  static const util::TimerId timerId(classname(), "operator-=");
+  util::Timer timer(timerId);
   *aux_ -= *rhs.aux_;
   Log::trace() << "ModelAuxIncrement<MODEL>::operator-= done" << std::endl;
   return *this;
@@ -239,7 +249,8 @@ ModelAuxIncrement<MODEL> & ModelAuxIncrement<MODEL>::operator-=(const ModelAuxIn
 template<typename MODEL>
 ModelAuxIncrement<MODEL> & ModelAuxIncrement<MODEL>::operator*=(const double & zz) {
   Log::trace() << "ModelAuxIncrement<MODEL>::operator*= starting" << std::endl;
-  util::Timer timer(classname(), "operator*=");
+  static const util::TimerId timerId(classname(), "operator*=");
+  util::Timer timer(timerId);
   *aux_ *= zz;
   Log::trace() << "ModelAuxIncrement<MODEL>::operator*= done" << std::endl;
   return *this;
@@ -248,7 +259,8 @@ ModelAuxIncrement<MODEL> & ModelAuxIncrement<MODEL>::operator*=(const double & z
 template<typename MODEL>
 void ModelAuxIncrement<MODEL>::axpy(const double & zz, const ModelAuxIncrement & dx) {
   Log::trace() << "ModelAuxIncrement<MODEL>::axpy starting" << std::endl;
-  util::Timer timer(classname(), "axpy");
+  static const util::TimerId timerId(classname(), "axpy");
+  util::Timer timer(timerId);
   aux_->axpy(zz, *dx.aux_);
   Log::trace() << "ModelAuxIncrement<MODEL>::axpy done" << std::endl;
 }
@@ -256,7 +268,8 @@ void ModelAuxIncrement<MODEL>::axpy(const double & zz, const ModelAuxIncrement &
 template<typename MODEL>
 double ModelAuxIncrement<MODEL>::dot_product_with(const ModelAuxIncrement & dx) const {
   Log::trace() << "ModelAuxIncrement<MODEL>::dot_product_with starting" << std::endl;
-  util::Timer timer(classname(), "dot_product_with");
+  static const util::TimerId timerId(classname(), "dot_product_with");
+  util::Timer timer(timerId);
   double zz = aux_->dot_product_with(*dx.aux_);
   Log::trace() << "ModelAuxIncrement<MODEL>::dot_product_with done" << std::endl;
   return zz;
@@ -265,7 +278,8 @@ double ModelAuxIncrement<MODEL>::dot_product_with(const ModelAuxIncrement & dx)
 template<typename MODEL>
 void ModelAuxIncrement<MODEL>::read(const eckit::Configuration & conf) {
   Log::trace() << "ModelAuxIncrement<MODEL>::read starting" << std::endl;
-  util::Timer timer(classname(), "read");
+  static const util::TimerId timerId(classname(), "read");
+  util::Timer timer(timerId);
   aux_->read(conf);
   Log::trace() << "ModelAuxIncrement<MODEL>::read done" << std::endl;
 }
@@ -273,7 +287,8 @@ void ModelAuxIncrement<MODEL>::read(const eckit::Configuration & conf) {
 template<typename MODEL>
 void ModelAuxIncrement<MODEL>::write(const eckit::Configuration & conf) const {
   Log::trace() << "ModelAuxIncrement<MODEL>::write starting" << std::endl;
-  util::Timer timer(classname(), "write");
+  static const util::TimerId timerId(classname(), "write");
+  util::Timer timer(timerId);
   aux_->write(conf);
   Log::trace() << "ModelAuxIncrement<MODEL>::write done" << std::endl;
 }
@@ -281,7 +296,8 @@ void ModelAuxIncrement<MODEL>::write(const eckit::Configuration & conf) const {
 template<typename MODEL>
 double ModelAuxIncrement<MODEL>::norm() const {
   Log::trace() << "ModelAuxIncrement<MODEL>::norm starting" << std::endl;
-  util::Timer timer(classname(), "norm");
+  static const util::TimerId timerId(classname(), "norm");
+  util::Timer timer(timerId);
   double zz = aux_->norm();
   Log::trace() << "ModelAuxIncrement<MODEL>::norm done" << std::endl;
   return zz;
@@ -290,14 +306,16 @@ double ModelAuxIncrement<MODEL>::norm() const {
 template<typename MODEL>
 size_t ModelAuxIncrement<MODEL>::serialSize() const {
   Log::trace() << "ModelAuxIncrement<MODEL>::serialSize" << std::endl;
-  util::Timer timer(classname(), "serialSize");
+  static const util::TimerId timerId(classname(), "serialSize");
+  util::Timer timer(timerId);
   return aux_->serialSize();
 }
 // -----------------------------------------------------------------------------
 template<typename MODEL>
 void ModelAuxIncrement<MODEL>::serialize(std::vector<double> & vect) const {
   Log::trace() << "ModelAuxIncrement<MODEL>::serialize starting" << std::endl;
-  util::Timer timer(classname(), "serialize");
+  static const util::TimerId timerId(classname(), "serialize");
+  util::Timer timer(timerId);
   aux_->serialize(vect);
   Log::trace() << "ModelAuxIncrement<MODEL>::serialize done" << std::endl;
 }
@@ -305,7 +323,8 @@ void ModelAuxIncrement<MODEL>::serialize(std::vector<double> & vect) const {
 template<typename MODEL>
 void ModelAuxIncrement<MODEL>::deserialize(const std::vector<double> & vect, size_t & current) {
   Log::trace() << "ModelAuxIncrement<MODEL>::deserialize starting" << std::endl;
-  util::Timer timer(classname(), "deserialize");
+  static const util::TimerId timerId(classname(), "deserialize");
+  util::Timer timer(timerId);
   aux_->deserialize(vect, current);
   Log::trace() << "ModelAuxIncrement<MODEL>::deserialize done" << std::endl;
 }
@@ -313,7 +332,8 @@ void ModelAuxIncrement<MODEL>::deserialize(const std::vector<double> & vect, siz
 template<typename MODEL>
 void ModelAuxIncrement<MODEL>::print(std::ostream & os) const {
   Log::trace() << "ModelAuxIncrement<MODEL>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *aux_;
   Log::trace() << "ModelAuxIncrement<MODEL>::print done" << std::endl;
 }
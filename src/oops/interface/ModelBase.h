@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <boost/make_unique.hpp>
 
@@ -63,6 +64,13 @@ class ModelBase : public oops::ModelBase<MODEL> {
        { this->step(xx.state(), modelaux.modelauxcontrol()); }
   void finalize(oops::State<MODEL> & xx) const final
        { this->finalize(xx.state()); }
+  void stepBatch(const std::vector<oops::State<MODEL> *> & xx,
+                 const ModelAuxControl<MODEL> & modelaux) const final {
+    std::vector<State_ *> states;
+    states.reserve(xx.size());
+    for (oops::State<MODEL> * jx : xx) states.push_back(&jx->state());
+    this->stepBatch(states, modelaux.modelauxcontrol());
+  }
 
   /// \brief Forecast initialization, called before every forecast run
   virtual void initialize(State_ &) const = 0;
@@ -70,6 +78,10 @@ class ModelBase : public oops::ModelBase<MODEL> {
   virtual void step(State_ &, const ModelAux_ &) const = 0;
   /// \brief Forecast finalization; called after each forecast run
   virtual void finalize(State_ &) const = 0;
+  /// \brief Forecast "step" of several states valid at the same time, only called if
+  /// hasStepBatch() is overridden to return true; the default steps the states one at a time
+  virtual void stepBatch(const std::vector<State_ *> & xx, const ModelAux_ & maux) const
+       { for (State_ * jx : xx) this->step(*jx, maux); }
 };
 
 // -----------------------------------------------------------------------------
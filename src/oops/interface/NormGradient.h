@@ -56,7 +56,8 @@ NormGradient<MODEL>::NormGradient(const Geometry_ & resol, const State_ & xr,
                                   const eckit::Configuration & conf) : normgradient_()
 {
   Log::trace() << "NormGradient<MODEL>::NormGradient starting" << std::endl;
-  util::Timer timer(classname(), "NormGradient");
+  static const util::TimerId timerId(classname(), "NormGradient");
+  util::Timer timer(timerId);
   normgradient_.reset(new NormGradient_(resol.geometry(), xr.state(), conf));
   Log::trace() << "NormGradient<MODEL>::NormGradient done" << std::endl;
 }
@@ -66,7 +67,8 @@ NormGradient<MODEL>::NormGradient(const Geometry_ & resol, const State_ & xr,
 template<typename MODEL>
 NormGradient<MODEL>::~NormGradient() {
   Log::trace() << "NormGradient<MODEL>::~NormGradient starting" << std::endl;
-  util::Timer timer(classname(), "~NormGradient");
+  static const util::TimerId timerId(classname(), "~NormGradient");
+  util::Timer timer(timerId);
   normgradient_.reset();
   Log::trace() << "NormGradient<MODEL>::~NormGradient done" << std::endl;
 }
@@ -76,7 +78,8 @@ NormGradient<MODEL>::~NormGradient() {
 template<typename MODEL>
 void NormGradient<MODEL>::apply(Increment_ & dx) const {
   Log::trace() << "NormGradient<MODEL>::apply starting" << std::endl;
-  util::Timer timer(classname(), "apply");
+  static const util::TimerId timerId(classname(), "apply");
+  util::Timer timer(timerId);
   normgradient_->apply(dx.increment());
   Log::trace() << "NormGradient<MODEL>::apply done" << std::endl;
 }
@@ -86,7 +89,8 @@ void NormGradient<MODEL>::apply(Increment_ & dx) const {
 template <typename MODEL>
 void NormGradient<MODEL>::print(std::ostream & os) const {
   Log::trace() << "NormGradient<MODEL>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *normgradient_;
   Log::trace() << "NormGradient<MODEL>::print done" << std::endl;
 }
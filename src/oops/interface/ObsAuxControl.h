@@ -81,7 +81,8 @@ ObsAuxControl<OBS>::ObsAuxControl(const ObsSpace<OBS> & os,
                                     const Parameters_ & params) : aux_()
 {
   Log::trace() << "ObsAuxControl<OBS>::ObsAuxControl starting" << std::endl;
-  util::Timer timer(classname(), "ObsAuxControl");
+  static const util::TimerId timerId(classname(), "ObsAuxControl");
+  util::Timer timer(timerId);
   aux_.reset(new ObsAuxControl_(os.obsspace(), params));
   Log::trace() << "ObsAuxControl<OBS>::ObsAuxControl done" << std::endl;
 }
@@ -92,7 +93,8 @@ template<typename OBS>
 ObsAuxControl<OBS>::ObsAuxControl(const ObsAuxControl & other, const bool copy) : aux_()
 {
   Log::trace() << "ObsAuxControl<OBS>::ObsAuxControl copy starting" << std::endl;
-  util::Timer timer(classname(), "ObsAuxControl");
+  static const util::TimerId timerId(classname(), "ObsAuxControl");
+  util::Timer timer(timerId);
   aux_.reset(new ObsAuxControl_(*other.aux_, copy));
   Log::trace() << "ObsAuxControl<OBS>::ObsAuxControl copy done" << std::endl;
 }
@@ -102,7 +104,8 @@ ObsAuxControl<OBS>::ObsAuxControl(const ObsAuxControl & other, const bool copy)
 template<typename OBS>
 ObsAuxControl<OBS>::~ObsAuxControl() {
   Log::trace() << "ObsAuxControl<OBS>::~ObsAuxControl starting" << std::endl;
-  util::Timer timer(classname(), "~ObsAuxControl");
+  static const util::TimerId timerId(classname(), "~ObsAuxControl");
+  util::Timer timer(timerId);
   aux_.reset();
   Log::trace() << "ObsAuxControl<OBS>::~ObsAuxControl done" << std::endl;
 }
@@ -112,7 +115,8 @@ ObsAuxControl<OBS>::~ObsAuxControl() {
 template<typename OBS>
 void ObsAuxControl<OBS>::read(const Parameters_ & params) {
   Log::trace() << "ObsAuxControl<OBS>::read starting" << std::endl;
-  util::Timer timer(classname(), "read");
+  static const util::TimerId timerId(classname(), "read");
+  util::Timer timer(timerId);
   aux_->read(params);
   Log::trace() << "ObsAuxControl<OBS>::read done" << std::endl;
 }
@@ -122,7 +126,8 @@ void ObsAuxControl<OBS>::read(const Parameters_ & params) {
 template<typename OBS>
 void ObsAuxControl<OBS>::write(const Parameters_ & params) const {
   Log::trace() << "ObsAuxControl<OBS>::write starting" << std::endl;
-  util::Timer timer(classname(), "write");
+  static const util::TimerId timerId(classname(), "write");
+  util::Timer timer(timerId);
   aux_->write(params);
   Log::trace() << "ObsAuxControl<OBS>::write done" << std::endl;
 }
@@ -132,7 +137,8 @@ void ObsAuxControl<OBS>::write(const Parameters_ & params) const {
 template<typename OBS>
 double ObsAuxControl<OBS>::norm() const {
   Log::trace() << "ObsAuxControl<OBS>::norm starting" << std::endl;
-  util::Timer timer(classname(), "norm");
+  static const util::TimerId timerId(classname(), "norm");
+  util::Timer timer(timerId);
   double zz = aux_->norm();
   Log::trace() << "ObsAuxControl<OBS>::norm done" << std::endl;
   return zz;
@@ -143,7 +149,8 @@ double ObsAuxControl<OBS>::norm() const {
 template<typename OBS>
 const Variables & ObsAuxControl<OBS>::requiredVars() const {
   Log::trace() << "ObsAuxControl<OBS>::requiredVars starting" << std::endl;
-  util::Timer timer(classname(), "requiredVars");
+  static const util::TimerId timerId(classname(), "requiredVars");
+  util::Timer timer(timerId);
   Log::trace() << "ObsAuxControl<OBS>::requiredVars done" << std::endl;
   return aux_->requiredVars();
 }
@@ -153,7 +160,8 @@ const Variables & ObsAuxControl<OBS>::requiredVars() const {
 template<typename OBS>
 const Variables & ObsAuxControl<OBS>::requiredHdiagnostics() const {
   Log::trace() << "ObsAuxControl<OBS>::requiredHdiagnostics starting" << std::endl;
-  util::Timer timer(classname(), "requiredHdiagnostics");
+  static const util::TimerId timerId(classname(), "requiredHdiagnostics");
+  util::Timer timer(timerId);
   Log::trace() << "ObsAuxControl<OBS>::requiredHdiagnostics done" << std::endl;
   return aux_->requiredHdiagnostics();
 }
@@ -162,7 +170,8 @@ const Variables & ObsAuxControl<OBS>::requiredHdiagnostics() const {
 template<typename OBS>
 ObsAuxControl<OBS> & ObsAuxControl<OBS>::operator=(const ObsAuxControl & rhs) {
   Log::trace() << "ObsAuxControl<OBS>::operator= starting" << std::endl;
-  util::Timer timer(classname(), "operator=");
+  static const util::TimerId timerId(classname(), "operator=");
+  util::Timer timer(timerId);
   *aux_ = *rhs.aux_;
   Log::trace() << "ObsAuxControl<OBS>::operator= done" << std::endl;
   return *this;
@@ -173,7 +182,8 @@ ObsAuxControl<OBS> & ObsAuxControl<OBS>::operator=(const ObsAuxControl & rhs) {
 template<typename OBS>
 void ObsAuxControl<OBS>::print(std::ostream & os) const {
   Log::trace() << "ObsAuxControl<OBS>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *aux_;
   Log::trace() << "ObsAuxControl<OBS>::print done" << std::endl;
 }
@@ -81,7 +81,8 @@ ObsAuxCovariance<OBS>::ObsAuxCovariance(const ObsSpace<OBS> & os,
                                           const Parameters_ & params) : cov_()
 {
   Log::trace() << "ObsAuxCovariance<OBS>::ObsAuxCovariance starting" << std::endl;
-  util::Timer timer(classname(), "ObsAuxCovariance");
+  static const util::TimerId timerId(classname(), "ObsAuxCovariance");
+  util::Timer timer(timerId);
   cov_.reset(new ObsAuxCovariance_(os.obsspace(), params));
   Log::trace() << "ObsAuxCovariance<OBS>::ObsAuxCovariance done" << std::endl;
 }
@@ -91,7 +92,8 @@ ObsAuxCovariance<OBS>::ObsAuxCovariance(const ObsSpace<OBS> & os,
 template<typename OBS>
 ObsAuxCovariance<OBS>::~ObsAuxCovariance() {
   Log::trace() << "ObsAuxCovariance<OBS>::~ObsAuxCovariance starting" << std::endl;
-  util::Timer timer(classname(), "~ObsAuxCovariance");
+  static const util::TimerId timerId(classname(), "~ObsAuxCovariance");
+  util::Timer timer(timerId);
   cov_.reset();
   Log::trace() << "ObsAuxCovariance<OBS>::~ObsAuxCovariance done" << std::endl;
 }
@@ -102,7 +104,8 @@ template<typename OBS>
 void ObsAuxCovariance<OBS>::linearize(const ObsAuxControl_ & xx,
                                       const eckit::Configuration & innerConf) {
   Log::trace() << "ObsAuxCovariance<OBS>::linearize starting" << std::endl;
-  util::Timer timer(classname(), "linearize");
+  static const util::TimerId timerId(classname(), "linearize");
+  util::Timer timer(timerId);
   cov_->linearize(xx.obsauxcontrol(), innerConf);
   Log::trace() << "ObsAuxCovariance<OBS>::linearize done" << std::endl;
 }
@@ -112,7 +115,8 @@ void ObsAuxCovariance<OBS>::linearize(const ObsAuxControl_ & xx,
 template<typename OBS>
 void ObsAuxCovariance<OBS>::multiply(const ObsAuxIncrement_ & dx1, ObsAuxIncrement_ & dx2) const {
   Log::trace() << "ObsAuxCovariance<OBS>::multiply starting" << std::endl;
-  util::Timer timer(classname(), "multiply");
+  static const util::TimerId timerId(classname(), "multiply");
+  util::Timer timer(timerId);
   cov_->multiply(dx1.obsauxincrement(), dx2.obsauxincrement());
   Log::trace() << "ObsAuxCovariance<OBS>::multiply done" << std::endl;
 }
@@ -123,7 +127,8 @@ template<typename OBS>
 void ObsAuxCovariance<OBS>::inverseMultiply(const ObsAuxIncrement_ & dx1,
                                               ObsAuxIncrement_ & dx2) const {
   Log::trace() << "ObsAuxCovariance<OBS>::inverseMultiply starting" << std::endl;
-  util::Timer timer(classname(), "inverseMultiply");
+  static const util::TimerId timerId(classname(), "inverseMultiply");
+  util::Timer timer(timerId);
   cov_->inverseMultiply(dx1.obsauxincrement(), dx2.obsauxincrement());
   Log::trace() << "ObsAuxCovariance<OBS>::inverseMultiply done" << std::endl;
 }
@@ -133,7 +138,8 @@ void ObsAuxCovariance<OBS>::inverseMultiply(const ObsAuxIncrement_ & dx1,
 template<typename OBS>
 void ObsAuxCovariance<OBS>::randomize(ObsAuxIncrement_ & dx) const {
   Log::trace() << "ObsAuxCovariance<OBS>::randomize starting" << std::endl;
-  util::Timer timer(classname(), "randomize");
+  static const util::TimerId timerId(classname(), "randomize");
+  util::Timer timer(timerId);
   cov_->randomize(dx.obsauxincrement());
   Log::trace() << "ObsAuxCovariance<OBS>::randomize done" << std::endl;
 }
@@ -143,7 +149,8 @@ void ObsAuxCovariance<OBS>::randomize(ObsAuxIncrement_ & dx) const {
 template<typename OBS>
 void ObsAuxCovariance<OBS>::write(const Parameters_ & params) const {
   Log::trace() << "ObsAuxCovariance<OBS>::write starting" << std::endl;
-  util::Timer timer(classname(), "write");
+  static const util::TimerId timerId(classname(), "write");
+  util::Timer timer(timerId);
   cov_->write(params);
   Log::trace() << "ObsAuxCovariance<OBS>::write done" << std::endl;
 }
@@ -152,7 +159,8 @@ void ObsAuxCovariance<OBS>::write(const Parameters_ & params) const {
 template<typename OBS>
 ObsAuxPreconditioner<OBS> ObsAuxCovariance<OBS>::preconditioner() const {
     Log::trace() << "ObsAuxCovariance<OBS>::preconditioner" << std::endl;
-    util::Timer timer(classname(), "preconditioner");
+    static const util::TimerId timerId(classname(), "preconditioner");
+    util::Timer timer(timerId);
     return ObsAuxPreconditioner_(cov_->preconditioner());
 }
 
@@ -161,7 +169,8 @@ ObsAuxPreconditioner<OBS> ObsAuxCovariance<OBS>::preconditioner() const {
 template<typename OBS>
 void ObsAuxCovariance<OBS>::print(std::ostream & os) const {
   Log::trace() << "ObsAuxCovariance<OBS>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *cov_;
   Log::trace() << "ObsAuxCovariance<OBS>::print done" << std::endl;
 }
@@ -97,7 +97,8 @@ class ObsAuxIncrement : public util::Printable,
 template <typename OBS>
 ObsAuxControl<OBS> & operator+=(ObsAuxControl<OBS> & xx, const ObsAuxIncrement<OBS> & dx) {
   Log::trace() << "operator+=(ObsAuxControl, ObsAuxIncrement) starting" << std::endl;
-  util::Timer timer("oops::ObsAuxIncrement", "operator+=ObsAuxControl");
+  static const util::TimerId timerId("oops::ObsAuxIncrement", "operator+=ObsAuxControl");
+  util::Timer timer(timerId);
   xx.obsauxcontrol() += dx.obsauxincrement();
   Log::trace() << "operator+=(ObsAuxControl, ObsAuxIncrement) done" << std::endl;
   return xx;
@@ -110,7 +111,8 @@ ObsAuxIncrement<OBS>::ObsAuxIncrement(const ObsSpace<OBS> & os,
                                       const Parameters_ & params) : aux_()
 {
   Log::trace() << "ObsAuxIncrement<OBS>::ObsAuxIncrement starting" << std::endl;
-  util::Timer timer(classname(), "ObsAuxIncrement");
+  static const util::TimerId timerId(classname(), "ObsAuxIncrement");
+  util::Timer timer(timerId);
   aux_.reset(new ObsAuxIncrement_(os.obsspace(), params));
   this->setObjectSize(aux_->serialSize()*sizeof(double));
   Log::trace() << "ObsAuxIncrement<OBS>::ObsAuxIncrement done" << std::endl;
@@ -121,7 +123,8 @@ ObsAuxIncrement<OBS>::ObsAuxIncrement(const ObsAuxIncrement & other,
                                       const bool copy) : aux_()
 {
   Log::trace() << "ObsAuxIncrement<OBS>::ObsAuxIncrement copy starting" << std::endl;
-  util::Timer timer(classname(), "ObsAuxIncrement");
+  static const util::TimerId timerId(classname(), "ObsAuxIncrement");
+  util::Timer timer(timerId);
   aux_.reset(new ObsAuxIncrement_(*other.aux_, copy));
   this->setObjectSize(aux_->serialSize()*sizeof(double));
   Log::trace() << "ObsAuxIncrement<OBS>::ObsAuxIncrement copy done" << std::endl;
@@ -130,7 +133,8 @@ ObsAuxIncrement<OBS>::ObsAuxIncrement(const ObsAuxIncrement & other,
 template<typename OBS>
 ObsAuxIncrement<OBS>::~ObsAuxIncrement() {
   Log::trace() << "ObsAuxIncrement<OBS>::~ObsAuxIncrement starting" << std::endl;
-  util::Timer timer(classname(), "~ObsAuxIncrement");
+  static const util::TimerId timerId(classname(), "~ObsAuxIncrement");
+  util::Timer timer(timerId);
   aux_.reset();
   Log::trace() << "ObsAuxIncrement<OBS>::~ObsAuxIncrement done" << std::endl;
 }
@@ -138,7 +142,8 @@ ObsAuxIncrement<OBS>::~ObsAuxIncrement() {
 template<typename OBS>
 void ObsAuxIncrement<OBS>::diff(const ObsAuxControl_ & x1, const ObsAuxControl_ & x2) {
   Log::trace() << "ObsAuxIncrement<OBS>::diff starting" << std::endl;
-  util::Timer timer(classname(), "diff");
+  static const util::TimerId timerId(classname(), "diff");
+  util::Timer timer(timerId);
   aux_->diff(x1.obsauxcontrol(), x2.obsauxcontrol());
   Log::trace() << "ObsAuxIncrement<OBS>::diff done" << std::endl;
 }
@@ -146,7 +151,8 @@ void ObsAuxIncrement<OBS>::diff(const ObsAuxControl_ & x1, const ObsAuxControl_
 template<typename OBS>
 void ObsAuxIncrement<OBS>::zero() {
   Log::trace() << "ObsAuxIncrement<OBS>::zero starting" << std::endl;
-  util::Timer timer(classname(), "zero");
+  static const util::TimerId timerId(classname(), "zero");
+  util::Timer timer(timerId);
   aux_->zero();
   Log::trace() << "ObsAuxIncrement<OBS>::zero done" << std::endl;
 }
@@ -154,7 +160,8 @@ void ObsAuxIncrement<OBS>::zero() {
 template<typename OBS>
 ObsAuxIncrement<OBS> & ObsAuxIncrement<OBS>::operator=(const ObsAuxIncrement & rhs) {
   Log::trace() << "ObsAuxIncrement<OBS>::operator= starting" << std::endl;
-  util::Timer timer(classname(), "operator=");
+  static const util::TimerId timerId(classname(), "operator=");
+  util::Timer timer(timerId);
   *aux_ = *rhs.aux_;
   Log::trace() << "ObsAuxIncrement<OBS>::operator= done" << std::endl;
   return *this;
@@ -163,7 +170,8 @@ ObsAuxIncrement<OBS> & ObsAuxIncrement<OBS>::operator=(const ObsAuxIncrement & r
 template<typename OBS>
 ObsAuxIncrement<OBS> & ObsAuxIncrement<OBS>::operator+=(const ObsAuxIncrement & rhs) {
   Log::trace() << "ObsAuxIncrement<OBS>::operator+= starting" << std::endl;
-  util::Timer timer(classname(), "operator+=");
+  static const util::TimerId timerId(classname(), "operator+=");
+  util::Timer timer(timerId);
   *aux_ += *rhs.aux_;
   Log::trace() << "ObsAuxIncrement<OBS>::operator+= done" << std::endl;
   return *this;
@@ -172,7 +180,8 @@ ObsAuxIncrement<OBS> & ObsAuxIncrement<OBS>::operator+=(const ObsAuxIncrement &
 template<typename OBS>
 ObsAuxIncrement<OBS> & ObsAuxIncrement<OBS>::operator-=(const ObsAuxIncrement & rhs) {
   Log::trace() << "ObsAuxIncrement<OBS>::operator-= starting" << std::endl;
-  util::Timer timer(classname(), "operator-=");
+  static const util::TimerId timerId(classname(), "operator-=");
+  util::Timer timer(timerId);
   *aux_ -= *rhs.aux_;
   Log::trace() << "ObsAuxIncrement<OBS>::operator-= done" << std::endl;
   return *this;
@@ -181,7 +190,8 @@ ObsAuxIncrement<OBS> & ObsAuxIncrement<OBS>::operator-=(const ObsAuxIncrement &
 template<typename OBS>
 ObsAuxIncrement<OBS> & ObsAuxIncrement<OBS>::operator*=(const double & zz) {
   Log::trace() << "ObsAuxIncrement<OBS>::operator*= starting" << std::endl;
-  util::Timer timer(classname(), "operator*=");
+  static const util::TimerId timerId(classname(), "operator*=");
+  util::Timer timer(timerId);
   *aux_ *= zz;
   Log::trace() << "ObsAuxIncrement<OBS>::operator*= done" << std::endl;
   return *this;
@@ -190,7 +200,8 @@ ObsAuxIncrement<OBS> & ObsAuxIncrement<OBS>::operator*=(const double & zz) {
 template<typename OBS>
 void ObsAuxIncrement<OBS>::axpy(const double & zz, const ObsAuxIncrement & dx) {
   Log::trace() << "ObsAuxIncrement<OBS>::axpy starting" << std::endl;
-  util::Timer timer(classname(), "axpy");
+  static const util::TimerId timerId(classname(), "axpy");
+  util::Timer timer(timerId);
   aux_->axpy(zz, *dx.aux_);
   Log::trace() << "ObsAuxIncrement<OBS>::axpy done" << std::endl;
 }
@@ -198,7 +209,8 @@ void ObsAuxIncrement<OBS>::axpy(const double & zz, const ObsAuxIncrement & dx) {
 template<typename OBS>
 double ObsAuxIncrement<OBS>::dot_product_with(const ObsAuxIncrement & dx) const {
   Log::trace() << "ObsAuxIncrement<OBS>::dot_product_with starting" << std::endl;
-  util::Timer timer(classname(), "dot_product_with");
+  static const util::TimerId timerId(classname(), "dot_product_with");
+  util::Timer timer(timerId);
   double zz = aux_->dot_product_with(*dx.aux_);
   Log::trace() << "ObsAuxIncrement<OBS>::dot_product_with done" << std::endl;
   return zz;
@@ -207,7 +219,8 @@ double ObsAuxIncrement<OBS>::dot_product_with(const ObsAuxIncrement & dx) const
 template<typename OBS>
 void ObsAuxIncrement<OBS>::read(const eckit::Configuration & conf) {
   Log::trace() << "ObsAuxIncrement<OBS>::read starting" << std::endl;
-  util::Timer timer(classname(), "read");
+  static const util::TimerId timerId(classname(), "read");
+  util::Timer timer(timerId);
   aux_->read(conf);
   Log::trace() << "ObsAuxIncrement<OBS>::read done" << std::endl;
 }
@@ -215,7 +228,8 @@ void ObsAuxIncrement<OBS>::read(const eckit::Configuration & conf) {
 template<typename OBS>
 void ObsAuxIncrement<OBS>::write(const eckit::Configuration & conf) const {
   Log::trace() << "ObsAuxIncrement<OBS>::write starting" << std::endl;
-  util::Timer timer(classname(), "write");
+  static const util::TimerId timerId(classname(), "write");
+  util::Timer timer(timerId);
   aux_->write(conf);
   Log::trace() << "ObsAuxIncrement<OBS>::write done" << std::endl;
 }
@@ -223,7 +237,8 @@ void ObsAuxIncrement<OBS>::write(const eckit::Configuration & conf) const {
 template<typename OBS>
 double ObsAuxIncrement<OBS>::norm() const {
   Log::trace() << "ObsAuxIncrement<OBS>::norm starting" << std::endl;
-  util::Timer timer(classname(), "norm");
+  static const util::TimerId timerId(classname(), "norm");
+  util::Timer timer(timerId);
   double zz = aux_->norm();
   Log::trace() << "ObsAuxIncrement<OBS>::norm done" << std::endl;
   return zz;
@@ -232,14 +247,16 @@ double ObsAuxIncrement<OBS>::norm() const {
 template<typename OBS>
 size_t ObsAuxIncrement<OBS>::serialSize() const {
   Log::trace() << "ObsAuxIncrement<OBS>::serialSize" << std::endl;
-  util::Timer timer(classname(), "serialSize");
+  static const util::TimerId timerId(classname(), "serialSize");
+  util::Timer timer(timerId);
   return aux_->serialSize();
 }
 // -----------------------------------------------------------------------------
 template<typename OBS>
 void ObsAuxIncrement<OBS>::serialize(std::vector<double> & vect) const {
   Log::trace() << "ObsAuxIncrement<OBS>::serialize starting" << std::endl;
-  util::Timer timer(classname(), "serialize");
+  static const util::TimerId timerId(classname(), "serialize");
+  util::Timer timer(timerId);
   aux_->serialize(vect);
   Log::trace() << "ObsAuxIncrement<OBS>::serialize done" << std::endl;
 }
@@ -247,7 +264,8 @@ void ObsAuxIncrement<OBS>::serialize(std::vector<double> & vect) const {
 template<typename OBS>
 void ObsAuxIncrement<OBS>::deserialize(const std::vector<double> & vect, size_t & current) {
   Log::trace() << "ObsAuxIncrement<OBS>::deserialize starting" << std::endl;
-  util::Timer timer(classname(), "deserialize");
+  static const util::TimerId timerId(classname(), "deserialize");
+  util::Timer timer(timerId);
   aux_->deserialize(vect, current);
   Log::trace() << "ObsAuxIncrement<OBS>::deserialize done" << std::endl;
 }
@@ -255,7 +273,8 @@ void ObsAuxIncrement<OBS>::deserialize(const std::vector<double> & vect, size_t
 template<typename OBS>
 void ObsAuxIncrement<OBS>::print(std::ostream & os) const {
   Log::trace() << "ObsAuxIncrement<OBS>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *aux_;
   Log::trace() << "ObsAuxIncrement<OBS>::print done" << std::endl;
 }
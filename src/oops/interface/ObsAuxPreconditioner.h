@@ -62,7 +62,8 @@ ObsAuxPreconditioner<OBS>::ObsAuxPreconditioner(std::unique_ptr<ObsAuxPreconditi
 template<typename OBS>
 ObsAuxPreconditioner<OBS>::~ObsAuxPreconditioner() {
   Log::trace() << "ObsAuxPreconditioner<OBS>::~ObsAuxPreconditioner starting" << std::endl;
-  util::Timer timer(classname(), "~ObsAuxPreconditioner");
+  static const util::TimerId timerId(classname(), "~ObsAuxPreconditioner");
+  util::Timer timer(timerId);
   precon_.reset();
   Log::trace() << "ObsAuxPreconditioner<OBS>::~ObsAuxPreconditioner done" << std::endl;
 }
@@ -73,7 +74,8 @@ template<typename OBS>
 void ObsAuxPreconditioner<OBS>::multiply(const ObsAuxIncrement_ & dx1,
                                          ObsAuxIncrement_ & dx2) const {
   Log::trace() << "ObsAuxPreconditioner<OBS>::multiply starting" << std::endl;
-  util::Timer timer(classname(), "multiply");
+  static const util::TimerId timerId(classname(), "multiply");
+  util::Timer timer(timerId);
   precon_->multiply(dx1.obsauxincrement(), dx2.obsauxincrement());
   Log::trace() << "ObsAuxPreconditioner<OBS>::multiply done" << std::endl;
 }
@@ -83,7 +85,8 @@ void ObsAuxPreconditioner<OBS>::multiply(const ObsAuxIncrement_ & dx1,
 template<typename OBS>
 void ObsAuxPreconditioner<OBS>::print(std::ostream & os) const {
   Log::trace() << "ObsAuxPreconditioner<OBS>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *precon_;
   Log::trace() << "ObsAuxPreconditioner<OBS>::print done" << std::endl;
 }
@@ -29,7 +29,8 @@ ObsDataVector<OBS, DATATYPE>::ObsDataVector(const ObsSpace<OBS> & os,
   : data_()
 {
   Log::trace() << "ObsDataVector<OBS, DATATYPE>::ObsDataVector starting" << std::endl;
-  util::Timer timer(classname(), "ObsDataVector");
+  static const util::TimerId timerId(classname(), "ObsDataVector");
+  util::Timer timer(timerId);
   data_.reset(new ObsDataVec_(os.obsspace(), vars, name));
   Log::trace() << "ObsDataVector<OBS, DATATYPE>::ObsDataVector done" << std::endl;
 }
@@ -37,7 +38,8 @@ ObsDataVector<OBS, DATATYPE>::ObsDataVector(const ObsSpace<OBS> & os,
 template <typename OBS, typename DATATYPE>
 ObsDataVector<OBS, DATATYPE>::ObsDataVector(const ObsDataVector & other): data_() {
   Log::trace() << "ObsDataVector<OBS, DATATYPE>::ObsDataVector starting" << std::endl;
-  util::Timer timer(classname(), "ObsDataVector");
+  static const util::TimerId timerId(classname(), "ObsDataVector");
+  util::Timer timer(timerId);
   data_.reset(new ObsDataVec_(*other.data_));
   Log::trace() << "ObsDataVector<OBS, DATATYPE>::ObsDataVector done" << std::endl;
 }
@@ -45,7 +47,8 @@ ObsDataVector<OBS, DATATYPE>::ObsDataVector(const ObsDataVector & other): data_(
 template <typename OBS, typename DATATYPE>
 ObsDataVector<OBS, DATATYPE>::ObsDataVector(ObsVector<OBS> & other): data_() {
   Log::trace() << "ObsDataVector<OBS, DATATYPE>::ObsDataVector starting" << std::endl;
-  util::Timer timer(classname(), "ObsDataVector");
+  static const util::TimerId timerId(classname(), "ObsDataVector");
+  util::Timer timer(timerId);
   data_.reset(new ObsDataVec_(other.obsvector()));
   Log::trace() << "ObsDataVector<OBS, DATATYPE>::ObsDataVector done" << std::endl;
 }
@@ -53,7 +56,8 @@ ObsDataVector<OBS, DATATYPE>::ObsDataVector(ObsVector<OBS> & other): data_() {
 template <typename OBS, typename DATATYPE>
 ObsDataVector<OBS, DATATYPE>::~ObsDataVector() {
   Log::trace() << "ObsDataVector<OBS, DATATYPE>::~ObsDataVector starting" << std::endl;
-  util::Timer timer(classname(), "~ObsDataVector");
+  static const util::TimerId timerId(classname(), "~ObsDataVector");
+  util::Timer timer(timerId);
   data_.reset();
   Log::trace() << "ObsDataVector<OBS, DATATYPE>::~ObsDataVector done" << std::endl;
 }
@@ -61,7 +65,8 @@ ObsDataVector<OBS, DATATYPE>::~ObsDataVector() {
 template <typename OBS, typename DATATYPE> ObsDataVector<OBS, DATATYPE> &
 ObsDataVector<OBS, DATATYPE>::operator=(const ObsDataVector & rhs) {
   Log::trace() << "ObsDataVector<OBS, DATATYPE>::operator= starting" << std::endl;
-  util::Timer timer(classname(), "operator=");
+  static const util::TimerId timerId(classname(), "operator=");
+  util::Timer timer(timerId);
   *data_ = *rhs.data_;
   Log::trace() << "ObsDataVector<OBS, DATATYPE>::operator= done" << std::endl;
   return *this;
@@ -70,7 +75,8 @@ ObsDataVector<OBS, DATATYPE>::operator=(const ObsDataVector & rhs) {
 template <typename OBS, typename DATATYPE>
 void ObsDataVector<OBS, DATATYPE>::zero() {
   Log::trace() << "ObsDataVector<OBS, DATATYPE>::zero starting" << std::endl;
-  util::Timer timer(classname(), "zero");
+  static const util::TimerId timerId(classname(), "zero");
+  util::Timer timer(timerId);
   data_->zero();
   Log::trace() << "ObsDataVector<OBS, DATATYPE>::zero done" << std::endl;
 }
@@ -78,7 +84,8 @@ void ObsDataVector<OBS, DATATYPE>::zero() {
 template <typename OBS, typename DATATYPE>
 void ObsDataVector<OBS, DATATYPE>::mask(const ObsDataVector<OBS, int> & qc) {
   Log::trace() << "ObsDataVector<OBS>::mask starting" << std::endl;
-  util::Timer timer(classname(), "mask");
+  static const util::TimerId timerId(classname(), "mask");
+  util::Timer timer(timerId);
   data_->mask(qc.obsdatavector());
   Log::trace() << "ObsDataVector<OBS>::mask done" << std::endl;
 }
@@ -86,7 +93,8 @@ void ObsDataVector<OBS, DATATYPE>::mask(const ObsDataVector<OBS, int> & qc) {
 template <typename OBS, typename DATATYPE>
 void ObsDataVector<OBS, DATATYPE>::print(std::ostream & os) const {
   Log::trace() << "ObsDataVector<OBS, DATATYPE>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *data_;
   Log::trace() << "ObsDataVector<OBS, DATATYPE>::print done" << std::endl;
 }
@@ -94,7 +102,8 @@ void ObsDataVector<OBS, DATATYPE>::print(std::ostream & os) const {
 template <typename OBS, typename DATATYPE>
 void ObsDataVector<OBS, DATATYPE>::read(const std::string & name) {
   Log::trace() << "ObsDataVector<OBS, DATATYPE>::read starting " << name << std::endl;
-  util::Timer timer(classname(), "read");
+  static const util::TimerId timerId(classname(), "read");
+  util::Timer timer(timerId);
   data_->read(name);
   Log::trace() << "ObsDataVector<OBS, DATATYPE>::read done" << std::endl;
 }
@@ -102,7 +111,8 @@ void ObsDataVector<OBS, DATATYPE>::read(const std::string & name) {
 template <typename OBS, typename DATATYPE>
 void ObsDataVector<OBS, DATATYPE>::save(const std::string & name) const {
   Log::trace() << "ObsDataVector<OBS, DATATYPE>::save starting " << name << std::endl;
-  util::Timer timer(classname(), "save");
+  static const util::TimerId timerId(classname(), "save");
+  util::Timer timer(timerId);
   data_->save(name);
   Log::trace() << "ObsDataVector<OBS, DATATYPE>::save done" << std::endl;
 }
@@ -67,7 +67,8 @@ ObsDiagnostics<OBS>::ObsDiagnostics(const ObsSpace_ & os, const Locations_ & loc
                                       const Variables & vars) : diags_()
 {
   Log::trace() << "ObsDiagnostics<OBS>::ObsDiagnostics starting" << std::endl;
-  util::Timer timer(classname(), "ObsDiagnostics");
+  static const util::TimerId timerId(classname(), "ObsDiagnostics");
+  util::Timer timer(timerId);
   diags_.reset(new ObsDiags_(os.obsspace(), locs.locations(), vars));
   Log::trace() << "ObsDiagnostics<OBS>::ObsDiagnostics done" << std::endl;
 }
@@ -77,7 +78,8 @@ ObsDiagnostics<OBS>::ObsDiagnostics(const Parameters_ & params, const ObsSpace_
                                       const Variables & vars) : diags_()
 {
   Log::trace() << "ObsDiagnostics<OBS>::ObsDiagnostics starting" << std::endl;
-  util::Timer timer(classname(), "ObsDiagnostics");
+  static const util::TimerId timerId(classname(), "ObsDiagnostics");
+  util::Timer timer(timerId);
   diags_.reset(new ObsDiags_(params, os.obsspace(), vars));
   Log::trace() << "ObsDiagnostics<OBS>::ObsDiagnostics done" << std::endl;
 }
@@ -85,7 +87,8 @@ ObsDiagnostics<OBS>::ObsDiagnostics(const Parameters_ & params, const ObsSpace_
 template <typename OBS>
 ObsDiagnostics<OBS>::~ObsDiagnostics() {
   Log::trace() << "ObsDiagnostics<OBS>::~ObsDiagnostics starting" << std::endl;
-  util::Timer timer(classname(), "~ObsDiagnostics");
+  static const util::TimerId timerId(classname(), "~ObsDiagnostics");
+  util::Timer timer(timerId);
   diags_.reset();
   Log::trace() << "ObsDiagnostics<OBS>::~ObsDiagnostics done" << std::endl;
 }
@@ -93,7 +96,8 @@ ObsDiagnostics<OBS>::~ObsDiagnostics() {
 template <typename OBS>
 void ObsDiagnostics<OBS>::save(const std::string & name) const {
   Log::trace() << "ObsDiagnostics<OBS, DATATYPE>::save starting " << name << std::endl;
-  util::Timer timer(classname(), "save");
+  static const util::TimerId timerId(classname(), "save");
+  util::Timer timer(timerId);
   diags_->save(name);
   Log::trace() << "ObsDiagnostics<OBS, DATATYPE>::save done" << std::endl;
 }
@@ -101,7 +105,8 @@ void ObsDiagnostics<OBS>::save(const std::string & name) const {
 template <typename OBS>
 void ObsDiagnostics<OBS>::print(std::ostream & os) const {
   Log::trace() << "ObsDiagnostics<OBS>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *diags_;
   Log::trace() << "ObsDiagnostics<OBS>::print done" << std::endl;
 }
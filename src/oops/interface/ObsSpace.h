@@ -92,7 +92,8 @@ ObsSpace<OBS>::ObsSpace(const Parameters_ & params,
                         const util::DateTime & end,
                         const eckit::mpi::Comm & time) : obsdb_(), time_(time) {
   Log::trace() << "ObsSpace<OBS>::ObsSpace starting" << std::endl;
-  util::Timer timer(classname(), "ObsSpace");
+  static const util::TimerId timerId(classname(), "ObsSpace");
+  util::Timer timer(timerId);
   size_t init = eckit::system::ResourceUsage().maxResidentSetSize();
   obsdb_.reset(new ObsSpace_(params, comm, bgn, end, time));
   size_t current = eckit::system::ResourceUsage().maxResidentSetSize();
@@ -105,7 +106,8 @@ ObsSpace<OBS>::ObsSpace(const Parameters_ & params,
 template <typename OBS>
 ObsSpace<OBS>::~ObsSpace() {
   Log::trace() << "ObsSpace<OBS>::~ObsSpace starting" << std::endl;
-  util::Timer timer(classname(), "~ObsSpace");
+  static const util::TimerId timerId(classname(), "~ObsSpace");
+  util::Timer timer(timerId);
   obsdb_.reset();
   Log::trace() << "ObsSpace<OBS>::~ObsSpace done" << std::endl;
 }
@@ -115,7 +117,8 @@ ObsSpace<OBS>::~ObsSpace() {
 template <typename OBS>
 void ObsSpace<OBS>::save() const {
   Log::trace() << "ObsSpace<OBS>::save starting" << std::endl;
-  util::Timer timer(classname(), "save");
+  static const util::TimerId timerId(classname(), "save");
+  util::Timer timer(timerId);
   obsdb_->save();
   Log::trace() << "ObsSpace<OBS>::save done" << std::endl;
 }
@@ -125,7 +128,8 @@ void ObsSpace<OBS>::save() const {
 template <typename OBS>
 void ObsSpace<OBS>::print(std::ostream & os) const {
   Log::trace() << "ObsSpace<OBS>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *obsdb_;
   Log::trace() << "ObsSpace<OBS>::print done" << std::endl;
 }
@@ -135,7 +139,8 @@ void ObsSpace<OBS>::print(std::ostream & os) const {
 template <typename OBS>
 const Variables & ObsSpace<OBS>::obsvariables() const {
   Log::trace() << "ObsSpace<OBS>::obsvariables starting" << std::endl;
-  util::Timer timer(classname(), "obsvariables");
+  static const util::TimerId timerId(classname(), "obsvariables");
+  util::Timer timer(timerId);
   return obsdb_->obsvariables();
 }
 
@@ -144,7 +149,8 @@ const Variables & ObsSpace<OBS>::obsvariables() const {
 template <typename OBS>
 const Variables & ObsSpace<OBS>::assimvariables() const {
   Log::trace() << "ObsSpace<OBS>::assimvariables starting" << std::endl;
-  util::Timer timer(classname(), "assimvariables");
+  static const util::TimerId timerId(classname(), "assimvariables");
+  util::Timer timer(timerId);
   return obsdb_->assimvariables();
 }
 
@@ -153,7 +159,8 @@ const Variables & ObsSpace<OBS>::assimvariables() const {
 template <typename OBS>
 GeometryIterator<OBS> ObsSpace<OBS>::begin() const {
   Log::trace() << "ObsSpace<OBS>::begin starting" << std::endl;
-  util::Timer timer(classname(), "begin");
+  static const util::TimerId timerId(classname(), "begin");
+  util::Timer timer(timerId);
   Log::trace() << "ObsSpace<OBS>::begin done" << std::endl;
   return ObsIterator_(obsdb_->begin());
 }
@@ -163,7 +170,8 @@ GeometryIterator<OBS> ObsSpace<OBS>::begin() const {
 template <typename OBS>
 GeometryIterator<OBS> ObsSpace<OBS>::end() const {
   Log::trace() << "ObsSpace<OBS>::end starting" << std::endl;
-  util::Timer timer(classname(), "end");
+  static const util::TimerId timerId(classname(), "end");
+  util::Timer timer(timerId);
   Log::trace() << "ObsSpace<OBS>::end done" << std::endl;
   return ObsIterator_(obsdb_->end());
 }
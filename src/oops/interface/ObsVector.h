@@ -17,6 +17,7 @@
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "oops/interface/ObsDataVector_head.h"
 #include "oops/interface/ObsSpace.h"
@@ -75,6 +76,9 @@ class ObsVector : public util::Printable,
   /// Number of non-masked out observations local to this MPI task
   /// (size of an Eigen vector returned by `packEigen`)
   size_t packEigenSize(const ObsVector & mask) const;
+  /// Indices (in this MPI task's part of the vector) of the elements returned by `packEigen`,
+  /// in the same order
+  std::vector<size_t> packEigenIndices(const ObsVector & mask) const;
 
   /// Zero out this ObsVector
   void zero();
@@ -111,7 +115,8 @@ class ObsVector : public util::Printable,
 template <typename OBS>
 ObsVector<OBS>::ObsVector(const ObsSpace<OBS> & os, const std::string name) : data_() {
   Log::trace() << "ObsVector<OBS>::ObsVector starting " << name << std::endl;
-  util::Timer timer(classname(), "ObsVector");
+  static const util::TimerId timerId(classname(), "ObsVector");
+  util::Timer timer(timerId);
   data_.reset(new ObsVector_(os.obsspace(), name));
   this->setObjectSize(data_->size() * sizeof(double));
   Log::trace() << "ObsVector<OBS>::ObsVector done" << std::endl;
@@ -121,7 +126,8 @@ template <typename OBS>
 ObsVector<OBS>::ObsVector(std::unique_ptr<ObsVector_> obsvector)
   : data_(std::move(obsvector)) {
   Log::trace() << "ObsVector<OBS>::ObsVector starting " << std::endl;
-  util::Timer timer(classname(), "ObsVector");
+  static const util::TimerId timerId(classname(), "ObsVector");
+  util::Timer timer(timerId);
   this->setObjectSize(data_->size() * sizeof(double));
   Log::trace() << "ObsVector<OBS>::ObsVector done" << std::endl;
 }
@@ -129,7 +135,8 @@ ObsVector<OBS>::ObsVector(std::unique_ptr<ObsVector_> obsvector)
 template <typename OBS>
 ObsVector<OBS>::ObsVector(const ObsVector & other): data_() {
   Log::trace() << "ObsVector<OBS>::ObsVector starting" << std::endl;
-  util::Timer timer(classname(), "ObsVector");
+  static const util::TimerId timerId(classname(), "ObsVector");
+  util::Timer timer(timerId);
   data_.reset(new ObsVector_(*other.data_));
   this->setObjectSize(data_->size() * sizeof(double));
   Log::trace() << "ObsVector<OBS>::ObsVector done" << std::endl;
@@ -138,7 +145,8 @@ ObsVector<OBS>::ObsVector(const ObsVector & other): data_() {
 template <typename OBS>
 ObsVector<OBS>::~ObsVector() {
   Log::trace() << "ObsVector<OBS>::~ObsVector starting" << std::endl;
-  util::Timer timer(classname(), "~ObsVector");
+  static const util::TimerId timerId(classname(), "~ObsVector");
+  util::Timer timer(timerId);
   data_.reset();
   Log::trace() << "ObsVector<OBS>::~ObsVector done" << std::endl;
 }
@@ -146,7 +154,8 @@ ObsVector<OBS>::~ObsVector() {
 template <typename OBS>
 ObsVector<OBS> & ObsVector<OBS>::operator=(const ObsVector & rhs) {
   Log::trace() << "ObsVector<OBS>::operator= starting" << std::endl;
-  util::Timer timer(classname(), "operator=");
+  static const util::TimerId timerId(classname(), "operator=");
+  util::Timer timer(timerId);
 
   *data_ = *rhs.data_;
 
@@ -157,7 +166,8 @@ ObsVector<OBS> & ObsVector<OBS>::operator=(const ObsVector & rhs) {
 template <typename OBS>
 ObsVector<OBS> & ObsVector<OBS>::operator*=(const double & zz) {
   Log::trace() << "ObsVector<OBS>::operator*= starting" << std::endl;
-  util::Timer timer(classname(), "operator*=");
+  static const util::TimerId timerId(classname(), "operator*=");
+  util::Timer timer(timerId);
 
   *data_ *= zz;
 
@@ -168,7 +178,8 @@ ObsVector<OBS> & ObsVector<OBS>::operator*=(const double & zz) {
 template <typename OBS>
 ObsVector<OBS> & ObsVector<OBS>::operator+=(const ObsVector & rhs) {
   Log::trace() << "ObsVector<OBS>::operator+= starting" << std::endl;
-  util::Timer timer(classname(), "operator+=");
+  static const util::TimerId timerId(classname(), "operator+=");
+  util::Timer timer(timerId);
 
   *data_ += *rhs.data_;
 
@@ -179,7 +190,8 @@ ObsVector<OBS> & ObsVector<OBS>::operator+=(const ObsVector & rhs) {
 template <typename OBS>
 ObsVector<OBS> & ObsVector<OBS>::operator-=(const ObsVector & rhs) {
   Log::trace() << "ObsVector<OBS>::operator-= starting" << std::endl;
-  util::Timer timer(classname(), "operator-=");
+  static const util::TimerId timerId(classname(), "operator-=");
+  util::Timer timer(timerId);
 
   *data_ -= *rhs.data_;
 
@@ -190,7 +202,8 @@ ObsVector<OBS> & ObsVector<OBS>::operator-=(const ObsVector & rhs) {
 template <typename OBS>
 ObsVector<OBS> & ObsVector<OBS>::operator*=(const ObsVector & rhs) {
   Log::trace() << "ObsVector<OBS>::operator*= starting" << std::endl;
-  util::Timer timer(classname(), "operator*=");
+  static const util::TimerId timerId(classname(), "operator*=");
+  util::Timer timer(timerId);
 
   *data_ *= *rhs.data_;
 
@@ -201,7 +214,8 @@ ObsVector<OBS> & ObsVector<OBS>::operator*=(const ObsVector & rhs) {
 template <typename OBS>
 ObsVector<OBS> & ObsVector<OBS>::operator/=(const ObsVector & rhs) {
   Log::trace() << "ObsVector<OBS>::operator/= starting" << std::endl;
-  util::Timer timer(classname(), "operator/=");
+  static const util::TimerId timerId(classname(), "operator/=");
+  util::Timer timer(timerId);
 
   *data_ /= *rhs.data_;
 
@@ -212,7 +226,8 @@ ObsVector<OBS> & ObsVector<OBS>::operator/=(const ObsVector & rhs) {
 template <typename OBS>
 void ObsVector<OBS>::zero() {
   Log::trace() << "ObsVector<OBS>::zero starting" << std::endl;
-  util::Timer timer(classname(), "zero");
+  static const util::TimerId timerId(classname(), "zero");
+  util::Timer timer(timerId);
 
   data_->zero();
 
@@ -222,7 +237,8 @@ void ObsVector<OBS>::zero() {
 template <typename OBS>
 void ObsVector<OBS>::ones() {
   Log::trace() << "ObsVector<OBS>::ones starting" << std::endl;
-  util::Timer timer(classname(), "ones");
+  static const util::TimerId timerId(classname(), "ones");
+  util::Timer timer(timerId);
 
   data_->ones();
 
@@ -232,7 +248,8 @@ void ObsVector<OBS>::ones() {
 template <typename OBS>
 void ObsVector<OBS>::axpy(const double & zz, const ObsVector & rhs) {
   Log::trace() << "ObsVector<OBS>::axpy starting" << std::endl;
-  util::Timer timer(classname(), "axpy");
+  static const util::TimerId timerId(classname(), "axpy");
+  util::Timer timer(timerId);
 
   data_->axpy(zz, *rhs.data_);
 
@@ -242,7 +259,8 @@ void ObsVector<OBS>::axpy(const double & zz, const ObsVector & rhs) {
 template <typename OBS>
 void ObsVector<OBS>::invert() {
   Log::trace() << "ObsVector<OBS>::invert starting" << std::endl;
-  util::Timer timer(classname(), "invert");
+  static const util::TimerId timerId(classname(), "invert");
+  util::Timer timer(timerId);
 
   data_->invert();
 
@@ -252,7 +270,8 @@ void ObsVector<OBS>::invert() {
 template <typename OBS>
 void ObsVector<OBS>::random() {
   Log::trace() << "ObsVector<OBS>::random starting" << std::endl;
-  util::Timer timer(classname(), "random");
+  static const util::TimerId timerId(classname(), "random");
+  util::Timer timer(timerId);
 
   data_->random();
 
@@ -262,7 +281,8 @@ void ObsVector<OBS>::random() {
 template <typename OBS>
 double ObsVector<OBS>::dot_product_with(const ObsVector & other) const {
   Log::trace() << "ObsVector<OBS>::dot_product starting" << std::endl;
-  util::Timer timer(classname(), "dot_product");
+  static const util::TimerId timerId(classname(), "dot_product");
+  util::Timer timer(timerId);
 
   double zz = data_->dot_product_with(*other.data_);
 
@@ -273,7 +293,8 @@ double ObsVector<OBS>::dot_product_with(const ObsVector & other) const {
 template <typename OBS>
 void ObsVector<OBS>::mask(const ObsVector & mask) {
   Log::trace() << "ObsVector<OBS>::mask(ObsVector) starting" << std::endl;
-  util::Timer timer(classname(), "mask(ObsVector)");
+  static const util::TimerId timerId(classname(), "mask(ObsVector)");
+  util::Timer timer(timerId);
   data_->mask(mask.obsvector());
   Log::trace() << "ObsVector<OBS>::mask(ObsVector) done" << std::endl;
 }
@@ -281,7 +302,8 @@ void ObsVector<OBS>::mask(const ObsVector & mask) {
 template <typename OBS>
 ObsVector<OBS> & ObsVector<OBS>::operator=(const ObsDataVector<OBS, float> & rhs) {
   Log::trace() << "ObsVector<OBS>::operator= starting" << std::endl;
-  util::Timer timer(classname(), "operator=");
+  static const util::TimerId timerId(classname(), "operator=");
+  util::Timer timer(timerId);
   *data_ = rhs.obsdatavector();
   Log::trace() << "ObsVector<OBS>::operator= done" << std::endl;
   return *this;
@@ -290,7 +312,8 @@ ObsVector<OBS> & ObsVector<OBS>::operator=(const ObsDataVector<OBS, float> & rhs
 template <typename OBS>
 double ObsVector<OBS>::rms() const {
   Log::trace() << "ObsVector<OBS>::rms starting" << std::endl;
-  util::Timer timer(classname(), "rms");
+  static const util::TimerId timerId(classname(), "rms");
+  util::Timer timer(timerId);
 
   double zz = data_->rms();
 
@@ -307,7 +330,8 @@ unsigned int ObsVector<OBS>::nobs() const {
 template <typename OBS>
 void ObsVector<OBS>::print(std::ostream & os) const {
   Log::trace() << "ObsVector<OBS>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *data_;
   Log::trace() << "ObsVector<OBS>::print done" << std::endl;
 }
@@ -315,7 +339,8 @@ void ObsVector<OBS>::print(std::ostream & os) const {
 template <typename OBS>
 void ObsVector<OBS>::save(const std::string & name) const {
   Log::trace() << "ObsVector<OBS>::save starting " << name << std::endl;
-  util::Timer timer(classname(), "save");
+  static const util::TimerId timerId(classname(), "save");
+  util::Timer timer(timerId);
 
   data_->save(name);
 
@@ -325,7 +350,8 @@ void ObsVector<OBS>::save(const std::string & name) const {
 template <typename OBS>
 Eigen::VectorXd  ObsVector<OBS>::packEigen(const ObsVector & mask) const {
   Log::trace() << "ObsVector<OBS>::packEigen starting " << std::endl;
-  util::Timer timer(classname(), "packEigen");
+  static const util::TimerId timerId(classname(), "packEigen");
+  util::Timer timer(timerId);
 
   Eigen::VectorXd vec = data_->packEigen(mask.obsvector());
 
@@ -336,7 +362,8 @@ Eigen::VectorXd  ObsVector<OBS>::packEigen(const ObsVector & mask) const {
 template <typename OBS>
 size_t ObsVector<OBS>::packEigenSize(const ObsVector & mask) const {
   Log::trace() << "ObsVector<OBS>::packEigenSize starting " << std::endl;
-  util::Timer timer(classname(), "packEigenSize");
+  static const util::TimerId timerId(classname(), "packEigenSize");
+  util::Timer timer(timerId);
 
   size_t len = data_->packEigenSize(mask.obsvector());
 
@@ -345,9 +372,22 @@ size_t ObsVector<OBS>::packEigenSize(const ObsVector & mask) const {
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
+std::vector<size_t> ObsVector<OBS>::packEigenIndices(const ObsVector & mask) const {
+  Log::trace() << "ObsVector<OBS>::packEigenIndices starting " << std::endl;
+  static const util::TimerId timerId(classname(), "packEigenIndices");
+  util::Timer timer(timerId);
+
+  std::vector<size_t> indices = data_->packEigenIndices(mask.obsvector());
+
+  Log::trace() << "ObsVector<OBS>::packEigenIndices done" << std::endl;
+  return indices;
+}
+// -----------------------------------------------------------------------------
+template <typename OBS>
 void ObsVector<OBS>::read(const std::string & name) {
   Log::trace() << "ObsVector<OBS>::read starting " << name << std::endl;
-  util::Timer timer(classname(), "read");
+  static const util::TimerId timerId(classname(), "read");
+  util::Timer timer(timerId);
 
   data_->read(name);
 
@@ -156,7 +156,8 @@ State<MODEL>::State(const Geometry_ & resol, const Variables & vars,
                     const util::DateTime & time) : state_(), fset_()
 {
   Log::trace() << "State<MODEL>::State starting" << std::endl;
-  util::Timer timer(classname(), "State");
+  static const util::TimerId timerId(classname(), "State");
+  util::Timer timer(timerId);
   state_.reset(new State_(resol.geometry(), vars, time));
   this->setObjectSize(state_->serialSize()*sizeof(double));
   Log::trace() << "State<MODEL>::State done" << std::endl;
@@ -169,7 +170,8 @@ State<MODEL>::State(const Geometry_ & resol,
                     const Parameters_ & params) : state_(), fset_()
 {
   Log::trace() << "State<MODEL>::State read starting" << std::endl;
-  util::Timer timer(classname(), "State");
+  static const util::TimerId timerId(classname(), "State");
+  util::Timer timer(timerId);
 
   state_.reset(new State_(
                  resol.geometry(),
@@ -185,7 +187,8 @@ State<MODEL>::State(const Geometry_ & resol, const State & other)
   : state_(), fset_()
 {
   Log::trace() << "State<MODEL>::State interpolated starting" << std::endl;
-  util::Timer timer(classname(), "State");
+  static const util::TimerId timerId(classname(), "State");
+  util::Timer timer(timerId);
   state_.reset(new State_(resol.geometry(), *other.state_));
   this->setObjectSize(state_->serialSize()*sizeof(double));
   Log::trace() << "State<MODEL>::State interpolated done" << std::endl;
@@ -197,7 +200,8 @@ template<typename MODEL>
 State<MODEL>::State(const State & other) : state_(), fset_()
 {
   Log::trace() << "State<MODEL>::State starting copy" << std::endl;
-  util::Timer timer(classname(), "State");
+  static const util::TimerId timerId(classname(), "State");
+  util::Timer timer(timerId);
   state_.reset(new State_(*other.state_));
   this->setObjectSize(state_->serialSize()*sizeof(double));
   Log::trace() << "State<MODEL>::State copy done" << std::endl;
@@ -208,7 +212,8 @@ State<MODEL>::State(const State & other) : state_(), fset_()
 template<typename MODEL>
 State<MODEL>::~State() {
   Log::trace() << "State<MODEL>::~State starting" << std::endl;
-  util::Timer timer(classname(), "~State");
+  static const util::TimerId timerId(classname(), "~State");
+  util::Timer timer(timerId);
   fset_.clear();
   state_.reset();
   Log::trace() << "State<MODEL>::~State done" << std::endl;
@@ -219,7 +224,8 @@ State<MODEL>::~State() {
 template<typename MODEL>
 State<MODEL> & State<MODEL>::operator=(const State & rhs) {
   Log::trace() << "State<MODEL>::operator= starting" << std::endl;
-  util::Timer timer(classname(), "operator=");
+  static const util::TimerId timerId(classname(), "operator=");
+  util::Timer timer(timerId);
   fset_.clear();
   *state_ = *rhs.state_;
   Log::trace() << "State<MODEL>::operator= done" << std::endl;
@@ -231,7 +237,8 @@ State<MODEL> & State<MODEL>::operator=(const State & rhs) {
 template<typename MODEL>
 void State<MODEL>::read(const Parameters_ & parameters) {
   Log::trace() << "State<MODEL>::read starting" << std::endl;
-  util::Timer timer(classname(), "read");
+  static const util::TimerId timerId(classname(), "read");
+  util::Timer timer(timerId);
   fset_.clear();
   state_->read(parametersOrConfiguration<HasParameters_<State_>::value>(parameters));
   Log::trace() << "State<MODEL>::read done" << std::endl;
@@ -256,7 +263,8 @@ void State<MODEL>::read(const eckit::Configuration & conf) {
 template<typename MODEL>
 void State<MODEL>::write(const WriteParameters_ & parameters) const {
   Log::trace() << "State<MODEL>::write starting" << std::endl;
-  util::Timer timer(classname(), "write");
+  static const util::TimerId timerId(classname(), "write");
+  util::Timer timer(timerId);
   state_->write(parametersOrConfiguration<HasWriteParameters_<State_>::value>(parameters));
   Log::trace() << "State<MODEL>::write done" << std::endl;
 }
@@ -280,7 +288,8 @@ void State<MODEL>::write(const eckit::Configuration & conf) const {
 template<typename MODEL>
 double State<MODEL>::norm() const {
   Log::trace() << "State<MODEL>::norm starting" << std::endl;
-  util::Timer timer(classname(), "norm");
+  static const util::TimerId timerId(classname(), "norm");
+  util::Timer timer(timerId);
   double zz = state_->norm();
   Log::trace() << "State<MODEL>::norm done" << std::endl;
   return zz;
@@ -291,7 +300,8 @@ double State<MODEL>::norm() const {
 template<typename MODEL>
 const Variables & State<MODEL>::variables() const {
   Log::trace() << "State<MODEL>::variables starting" << std::endl;
-  util::Timer timer(classname(), "variables");
+  static const util::TimerId timerId(classname(), "variables");
+  util::Timer timer(timerId);
   return state_->variables();
 }
 
@@ -300,7 +310,8 @@ const Variables & State<MODEL>::variables() const {
 template<typename MODEL>
 size_t State<MODEL>::serialSize() const {
   Log::trace() << "State<MODEL>::serialSize" << std::endl;
-  util::Timer timer(classname(), "serialSize");
+  static const util::TimerId timerId(classname(), "serialSize");
+  util::Timer timer(timerId);
   return state_->serialSize();
 }
 
@@ -309,7 +320,8 @@ size_t State<MODEL>::serialSize() const {
 template<typename MODEL>
 void State<MODEL>::serialize(std::vector<double> & vect) const {
   Log::trace() << "State<MODEL>::serialize starting" << std::endl;
-  util::Timer timer(classname(), "serialize");
+  static const util::TimerId timerId(classname(), "serialize");
+  util::Timer timer(timerId);
   state_->serialize(vect);
   Log::trace() << "State<MODEL>::serialize done" << std::endl;
 }
@@ -319,7 +331,8 @@ void State<MODEL>::serialize(std::vector<double> & vect) const {
 template<typename MODEL>
 void State<MODEL>::deserialize(const std::vector<double> & vect, size_t & current) {
   Log::trace() << "State<MODEL>::State deserialize starting" << std::endl;
-  util::Timer timer(classname(), "deserialize");
+  static const util::TimerId timerId(classname(), "deserialize");
+  util::Timer timer(timerId);
   fset_.clear();
   state_->deserialize(vect, current);
   Log::trace() << "State<MODEL>::State deserialize done" << std::endl;
@@ -330,7 +343,8 @@ void State<MODEL>::deserialize(const std::vector<double> & vect, size_t & curren
 template<typename MODEL>
 void State<MODEL>::toFieldSet(atlas::FieldSet & fset) const {
   Log::trace() << "State<MODEL>::toFieldSet starting" << std::endl;
-  util::Timer timer(classname(), "toFieldSet");
+  static const util::TimerId timerId(classname(), "toFieldSet");
+  util::Timer timer(timerId);
   state_->toFieldSet(fset);
   Log::trace() << "State<MODEL>::toFieldSet done" << std::endl;
 }
@@ -340,7 +354,8 @@ void State<MODEL>::toFieldSet(atlas::FieldSet & fset) const {
 template<typename MODEL>
 void State<MODEL>::print(std::ostream & os) const {
   Log::trace() << "State<MODEL>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *state_;
   Log::trace() << "State<MODEL>::print done" << std::endl;
 }
@@ -350,7 +365,8 @@ void State<MODEL>::print(std::ostream & os) const {
 template<typename MODEL>
 void State<MODEL>::zero() {
   Log::trace() << "State<MODEL>::zero starting" << std::endl;
-  util::Timer timer(classname(), "zero");
+  static const util::TimerId timerId(classname(), "zero");
+  util::Timer timer(timerId);
   fset_.clear();
   state_->zero();
   Log::trace() << "State<MODEL>::zero done" << std::endl;
@@ -361,7 +377,8 @@ void State<MODEL>::zero() {
 template<typename MODEL>
 void State<MODEL>::accumul(const double & zz, const State & xx) {
   Log::trace() << "State<MODEL>::accumul starting" << std::endl;
-  util::Timer timer(classname(), "accumul");
+  static const util::TimerId timerId(classname(), "accumul");
+  util::Timer timer(timerId);
   fset_.clear();
   state_->accumul(zz, *xx.state_);
   Log::trace() << "State<MODEL>::accumul done" << std::endl;
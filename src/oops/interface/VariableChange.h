@@ -64,7 +64,8 @@ VariableChange<MODEL>::VariableChange(const Parameters_ & parameters, const Geom
   : chvar_()
 {
   Log::trace() << "VariableChange<MODEL>::VariableChange starting" << std::endl;
-  util::Timer timer(classname(), "VariableChange");
+  static const util::TimerId timerId(classname(), "VariableChange");
+  util::Timer timer(timerId);
   chvar_.reset(new VariableChange_(parameters, geometry.geometry()));
   Log::trace() << "VariableChange<MODEL>::VariableChange done" << std::endl;
 }
@@ -74,7 +75,8 @@ VariableChange<MODEL>::VariableChange(const Parameters_ & parameters, const Geom
 template<typename MODEL>
 VariableChange<MODEL>::~VariableChange() {
   Log::trace() << "VariableChange<MODEL>::~VariableChange starting" << std::endl;
-  util::Timer timer(classname(), "~VariableChange");
+  static const util::TimerId timerId(classname(), "~VariableChange");
+  util::Timer timer(timerId);
   chvar_.reset();
   Log::trace() << "VariableChange<MODEL>::~VariableChange done" << std::endl;
 }
@@ -84,7 +86,8 @@ VariableChange<MODEL>::~VariableChange() {
 template<typename MODEL>
 void VariableChange<MODEL>::changeVar(State_ & xx, const Variables & vars) const {
   Log::trace() << "VariableChange<MODEL>::changeVar starting" << std::endl;
-  util::Timer timer(classname(), "changeVar");
+  static const util::TimerId timerId(classname(), "changeVar");
+  util::Timer timer(timerId);
   chvar_->changeVar(xx.state(), vars);
   Log::trace() << "VariableChange<MODEL>::changeVar done" << std::endl;
 }
@@ -94,7 +97,8 @@ void VariableChange<MODEL>::changeVar(State_ & xx, const Variables & vars) const
 template<typename MODEL>
 void VariableChange<MODEL>::changeVarInverse(State_ & xx, const Variables & vars) const {
   Log::trace() << "VariableChange<MODEL>::changeVarInverse starting" << std::endl;
-  util::Timer timer(classname(), "changeVarInverse");
+  static const util::TimerId timerId(classname(), "changeVarInverse");
+  util::Timer timer(timerId);
   chvar_->changeVarInverse(xx.state(), vars);
   Log::trace() << "VariableChange<MODEL>::changeVarInverse done" << std::endl;
 }
@@ -104,7 +108,8 @@ void VariableChange<MODEL>::changeVarInverse(State_ & xx, const Variables & vars
 template<typename MODEL>
 void VariableChange<MODEL>::print(std::ostream & os) const {
   Log::trace() << "VariableChange<MODEL>::print starting" << std::endl;
-  util::Timer timer(classname(), "print");
+  static const util::TimerId timerId(classname(), "print");
+  util::Timer timer(timerId);
   os << *chvar_;
   Log::trace() << "VariableChange<MODEL>::print done" << std::endl;
 }
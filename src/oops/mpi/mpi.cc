@@ -10,9 +10,11 @@
 
 #include "oops/mpi/mpi.h"
 
+#include <memory>
 #include <numeric>  // for accumulate()
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "eckit/exception/Exceptions.h"
 #include "oops/util/DateTime.h"
@@ -93,6 +95,35 @@ const eckit::mpi::Comm & myself() {
 
 // ------------------------------------------------------------------------------------------------
 
+namespace {
+/// Serialization vectors not held by a SerialBuffer, per thread
+std::vector<std::unique_ptr<std::vector<double>>> & serialBufferPool() {
+  static thread_local std::vector<std::unique_ptr<std::vector<double>>> pool;
+  return pool;
+}
+}  // namespace
+
+const size_t SerialBuffer::maxKeptSize;
+
+SerialBuffer::SerialBuffer() : buffer_() {
+  std::vector<std::unique_ptr<std::vector<double>>> & pool = serialBufferPool();
+  if (pool.empty()) {
+    buffer_.reset(new std::vector<double>());
+  } else {
+    buffer_ = std::move(pool.back());
+    pool.pop_back();
+  }
+}
+
+SerialBuffer::~SerialBuffer() {
+  if (buffer_->capacity() <= maxKeptSize) {
+    buffer_->clear();
+    serialBufferPool().push_back(std::move(buffer_));
+  }
+}
+
+// ------------------------------------------------------------------------------------------------
+
 void gather(const eckit::mpi::Comm & comm, const std::vector<double> & send,
             std::vector<double> & recv, const size_t root) {
   size_t ntasks = comm.size();
@@ -12,10 +12,13 @@
 
 #include <Eigen/Dense>
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <boost/noncopyable.hpp>
+
 #include "eckit/exception/Exceptions.h"
 #include "eckit/mpi/Comm.h"
 
@@ -38,13 +41,36 @@ const eckit::mpi::Comm & myself();
 
 // ------------------------------------------------------------------------------------------------
 
+/// Buffer used to serialize the objects transferred by the functions below. The vectors are
+/// kept between transfers (in a pool per thread) so that repeated transfers of objects of the
+/// same size do not allocate memory. Each SerialBuffer holds its own vector, returned empty,
+/// until it is destroyed, so nested transfers use different vectors. Vectors grown beyond
+/// maxKeptSize are freed instead of being kept.
+class SerialBuffer : private boost::noncopyable {
+ public:
+  static const size_t maxKeptSize = 4194304;  // doubles (32 MiB)
+
+  SerialBuffer();
+  ~SerialBuffer();
+
+  std::vector<double> & get() {return *buffer_;}
+
+ private:
+  std::unique_ptr<std::vector<double>> buffer_;
+};
+
+// ------------------------------------------------------------------------------------------------
+
 /// Extend eckit Comm for Serializable oops objects
 
 template <typename SERIALIZABLE>
 void send(const eckit::mpi::Comm & comm, const SERIALIZABLE & sendobj,
           const int dest, const int tag) {
-  util::Timer timer("oops::mpi", "send");
-  std::vector<double> sendbuf;
+  static const util::TimerId timerId("oops::mpi", "send");
+  util::Timer timer(timerId);
+  SerialBuffer buffer;
+  std::vector<double> & sendbuf = buffer.get();
+  sendbuf.reserve(sendobj.serialSize());
   sendobj.serialize(sendbuf);
   comm.send(sendbuf.data(), sendbuf.size(), dest, tag);
 }
@@ -54,9 +80,12 @@ void send(const eckit::mpi::Comm & comm, const SERIALIZABLE & sendobj,
 template <typename SERIALIZABLE>
 void receive(const eckit::mpi::Comm & comm, SERIALIZABLE & recvobj,
              const int source, const int tag) {
-  util::Timer timer("oops::mpi", "receive");
+  static const util::TimerId timerId("oops::mpi", "receive");
+  util::Timer timer(timerId);
   size_t sz = recvobj.serialSize();
-  std::vector<double> recvbuf(sz);
+  SerialBuffer buffer;
+  std::vector<double> & recvbuf = buffer.get();
+  recvbuf.resize(sz);
   eckit::mpi::Status status = comm.receive(recvbuf.data(), sz, source, tag);
   size_t ii = 0;
   recvobj.deserialize(recvbuf, ii);
@@ -74,9 +103,13 @@ template <typename SERIALIZABLE>
 void gather(const eckit::mpi::Comm & comm, const std::vector<SERIALIZABLE> & send,
             std::vector<SERIALIZABLE> & recv, const size_t root) {
   if (comm.size() > 1) {
-    std::vector<double> sendbuf;
+    SerialBuffer buffer;
+    std::vector<double> & sendbuf = buffer.get();
     std::vector<double> recvbuf;
 
+    size_t sz = 0;
+    for (const SERIALIZABLE & jsend : send) sz += jsend.serialSize();
+    sendbuf.reserve(sz);
     for (const SERIALIZABLE & jsend : send) jsend.serialize(sendbuf);
 
     gather(comm, sendbuf, recvbuf, root);
@@ -104,6 +137,7 @@ void allGather(const eckit::mpi::Comm & comm,
 /// tasks. This wrapper performs that operation for collections of non-primitive types that
 /// nevertheless support the OOPS serialization interface, i.e. provide the functions
 ///
+///     size_t serialSize() const;
 ///     void serialize(std::vector<double> &vect) const;
 ///     void deserialize(const std::vector<double> &vect, size_t &current);
 ///
@@ -118,7 +152,11 @@ void allGather(const eckit::mpi::Comm & comm,
 template <typename CIter, typename Iter>
 void allGathervUsingSerialize(const eckit::mpi::Comm &comm, CIter first, CIter last,
                               Iter recvbuf) {
-  std::vector<double> serializedLocalData;
+  SerialBuffer buffer;
+  std::vector<double> & serializedLocalData = buffer.get();
+  size_t sz = 0;
+  for (CIter it = first; it != last; ++it) sz += it->serialSize();
+  serializedLocalData.reserve(sz);
   for (CIter it = first; it != last; ++it)
     it->serialize(serializedLocalData);
 
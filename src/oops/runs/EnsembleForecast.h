@@ -0,0 +1,197 @@
+/*
+ * (C) Copyright 2023 UCAR.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#ifndef OOPS_RUNS_ENSEMBLEFORECAST_H_
+#define OOPS_RUNS_ENSEMBLEFORECAST_H_
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "atlas/parallel/omp/omp.h"
+#include "eckit/config/LocalConfiguration.h"
+
+#include "oops/base/Geometry.h"
+#include "oops/base/Model.h"
+#include "oops/base/PostProcessor.h"
+#include "oops/base/PostTimerParameters.h"
+#include "oops/base/State.h"
+#include "oops/base/StateInfo.h"
+#include "oops/base/StateWriter.h"
+#include "oops/interface/ModelAuxControl.h"
+#include "oops/mpi/mpi.h"
+#include "oops/runs/Application.h"
+#include "oops/util/Duration.h"
+#include "oops/util/Logger.h"
+#include "oops/util/parameters/NumericConstraints.h"
+#include "oops/util/parameters/Parameter.h"
+#include "oops/util/parameters/Parameters.h"
+#include "oops/util/parameters/RequiredParameter.h"
+#include "oops/util/Timer.h"
+
+namespace oops {
+
+// -----------------------------------------------------------------------------
+
+/// Options for one member of the EnsembleForecast application.
+template <typename MODEL> class EnsembleForecastMemberParameters : public Parameters {
+  OOPS_CONCRETE_PARAMETERS(EnsembleForecastMemberParameters, Parameters)
+
+ public:
+  typedef typename State<MODEL>::Parameters_      StateParameters_;
+  typedef StateWriterParameters<State<MODEL>>     StateWriterParameters_;
+
+  /// Initial state parameters.
+  RequiredParameter<StateParameters_> initialCondition{"initial condition", this};
+
+  /// Where to write the output.
+  RequiredParameter<StateWriterParameters_> output{"output", this};
+};
+
+// -----------------------------------------------------------------------------
+
+/// Options taken by the EnsembleForecast application.
+template <typename MODEL> class EnsembleForecastAppParameters : public ApplicationParameters {
+  OOPS_CONCRETE_PARAMETERS(EnsembleForecastAppParameters, ApplicationParameters)
+
+ public:
+  typedef typename Geometry<MODEL>::Parameters_      GeometryParameters_;
+  typedef ModelParametersWrapper<MODEL>              ModelParameters_;
+  typedef EnsembleForecastMemberParameters<MODEL>    MemberParameters_;
+
+  /// Geometry parameters.
+  RequiredParameter<GeometryParameters_> geometry{"geometry", this};
+
+  /// Model parameters.
+  RequiredParameter<ModelParameters_> model{"model", this};
+
+  /// Augmented model state.
+  Parameter<eckit::LocalConfiguration> modelAuxControl{
+    "model aux control", eckit::LocalConfiguration(), this};
+
+  /// Forecast length.
+  RequiredParameter<util::Duration> forecastLength{"forecast length", this};
+
+  /// Options passed to the object writing out forecast fields.
+  Parameter<PostTimerParameters> prints{"prints", {}, this};
+
+  /// Initial condition and output of each member.
+  RequiredParameter<std::vector<MemberParameters_>> members{"members", this};
+
+  /// Members are stepped concurrently by OpenMP threads. MODEL::step must be safe to call
+  /// concurrently for distinct states (the post-processors are called serially).
+  Parameter<int> nthreads{"number of threads",
+                          "number of threads stepping members concurrently "
+                          "(1: serial loop, 0: OpenMP default)",
+                          1, this, {oops::minConstraint(0)}};
+};
+
+// -----------------------------------------------------------------------------
+
+/// Application running the forecasts of several ensemble members within one executable.
+///
+/// Unlike EnsembleApplication<Forecast>, which needs the number of MPI tasks to be a multiple
+/// of the number of members, members are shared out between the MPI tasks (the numbers of
+/// members per task differ by at most one) and each task runs its members on its own. All the
+/// members of a task are stepped together, one model time step at a time, and the steps of the
+/// members are distributed over threads. Each member has its own post-processors.
+template <typename MODEL> class EnsembleForecast : public Application {
+  typedef Geometry<MODEL>                      Geometry_;
+  typedef Model<MODEL>                         Model_;
+  typedef ModelAuxControl<MODEL>               ModelAux_;
+  typedef State<MODEL>                         State_;
+  typedef EnsembleForecastAppParameters<MODEL> EnsembleForecastAppParameters_;
+
+ public:
+// -----------------------------------------------------------------------------
+  explicit EnsembleForecast(const eckit::mpi::Comm & comm = oops::mpi::world())
+    : Application(comm) {}
+// -----------------------------------------------------------------------------
+  virtual ~EnsembleForecast() {}
+// -----------------------------------------------------------------------------
+  int execute(const eckit::Configuration & fullConfig, bool validate) const override {
+    static const util::TimerId timerId(classname(), "execute");
+    util::Timer timer(timerId);
+//  Deserialize parameters
+    EnsembleForecastAppParameters_ params;
+    if (validate) params.validate(fullConfig);
+    params.deserialize(fullConfig);
+
+//  Share out the members between the MPI tasks
+    const size_t nmembers = params.members.value().size();
+    const size_t ntasks = this->getComm().size();
+    const size_t mytask = this->getComm().rank();
+    const size_t mbgn = (mytask * nmembers) / ntasks;
+    const size_t mend = ((mytask + 1) * nmembers) / ntasks;
+    const size_t nlocal = mend - mbgn;
+    Log::info() << "Running " << nmembers << " ensemble forecasts on " << ntasks
+                << " MPI tasks, members " << mbgn + 1 << " to " << mend
+                << " on this task." << std::endl;
+
+//  Each task runs its members with its own copy of the geometry and model
+    const Geometry_ resol(params.geometry, oops::mpi::myself());
+    const Model_ model(resol, params.model.value().modelParameters);
+    const ModelAux_ moderr(resol, params.modelAuxControl);
+
+//  Setup initial states and forecast outputs
+    std::vector<std::unique_ptr<State_>> xx;
+    std::vector<PostProcessor<State_>> post(nlocal);
+    for (size_t jm = 0; jm < nlocal; ++jm) {
+      const auto & member = params.members.value()[mbgn + jm];
+      xx.emplace_back(new State_(resol, member.initialCondition));
+      post[jm].enrollProcessor(new StateInfo<State_>("fc", params.prints));
+      post[jm].enrollProcessor(new StateWriter<State_>(member.output));
+    }
+
+    this->testOutput(xx, mbgn, "initial state");
+
+//  Run forecasts, all members step together
+    const int nthreads = params.nthreads.value() == 0 ? atlas_omp_get_max_threads()
+                                                      : params.nthreads.value();
+    std::vector<State_ *> states;
+    for (auto & jx : xx) states.push_back(jx.get());
+    model.forecast(states, moderr, params.forecastLength, post, nthreads);
+
+    this->testOutput(xx, mbgn, "final state");
+
+    return 0;
+  }
+// -----------------------------------------------------------------------------
+  void outputSchema(const std::string & outputPath) const override {
+    EnsembleForecastAppParameters_ params;
+    params.outputSchema(outputPath);
+  }
+// -----------------------------------------------------------------------------
+  void validateConfig(const eckit::Configuration & fullConfig) const override {
+    EnsembleForecastAppParameters_ params;
+    params.validate(fullConfig);
+  }
+// -----------------------------------------------------------------------------
+ private:
+  static const std::string classname() {return "oops::EnsembleForecast";}
+// -----------------------------------------------------------------------------
+/// Test output of the states of all members, in member order whatever the number of tasks
+  void testOutput(const std::vector<std::unique_ptr<State_>> & xx, const size_t mbgn,
+                  const std::string & title) const {
+    std::vector<std::string> lines;
+    for (size_t jm = 0; jm < xx.size(); ++jm) {
+      std::ostringstream os;
+      os << "Member " << mbgn + jm + 1 << " " << title << ": " << *xx[jm];
+      lines.push_back(os.str());
+    }
+    oops::mpi::allGatherv(this->getComm(), lines);
+    for (const std::string & line : lines) Log::test() << line << std::endl;
+  }
+  std::string appname() const override {
+    return "oops::EnsembleForecast<" + MODEL::name() + ">";
+  }
+// -----------------------------------------------------------------------------
+};
+
+}  // namespace oops
+#endif  // OOPS_RUNS_ENSEMBLEFORECAST_H_
@@ -22,6 +22,7 @@ namespace util {
 // -----------------------------------------------------------------------------
 
 std::map<std::string, std::shared_ptr<ObjectCountHelper> > ObjectCountHelper::counters_;
+std::mutex ObjectCountHelper::mutex_;
 
 // -----------------------------------------------------------------------------
 
@@ -59,6 +60,7 @@ void ObjectCountHelper::stop() {
 // -----------------------------------------------------------------------------
 
 std::shared_ptr<ObjectCountHelper> ObjectCountHelper::create(const std::string & cname) {
+  std::lock_guard<std::mutex> lock(mutex_);
   std::shared_ptr<ObjectCountHelper> pcount;
   typedef std::map<std::string, std::shared_ptr<ObjectCountHelper> >::iterator it;
   it jj = counters_.find(cname);
@@ -83,6 +85,7 @@ ObjectCountHelper::~ObjectCountHelper() {}
 // -----------------------------------------------------------------------------
 
 void ObjectCountHelper::oneMore() {
+  std::lock_guard<std::mutex> lock(mutex_);
   ++current_;
   ++created_;
   max_ = std::max(max_, current_);
@@ -91,6 +94,7 @@ void ObjectCountHelper::oneMore() {
 // -----------------------------------------------------------------------------
 
 void ObjectCountHelper::oneLess(const size_t & bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
   --current_;
   bytes_ -= bytes;
 }
@@ -98,6 +102,7 @@ void ObjectCountHelper::oneLess(const size_t & bytes) {
 // -----------------------------------------------------------------------------
 
 void ObjectCountHelper::setSize(const size_t & bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
   bytes_ += bytes;
   maxbytes_ = std::max(maxbytes_, bytes_);
   totbytes_ += bytes;
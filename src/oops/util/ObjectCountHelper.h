@@ -13,6 +13,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 
@@ -38,6 +39,7 @@ class ObjectCountHelper : public util::Printable,
 
  private:
   static std::map< std::string, std::shared_ptr<ObjectCountHelper> > counters_;
+  static std::mutex mutex_;  // objects can be created concurrently from threaded regions
 
   explicit ObjectCountHelper(const std::string &);
   void print(std::ostream &) const;
@@ -11,6 +11,8 @@
 #include "oops/util/Timer.h"
 
 #include <chrono>
+#include <string>
+#include <unordered_map>
 
 #include "oops/util/TimerHelper.h"
 
@@ -20,27 +22,51 @@ namespace util {
 
 static std::chrono::steady_clock::time_point start_time(std::chrono::steady_clock::now());
 
-static int nested_timers = 0;  // Only non-nested timers count towards measured time
+// -----------------------------------------------------------------------------
+
+TimerId::TimerId(const std::string & class_name, const std::string & method_name)
+  : id_(TimerHelper::timerId(class_name + "::" + method_name)) {}
 
 // -----------------------------------------------------------------------------
 
 Timer::Timer(const std::string & class_name, const std::string & method_name)
-    : name_(class_name + "::" + method_name), start_()
+  : tree_(nullptr), node_(TimerHelper::npos), generation_(0), start_()
 {
-  ++nested_timers;
-  start_ = ClockT::now();
+  // Names are interned once per thread; after that, looking up the id of a timer does not
+  // lock (the strings passed in are still built by the caller).
+  thread_local std::unordered_map<std::string, std::unordered_map<std::string, size_t>> ids;
+  auto & methods = ids[class_name];
+  auto it = methods.find(method_name);
+  if (it == methods.end()) {
+    it = methods.emplace(method_name, TimerHelper::timerId(class_name + "::" + method_name)).first;
+  }
+  this->start(it->second);
+}
+
+// -----------------------------------------------------------------------------
+
+Timer::Timer(const TimerId & id)
+  : tree_(nullptr), node_(TimerHelper::npos), generation_(0), start_()
+{
+  this->start(id.id());
+}
+
+// -----------------------------------------------------------------------------
+
+void Timer::start(const size_t id) {
+  node_ = TimerHelper::enter(id, generation_, tree_);
+  if (node_ != TimerHelper::npos) start_ = ClockT::now();
 }
 
 // -----------------------------------------------------------------------------
 
 Timer::~Timer() {
-  std::chrono::duration<double, std::milli> dt = ClockT::now() - start_;  // elapsed millisecs
-  --nested_timers;
-  // A top-level timer is created (when nested_timers == 0) in TimerHelper::start() for total time.
-  // To count measured time (and establish timer coverage), we sum times from the timers 1 level
-  // below this top-level timer. More-deeply nested timers would duplicate time if included.
-  const bool include_timer_in_sum = (nested_timers == 1);
-  TimerHelper::add(name_, dt.count(), include_timer_in_sum);
+  if (node_ != TimerHelper::npos) {
+    const TimeT end = ClockT::now();
+    const std::chrono::duration<double, std::milli> dt = end - start_;  // elapsed millisecs
+    const std::chrono::duration<double, std::micro> ts = start_ - start_time;
+    TimerHelper::leave(*tree_, node_, generation_, dt.count(), ts.count());
+  }
 }
 
 // -----------------------------------------------------------------------------
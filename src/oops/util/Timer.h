@@ -12,24 +12,49 @@
 #define OOPS_UTIL_TIMER_H_
 
 #include <chrono>
+#include <cstddef>
 #include <string>
 
 namespace util {
+  struct ThreadTimers;
 
 // -----------------------------------------------------------------------------
 
+/// Interned timer name. For frequently called methods, define the name once as a function-local
+/// static and time the method with Timer(const TimerId &), avoiding any string handling per call:
+///   static const util::TimerId timerId(classname(), "axpy");
+///   util::Timer timer(timerId);
+class TimerId {
+ public:
+  TimerId(const std::string & class_name, const std::string & method_name);
+  size_t id() const {return id_;}
+
+ private:
+  size_t id_;
+};
+
+// -----------------------------------------------------------------------------
+
+/// Scoped timer: times its own lifetime and adds it to the call tree of the thread that created
+/// it (see TimerHelper). Timer(class, method) looks the name up on every call, so the caller
+/// builds the name strings each time: frequently called methods should use a TimerId.
 class Timer {
  public:
   using ClockT = std::chrono::steady_clock;  // Monotonic clock type
   using TimeT = ClockT::time_point;
 
   Timer(const std::string & class_name, const std::string & method_name);
+  explicit Timer(const TimerId &);
   ~Timer();
 
   Timer(const Timer&) = delete;  // Non-copyable
 
  private:
-  std::string name_;
+  void start(const size_t);
+
+  ThreadTimers * tree_;  // call tree of the thread that created the timer
+  size_t node_;          // node in that call tree (npos when not timing)
+  unsigned int generation_;
   TimeT start_;
 };
 
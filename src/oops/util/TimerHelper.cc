@@ -10,9 +10,18 @@
 
 #include "oops/util/TimerHelper.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdlib>
+#include <fstream>
 #include <iomanip>
+#include <limits>
+#include <map>
+#include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "eckit/io/Buffer.h"
 #include "eckit/mpi/Comm.h"
@@ -26,6 +35,57 @@ namespace util {
 
 // -----------------------------------------------------------------------------
 
+struct ThreadTimers {
+  struct Node {
+    size_t id;
+    size_t parent;
+    size_t count;
+    double total;  // milliseconds
+    double min;
+    double max;
+    std::vector<std::pair<size_t, size_t>> children;  // (timer id, node) pairs
+  };
+  struct Event {
+    size_t id;
+    double start;  // microseconds
+    double duration;
+  };
+  struct Queued {  // timing of a timer destroyed on another thread
+    size_t node;
+    unsigned int generation;
+    double dt;
+    double start;
+  };
+
+  static constexpr size_t npos = TimerHelper::npos;
+
+  void reset(const unsigned int gen) {
+    generation = gen;
+    nodes.assign(1, Node{npos, npos, 0, 0.0, 0.0, 0.0, {}});
+    current = 0;
+    events.clear();
+  }
+
+  void add(const size_t node, const double dt, const double start, const bool trace) {
+    Node & timer = nodes[node];
+    timer.count += 1;
+    timer.total += dt;
+    timer.min = std::min(timer.min, dt);
+    timer.max = std::max(timer.max, dt);
+    if (trace) events.push_back(Event{timer.id, start, dt * 1e3});
+  }
+
+  size_t thread = 0;
+  unsigned int generation = 0;
+  size_t current = 0;
+  std::vector<Node> nodes{Node{npos, npos, 0, 0.0, 0.0, 0.0, {}}};
+  std::vector<Event> events;
+  std::mutex mutex;             // protects queued
+  std::vector<Queued> queued;
+};
+
+// -----------------------------------------------------------------------------
+
 TimerHelper & TimerHelper::getHelper() {
   static TimerHelper theHelper;
   return theHelper;
@@ -33,36 +93,107 @@ TimerHelper & TimerHelper::getHelper() {
 
 // -----------------------------------------------------------------------------
 
+ThreadTimers & TimerHelper::threadTimers() {
+  // The helper keeps a reference so the timings survive the end of the thread
+  thread_local std::shared_ptr<ThreadTimers> timers;
+  if (!timers) {
+    timers = std::make_shared<ThreadTimers>();
+    std::lock_guard<std::mutex> lock(getHelper().mutex_);
+    timers->thread = getHelper().threads_.size();
+    getHelper().threads_.push_back(timers);
+  }
+  return *timers;
+}
+
+// -----------------------------------------------------------------------------
+
 void TimerHelper::start() {
-  getHelper().on_ = true;
-  getHelper().total_.reset(new Timer("util::Timers", "Total"));
-  getHelper().timers_["util::Timers::measured"] = 0.0;
-  getHelper().counts_["util::Timers::measured"] = 1;
+  TimerHelper & helper = getHelper();
+  helper.generation_ += 1;
+  const char * trace = ::getenv("OOPS_TIMER_TRACE");
+  helper.trace_ = (trace != nullptr && *trace != '\0');
+  helper.traceFile_ = helper.trace_ ? trace : "";
+  helper.mainThread_ = threadTimers().thread;
+  helper.on_ = true;
+  helper.total_.reset(new Timer("util::Timers", "Total"));
 }
 
 // -----------------------------------------------------------------------------
 
 void TimerHelper::stop() {
-  getHelper().total_.reset();
-  oops::Log::stats() << getHelper() << std::endl;
-  getHelper().timers_.clear();
-  getHelper().counts_.clear();
-  getHelper().on_ = false;
+  TimerHelper & helper = getHelper();
+  helper.total_.reset();
+  helper.on_ = false;
+  oops::Log::stats() << helper << std::endl;
+  if (helper.trace_) {
+    std::ostringstream fname;
+    fname << helper.traceFile_ << "_" << oops::mpi::world().rank() << ".json";
+    helper.writeTrace(fname.str());
+  }
+  helper.generation_ += 1;
 }
 
 // -----------------------------------------------------------------------------
 
-void TimerHelper::add(const std::string & name, const double dt, const bool measuring) {
-  if (getHelper().on_) {
-    getHelper().timers_[name] += dt;
-    getHelper().counts_[name] += 1;
-    if (measuring) getHelper().timers_["util::Timers::measured"] += dt;
+size_t TimerHelper::timerId(const std::string & name) {
+  TimerHelper & helper = getHelper();
+  std::lock_guard<std::mutex> lock(helper.mutex_);
+  auto it = helper.ids_.find(name);
+  if (it == helper.ids_.end()) {
+    it = helper.ids_.emplace(name, helper.names_.size()).first;
+    helper.names_.push_back(name);
   }
+  return it->second;
 }
 
 // -----------------------------------------------------------------------------
 
-TimerHelper::TimerHelper(): on_(false), timers_(), counts_(), total_() {}
+size_t TimerHelper::enter(const size_t id, unsigned int & generation, ThreadTimers * & tree) {
+  TimerHelper & helper = getHelper();
+  if (!helper.on_.load(std::memory_order_relaxed)) return npos;
+  ThreadTimers & timers = threadTimers();
+  tree = &timers;
+  generation = helper.generation_.load(std::memory_order_relaxed);
+  if (timers.generation != generation) timers.reset(generation);
+
+  for (const auto & child : timers.nodes[timers.current].children) {
+    if (child.first == id) {
+      timers.current = child.second;
+      return child.second;
+    }
+  }
+  const size_t node = timers.nodes.size();
+  timers.nodes[timers.current].children.emplace_back(id, node);
+  timers.nodes.push_back(ThreadTimers::Node{id, timers.current, 0, 0.0,
+                                            std::numeric_limits<double>::max(), 0.0, {}});
+  timers.current = node;
+  return node;
+}
+
+// -----------------------------------------------------------------------------
+
+void TimerHelper::leave(ThreadTimers & timers, const size_t node, const unsigned int generation,
+                        const double dt, const double start) {
+  if (&timers != &threadTimers()) {
+    std::lock_guard<std::mutex> lock(timers.mutex);
+    timers.queued.push_back(ThreadTimers::Queued{node, generation, dt, start});
+    return;
+  }
+  if (timers.generation != generation || node >= timers.nodes.size()) return;
+  timers.add(node, dt, start, getHelper().trace_);
+
+  // Timers are normally destroyed in reverse order of creation. Timers held by objects
+  // (e.g. for their lifetime) can outlive the timers they were created in: the current
+  // position only moves back if this timer is still in the current calling context.
+  size_t jnode = timers.current;
+  while (jnode != npos && jnode != node) jnode = timers.nodes[jnode].parent;
+  if (jnode == node) timers.current = timers.nodes[node].parent;
+}
+
+// -----------------------------------------------------------------------------
+
+TimerHelper::TimerHelper(): on_(false), generation_(0), trace_(false), traceFile_(), names_(),
+                            ids_(), threads_(), mainThread_(0), total_(), mutex_() {}
 
 // -----------------------------------------------------------------------------
 
@@ -72,6 +203,35 @@ TimerHelper::~TimerHelper() {}
 
 void TimerHelper::print(std::ostream & os) const {
   typedef std::map<std::string, double>::const_iterator cit;
+  std::lock_guard<std::mutex> lock(mutex_);
+  mergeQueued();
+  const unsigned int generation = generation_;
+
+// Flat statistics, summed over threads and calling contexts
+  std::map<std::string, double> times;
+  std::map<std::string, int> counts;
+  double total = totalTime();
+  for (const auto & timers : threads_) {
+    if (timers->generation != generation) continue;
+    for (size_t jnode = 1; jnode < timers->nodes.size(); ++jnode) {
+      const ThreadTimers::Node & node = timers->nodes[jnode];
+      times[names_[node.id]] += node.total;
+      counts[names_[node.id]] += node.count;
+    }
+  }
+// Measured time: sum of the timers directly below the total (in the main thread)
+  const ThreadTimers & main = *threads_[mainThread_];
+  double measured = 0.0;
+  if (main.generation == generation) {
+    for (const auto & top : main.nodes[0].children) {
+      if (names_[top.first] != "util::Timers::Total") continue;
+      for (const auto & child : main.nodes[top.second].children) {
+        measured += main.nodes[child.second].total;
+      }
+    }
+  }
+  times["util::Timers::measured"] = measured;
+  counts["util::Timers::measured"] = 1;
 
 // Local timing statistics
   int table_width = 92;
@@ -86,8 +246,8 @@ void TimerHelper::print(std::ostream & os) const {
      << std::setw(12) << std::right << "total (ms)"
      << std::setw(8) << std::right << "count"
      << std::setw(18) << std::right << "time/call (ms)" << std::endl;
-  for (cit jt = timers_.begin(); jt != timers_.end(); ++jt) {
-    int icount = counts_.at(jt->first);
+  for (cit jt = times.begin(); jt != times.end(); ++jt) {
+    int icount = counts.at(jt->first);
     os << std::setw(52) << std::left << jt->first
        << ": " << std::setw(12) << std::right << std::fixed << std::setprecision(2) << jt->second
        << std::setw(8) << icount
@@ -97,6 +257,9 @@ void TimerHelper::print(std::ostream & os) const {
   os << std::string(std::floor(title_half_width), '-')
      << title << std::string(std::ceil(title_half_width), '-') << std::endl;
 
+// Call tree of each thread
+  printTrees(os, total);
+
 // For MPI applications, gather and print statistics across tasks
 
   size_t ntasks = oops::mpi::world().size();
@@ -105,15 +268,15 @@ void TimerHelper::print(std::ostream & os) const {
   if (oops::mpi::world().rank() > 0) {
     eckit::Buffer bufr(8000);
     eckit::ResizableMemoryStream sstr(bufr);
-    sstr << timers_.size();
-    for (cit jt = timers_.begin(); jt != timers_.end(); ++jt) {
+    sstr << times.size();
+    for (cit jt = times.begin(); jt != times.end(); ++jt) {
       sstr << jt->first << jt->second;
     }
     oops::mpi::world().send(static_cast<const char*>(bufr.data()), sstr.position(), 0, tag);
   } else {  // Task 0
 //  Structure for global statistics
     std::map<std::string, std::array<double, 3>> stats;
-    for (cit jt = timers_.begin(); jt != timers_.end(); ++jt) {
+    for (cit jt = times.begin(); jt != times.end(); ++jt) {
       stats[jt->first].fill(jt->second);
     }
 //  Task 0 receives stats from other tasks
@@ -160,7 +323,7 @@ void TimerHelper::print(std::ostream & os) const {
        << std::setw(12) << std::right << "% total"
        << std::setw(12) << std::right << "imbal (%)"
        << std::endl;
-    double total = stats["util::Timers::Total"][2]/ntasks;
+    total = stats["util::Timers::Total"][2]/ntasks;
     for (std::map<std::string, std::array<double, 3>>::iterator jt = stats.begin();
          jt != stats.end(); ++jt) {
 //    Only print for contributions greater than 0.1% of total
@@ -184,4 +347,124 @@ void TimerHelper::print(std::ostream & os) const {
 
 // -----------------------------------------------------------------------------
 
+void TimerHelper::printCallTrees(std::ostream & os) {
+  TimerHelper & helper = getHelper();
+  std::lock_guard<std::mutex> lock(helper.mutex_);
+  helper.mergeQueued();
+  helper.printTrees(os, helper.totalTime());
+}
+
+// -----------------------------------------------------------------------------
+
+void TimerHelper::mergeQueued() const {
+// Add the timings of timers destroyed on other threads than the one that created them
+  for (const auto & timers : threads_) {
+    std::lock_guard<std::mutex> lock(timers->mutex);
+    for (const ThreadTimers::Queued & timer : timers->queued) {
+      if (timer.generation == timers->generation && timer.node < timers->nodes.size()) {
+        timers->add(timer.node, timer.dt, timer.start, trace_);
+      }
+    }
+    timers->queued.clear();
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+double TimerHelper::totalTime() const {
+  const ThreadTimers & main = *threads_[mainThread_];
+  if (main.generation != generation_) return 0.0;
+  for (const auto & top : main.nodes[0].children) {
+    if (names_[top.first] == "util::Timers::Total") return main.nodes[top.second].total;
+  }
+  return 0.0;
+}
+
+// -----------------------------------------------------------------------------
+
+void TimerHelper::printTrees(std::ostream & os, const double total) const {
+  const unsigned int generation = generation_;
+  const int table_width = 120;
+  const std::string title = " Timing Call Tree ";
+  const float title_half_width = (table_width-title.size())/2.;
+  os << std::endl << std::string(table_width, '-') << std::endl
+     << std::string(std::floor(title_half_width), '-')
+     << title << std::string(std::ceil(title_half_width), '-') << std::endl
+     << std::string(table_width, '-') << std::endl
+     << std::setw(60) << std::left << "Name " << ": "
+     << std::setw(12) << std::right << "total (ms)"
+     << std::setw(8) << std::right << "count"
+     << std::setw(13) << std::right << "min (ms)"
+     << std::setw(13) << std::right << "max (ms)"
+     << std::setw(12) << std::right << "% total" << std::endl;
+  std::vector<size_t> order(1, mainThread_);
+  for (size_t jt = 0; jt < threads_.size(); ++jt) {
+    if (jt != mainThread_) order.push_back(jt);
+  }
+  for (const size_t jt : order) {
+    const ThreadTimers & timers = *threads_[jt];
+    if (timers.generation != generation) continue;
+    double threadTotal = 0.0;
+    for (const auto & top : timers.nodes[0].children) threadTotal += timers.nodes[top.second].total;
+    if (timers.nodes.size() == 1 || (total > 0.0 && threadTotal / total <= 0.001)) continue;
+    os << "Thread " << jt << std::endl;
+    printTree(os, timers, 0, 0, total);
+  }
+  os << std::string(std::floor(title_half_width), '-')
+     << title << std::string(std::ceil(title_half_width), '-') << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+void TimerHelper::printTree(std::ostream & os, const ThreadTimers & timers, const size_t jnode,
+                            const size_t depth, const double total) const {
+  for (const auto & child : timers.nodes[jnode].children) {
+    const ThreadTimers::Node & node = timers.nodes[child.second];
+//  Only print for contributions greater than 0.1% of total
+    if (total > 0.0 && node.total / total <= 0.001) continue;
+    const std::string name = std::string(2 * depth, ' ') + names_[node.id];
+    os << std::setw(60) << std::left << name
+       << ": " << std::setw(12) << std::right << std::fixed << std::setprecision(2) << node.total
+       << std::setw(8) << node.count
+       << std::setw(13) << std::setprecision(4) << node.min
+       << std::setw(13) << node.max
+       << std::setw(12) << std::setprecision(2) << (total > 0.0 ? node.total / total * 100.0 : 0.0)
+       << std::endl;
+    printTree(os, timers, child.second, depth + 1, total);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void TimerHelper::writeTrace(const std::string & fname) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  mergeQueued();
+  std::ofstream out(fname);
+  if (!out) {
+    oops::Log::warning() << "TimerHelper: cannot write timer trace " << fname << std::endl;
+    return;
+  }
+  const size_t rank = oops::mpi::world().rank();
+  out << "{\"traceEvents\":[";
+  bool first = true;
+  for (const auto & timers : threads_) {
+    if (timers->generation != generation_) continue;
+    for (const ThreadTimers::Event & event : timers->events) {
+      std::string name;
+      for (const char c : names_[event.id]) {
+        if (c == '"' || c == '\\') name += '\\';
+        name += c;
+      }
+      out << (first ? "\n" : ",\n")
+          << "{\"name\":\"" << name << "\",\"ph\":\"X\",\"pid\":" << rank
+          << ",\"tid\":" << timers->thread << std::fixed << std::setprecision(3)
+          << ",\"ts\":" << event.start << ",\"dur\":" << event.duration << "}";
+      first = false;
+    }
+  }
+  out << "\n]}" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
 }  // namespace util
@@ -11,38 +11,83 @@
 #ifndef OOPS_UTIL_TIMERHELPER_H_
 #define OOPS_UTIL_TIMERHELPER_H_
 
+#include <atomic>
+#include <cstddef>
 #include <iostream>
-#include <map>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
-// #include <chrono>
+#include <unordered_map>
+#include <vector>
 
 #include <boost/noncopyable.hpp>
 #include "oops/util/Printable.h"
 
 namespace util {
   class Timer;
+  struct ThreadTimers;
 
 // -----------------------------------------------------------------------------
 
+/// Collects the timings of all util::Timer objects between start() and stop().
+///
+/// Each thread accumulates its timings in its own call tree (one node per timer and calling
+/// context) without any locking; the trees are only read when the statistics are printed at
+/// stop(). The statistics printed are:
+/// - the flat table of all timers (summed over threads and calling contexts),
+/// - the call tree of each thread, with the min/max time per call,
+/// - the min/max/average and imbalance of the flat timers across MPI tasks.
+///
+/// When the environment variable OOPS_TIMER_TRACE is set to a file name prefix, every timer
+/// call is also recorded and written to <prefix>_<task>.json in the Chrome trace event format
+/// (viewable in chrome://tracing or Perfetto).
+///
+/// A timer is always added to the call tree of the thread that created it. When it is destroyed
+/// on another thread, its timing is queued and added to that tree when the statistics are
+/// printed (the owning thread may be updating its tree at the same time).
 class TimerHelper : public util::Printable,
                     private boost::noncopyable {
  public:
+  static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
   static void start();
   static void stop();
-  static void add(const std::string &, const double, const bool);
-//               const std::chrono::duration<double> &);
+
+  /// Unique id of a timer name
+  static size_t timerId(const std::string &);
+  /// Enter timer with id in this thread's call tree, leave it in the tree it was entered in
+  /// (called by util::Timer)
+  static size_t enter(const size_t, unsigned int &, ThreadTimers * &);
+  static void leave(ThreadTimers &, const size_t, const unsigned int, const double, const double);
+
+  /// Print the call tree of each thread (as in the statistics printed by stop())
+  static void printCallTrees(std::ostream &);
+
   ~TimerHelper();
 
  private:
   static TimerHelper & getHelper();
+  static ThreadTimers & threadTimers();
   TimerHelper();
   void print(std::ostream &) const;
+  void mergeQueued() const;
+  double totalTime() const;
+  void printTrees(std::ostream &, const double) const;
+  void printTree(std::ostream &, const ThreadTimers &, const size_t, const size_t,
+                 const double) const;
+  void writeTrace(const std::string &) const;
 
-  bool on_;
-  std::map< std::string, double > timers_;
-  std::map< std::string, int > counts_;
+  std::atomic<bool> on_;
+  std::atomic<unsigned int> generation_;  // incremented by start() to reset the call trees
+  bool trace_;
+  std::string traceFile_;
+  std::vector<std::string> names_;
+  std::unordered_map<std::string, size_t> ids_;
+  std::vector<std::shared_ptr<ThreadTimers>> threads_;
+  size_t mainThread_;
   std::unique_ptr<Timer> total_;
+  mutable std::mutex mutex_;  // names and threads can be added concurrently from threaded regions
 };
 
 // -----------------------------------------------------------------------------
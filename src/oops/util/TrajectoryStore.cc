@@ -0,0 +1,241 @@
+/*
+ * (C) Copyright 2023 UCAR
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#include "oops/util/TrajectoryStore.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "eckit/exception/Exceptions.h"
+
+namespace util {
+
+namespace {
+
+// Number of significant bytes in a 64 bits word
+inline unsigned int significantBytes(uint64_t xx) {
+  unsigned int nb = 0;
+  while (xx != 0) {
+    xx >>= 8;
+    ++nb;
+  }
+  return nb;
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+
+TrajectoryStore::TrajectoryStore(const std::string & packing, const size_t blockSize)
+  : packing_(packing), kind_(Packing::Double), blockSize_(blockSize), store_()
+{
+  if (packing_ == "double") {
+    kind_ = Packing::Double;
+  } else if (packing_ == "float") {
+    kind_ = Packing::Float;
+  } else if (packing_ == "int16") {
+    kind_ = Packing::Int16;
+  } else if (packing_ == "lossless") {
+    kind_ = Packing::Lossless;
+  } else {
+    throw eckit::BadValue("TrajectoryStore: unknown packing " + packing_, Here());
+  }
+  ASSERT(blockSize_ > 0);
+}
+
+// -----------------------------------------------------------------------------
+
+void TrajectoryStore::put(const DateTime & tt, const std::vector<double> & vals) {
+  Packed & pck = store_[tt];
+  const size_t nn = vals.size();
+  pck.nvals = nn;
+  pck.bytes.clear();
+
+  switch (kind_) {
+    case Packing::Double: {
+      pck.bytes.resize(nn * sizeof(double));
+      if (nn > 0) std::memcpy(pck.bytes.data(), vals.data(), nn * sizeof(double));
+      break;
+    }
+    case Packing::Float: {
+      pck.bytes.resize(nn * sizeof(float));
+      for (size_t jj = 0; jj < nn; ++jj) {
+        const float zz = static_cast<float>(vals[jj]);
+        std::memcpy(&pck.bytes[jj * sizeof(float)], &zz, sizeof(float));
+      }
+      break;
+    }
+    case Packing::Int16: {
+      // Each block: minimum and step (doubles) followed by one uint16_t per value. Blocks with
+      // non-finite values (or range) are kept as is, with a NaN step as a marker.
+      const size_t nblocks = (nn + blockSize_ - 1) / blockSize_;
+      pck.bytes.reserve(nblocks * 2 * sizeof(double) + nn * sizeof(uint16_t));
+      for (size_t jb = 0; jb < nblocks; ++jb) {
+        const size_t ibgn = jb * blockSize_;
+        const size_t iend = std::min(ibgn + blockSize_, nn);
+        const bool finite = std::all_of(vals.begin() + ibgn, vals.begin() + iend,
+                                        [](const double zz) {return std::isfinite(zz);});
+        double vmin = 0.0;
+        double step = std::numeric_limits<double>::quiet_NaN();
+        if (finite) {
+          const auto mm = std::minmax_element(vals.begin() + ibgn, vals.begin() + iend);
+          vmin = *mm.first;
+          step = (*mm.second - vmin) / 65535.0;
+          if (!std::isfinite(step)) step = std::numeric_limits<double>::quiet_NaN();
+        }
+        const bool raw = std::isnan(step);
+        const size_t ipos = pck.bytes.size();
+        pck.bytes.resize(ipos + 2 * sizeof(double)
+                         + (iend - ibgn) * (raw ? sizeof(double) : sizeof(uint16_t)));
+        unsigned char * ptr = pck.bytes.data() + ipos;
+        std::memcpy(ptr, &vmin, sizeof(double));
+        ptr += sizeof(double);
+        std::memcpy(ptr, &step, sizeof(double));
+        ptr += sizeof(double);
+        if (raw) {
+          std::memcpy(ptr, &vals[ibgn], (iend - ibgn) * sizeof(double));
+          continue;
+        }
+        for (size_t jj = ibgn; jj < iend; ++jj) {
+          const uint16_t code = step > 0.0
+                                ? static_cast<uint16_t>(std::lround((vals[jj] - vmin) / step)) : 0;
+          std::memcpy(ptr, &code, sizeof(uint16_t));
+          ptr += sizeof(uint16_t);
+        }
+      }
+      pck.bytes.shrink_to_fit();
+      break;
+    }
+    case Packing::Lossless: {
+      // Pairs of values: one byte holding the two byte counts, then the significant bytes
+      // (least significant first) of each value XOR-ed with the previous one
+      pck.bytes.reserve(nn * sizeof(double) / 2);
+      uint64_t prev = 0;
+      for (size_t jj = 0; jj < nn; jj += 2) {
+        uint64_t xor2[2] = {0, 0};
+        unsigned int nb2[2] = {0, 0};
+        for (size_t jp = 0; jp < 2 && jj + jp < nn; ++jp) {
+          uint64_t bits;
+          std::memcpy(&bits, &vals[jj + jp], sizeof(double));
+          xor2[jp] = bits ^ prev;
+          nb2[jp] = significantBytes(xor2[jp]);
+          prev = bits;
+        }
+        pck.bytes.push_back(static_cast<unsigned char>(nb2[0] | (nb2[1] << 4)));
+        for (size_t jp = 0; jp < 2; ++jp) {
+          for (unsigned int jb = 0; jb < nb2[jp]; ++jb) {
+            pck.bytes.push_back(static_cast<unsigned char>((xor2[jp] >> (8 * jb)) & 0xff));
+          }
+        }
+      }
+      pck.bytes.shrink_to_fit();
+      break;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void TrajectoryStore::get(const DateTime & tt, std::vector<double> & vals) const {
+  auto it = store_.find(tt);
+  if (it == store_.end()) {
+    throw eckit::BadValue("TrajectoryStore: no trajectory at " + tt.toString(), Here());
+  }
+  const Packed & pck = it->second;
+  const size_t nn = pck.nvals;
+  vals.resize(nn);
+
+  switch (kind_) {
+    case Packing::Double: {
+      if (nn > 0) std::memcpy(vals.data(), pck.bytes.data(), nn * sizeof(double));
+      break;
+    }
+    case Packing::Float: {
+      for (size_t jj = 0; jj < nn; ++jj) {
+        float zz;
+        std::memcpy(&zz, &pck.bytes[jj * sizeof(float)], sizeof(float));
+        vals[jj] = static_cast<double>(zz);
+      }
+      break;
+    }
+    case Packing::Int16: {
+      const unsigned char * ptr = pck.bytes.data();
+      for (size_t ibgn = 0; ibgn < nn; ibgn += blockSize_) {
+        const size_t iend = std::min(ibgn + blockSize_, nn);
+        double vmin, step;
+        std::memcpy(&vmin, ptr, sizeof(double));
+        ptr += sizeof(double);
+        std::memcpy(&step, ptr, sizeof(double));
+        ptr += sizeof(double);
+        if (std::isnan(step)) {
+          std::memcpy(&vals[ibgn], ptr, (iend - ibgn) * sizeof(double));
+          ptr += (iend - ibgn) * sizeof(double);
+          continue;
+        }
+        for (size_t jj = ibgn; jj < iend; ++jj) {
+          uint16_t code;
+          std::memcpy(&code, ptr, sizeof(uint16_t));
+          ptr += sizeof(uint16_t);
+          vals[jj] = vmin + step * static_cast<double>(code);
+        }
+      }
+      break;
+    }
+    case Packing::Lossless: {
+      const unsigned char * ptr = pck.bytes.data();
+      uint64_t prev = 0;
+      for (size_t jj = 0; jj < nn; jj += 2) {
+        const unsigned int nb2[2] = {static_cast<unsigned int>(*ptr & 0x0f),
+                                     static_cast<unsigned int>(*ptr >> 4)};
+        ++ptr;
+        for (size_t jp = 0; jp < 2 && jj + jp < nn; ++jp) {
+          uint64_t xx = 0;
+          for (unsigned int jb = 0; jb < nb2[jp]; ++jb) {
+            xx |= static_cast<uint64_t>(*ptr++) << (8 * jb);
+          }
+          prev ^= xx;
+          std::memcpy(&vals[jj + jp], &prev, sizeof(double));
+        }
+      }
+      break;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+size_t TrajectoryStore::storedBytes() const {
+  size_t nbytes = 0;
+  for (const auto & step : store_) nbytes += step.second.bytes.size();
+  return nbytes;
+}
+
+// -----------------------------------------------------------------------------
+
+size_t TrajectoryStore::unpackedBytes() const {
+  size_t nbytes = 0;
+  for (const auto & step : store_) nbytes += step.second.nvals * sizeof(double);
+  return nbytes;
+}
+
+// -----------------------------------------------------------------------------
+
+void TrajectoryStore::print(std::ostream & os) const {
+  const size_t full = unpackedBytes();
+  const size_t used = storedBytes();
+  os << "Trajectory store: " << store_.size() << " steps packed as " << packing_ << ", "
+     << used << " bytes (" << full << " bytes unpacked";
+  if (full > 0) os << ", " << 100.0 * (1.0 - static_cast<double>(used) / full) << "% saved";
+  os << ")";
+}
+
+// -----------------------------------------------------------------------------
+
+}  // namespace util
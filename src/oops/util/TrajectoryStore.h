@@ -0,0 +1,72 @@
+/*
+ * (C) Copyright 2023 UCAR
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#ifndef OOPS_UTIL_TRAJECTORYSTORE_H_
+#define OOPS_UTIL_TRAJECTORYSTORE_H_
+
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+#include "oops/util/DateTime.h"
+#include "oops/util/Printable.h"
+
+namespace util {
+
+// -----------------------------------------------------------------------------
+
+/// Packed storage of the trajectory of a linear model.
+///
+/// Each trajectory step is given as a vector of doubles (typically the serialized fields) and
+/// kept in one of the following packings:
+///  - "double": as is;
+///  - "float": rounded to single precision (half the memory);
+///  - "int16": lossy, quantized on 16 bits relative to the range of each block of values
+///    (blocks with non-finite values are kept as is);
+///  - "lossless": each value XOR-ed with the previous one and only the significant bytes kept.
+/// Steps are unpacked on demand when the TL or AD needs them.
+class TrajectoryStore : public util::Printable,
+                        private boost::noncopyable {
+ public:
+  static const std::string classname() {return "util::TrajectoryStore";}
+
+  explicit TrajectoryStore(const std::string & packing = "double", const size_t blockSize = 1024);
+
+  void put(const DateTime &, const std::vector<double> &);
+  void get(const DateTime &, std::vector<double> &) const;
+  bool has(const DateTime & tt) const {return store_.find(tt) != store_.end();}
+  void clear() {store_.clear();}
+
+  const std::string & packing() const {return packing_;}
+  size_t size() const {return store_.size();}
+  size_t storedBytes() const;     // memory used by the packed trajectory
+  size_t unpackedBytes() const;   // memory the trajectory would use in double precision
+
+ private:
+  enum class Packing {Double, Float, Int16, Lossless};
+  struct Packed {
+    size_t nvals;
+    std::vector<unsigned char> bytes;
+  };
+
+  void print(std::ostream &) const override;
+
+  const std::string packing_;
+  Packing kind_;
+  const size_t blockSize_;
+  std::map<DateTime, Packed> store_;
+};
+
+// -----------------------------------------------------------------------------
+
+}  // namespace util
+
+#endif  // OOPS_UTIL_TRAJECTORYSTORE_H_
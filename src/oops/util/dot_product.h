@@ -11,6 +11,8 @@
 #ifndef OOPS_UTIL_DOT_PRODUCT_H_
 #define OOPS_UTIL_DOT_PRODUCT_H_
 
+#include <vector>
+
 /// Syntactic sugar to let us use a more mathematical notation for dot products.
 
 template<class T>
@@ -19,4 +21,13 @@ double dot_product(const T& x, const T& y) {
   return x.dot_product_with(y);
 }
 
+/// Dot products of pairs of vectors, computed together so that T can batch the global reductions.
+
+template<class T>
+inline
+std::vector<double> dot_products(const std::vector<const T *> & x,
+                                 const std::vector<const T *> & y) {
+  return T::dot_products(x, y);
+}
+
 #endif  // OOPS_UTIL_DOT_PRODUCT_H_
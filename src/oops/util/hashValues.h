@@ -0,0 +1,47 @@
+/*
+ * (C) Copyright 2023 UCAR
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#ifndef OOPS_UTIL_HASHVALUES_H_
+#define OOPS_UTIL_HASHVALUES_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace util {
+
+/// FNV-1a hash of the bytes of \p size values at \p data, continuing from hash \p seed.
+/// Identical values give identical hashes on all tasks and in all runs (on a given platform),
+/// so the hash can be used as a key for data saved to disk.
+template <typename T>
+uint64_t hashValues(const T * data, const size_t size,
+                    const uint64_t seed = 14695981039346656037ULL) {
+  uint64_t hash = seed;
+  const unsigned char * bytes = reinterpret_cast<const unsigned char *>(data);
+  for (size_t jj = 0; jj < size * sizeof(T); ++jj) {
+    hash ^= bytes[jj];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+template <typename T>
+uint64_t hashValues(const std::vector<T> & values,
+                    const uint64_t seed = 14695981039346656037ULL) {
+  return hashValues(values.data(), values.size(), seed);
+}
+
+inline uint64_t hashValues(const std::string & str,
+                           const uint64_t seed = 14695981039346656037ULL) {
+  return hashValues(str.data(), str.size(), seed);
+}
+
+}  // namespace util
+
+#endif  // OOPS_UTIL_HASHVALUES_H_
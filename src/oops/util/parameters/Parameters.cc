@@ -117,7 +117,8 @@ void Parameters::registerChild(ParameterBase &parameter) {
 }
 
 void Parameters::deserialize(const eckit::Configuration &config) {
-  util::Timer timer("oops::Parameters", "deserialize");
+  static const util::TimerId timerId("oops::Parameters", "deserialize");
+  util::Timer timer(timerId);
   util::CompositePath path;
   deserialize(path, config);
 }
@@ -128,7 +129,8 @@ void Parameters::deserialize(util::CompositePath &path, const eckit::Configurati
 }
 
 void Parameters::serialize(eckit::LocalConfiguration &config) const {
-  util::Timer timer("oops::Parameters", "serialize");
+  static const util::TimerId timerId("oops::Parameters", "serialize");
+  util::Timer timer(timerId);
   for (const ParameterBase* child : children_) {
     child->serialize(config);
   }
@@ -142,7 +144,8 @@ eckit::LocalConfiguration Parameters::toConfiguration() const {
 
 void Parameters::validate(const eckit::Configuration &config) {
 #ifdef OOPS_HAVE_NLOHMANN_JSON_SCHEMA_VALIDATOR
-  util::Timer timer("oops::Parameters", "validate");
+  static const util::TimerId timerId("oops::Parameters", "validate");
+  util::Timer timer(timerId);
   std::string strSchema = jsonSchema().toString(true /*includeSchemaKeyword?*/);
   nlohmann::json jsonSchema = nlohmann::json::parse(strSchema);
 
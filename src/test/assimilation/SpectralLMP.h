@@ -19,6 +19,7 @@
 
 #include "oops/../test/TestEnvironment.h"
 #include "oops/assimilation/SpectralLMP.h"
+#include "oops/assimilation/VectorStore.h"
 #include "oops/runs/Test.h"
 #include "oops/util/Expect.h"
 #include "oops/util/FloatCompare.h"
@@ -27,27 +28,29 @@
 
 namespace test {
 
-  void test_SpectralLMP(const eckit::LocalConfiguration &conf)
+  /// Updates and applies the LMP, returns the results of the multiplications
+  std::vector<Vector3D> applySpectralLMP(const eckit::LocalConfiguration &conf)
   {
     oops::SpectralLMP<Vector3D, Vector3D> spectralLMP(conf);
+    std::vector<Vector3D> results;
 
     // assign vectors following DRPLanczosMinimizer.h
-    std::vector<std::unique_ptr<Vector3D>> hvecs;
-    std::vector<std::unique_ptr<Vector3D>> vvecs;
-    std::vector<std::unique_ptr<Vector3D>> zvecs;
+    oops::VectorStore<Vector3D> hvecs(conf);
+    oops::VectorStore<Vector3D> vvecs(conf);
+    oops::VectorStore<Vector3D> zvecs(conf);
     std::vector<double> alphas;
     std::vector<double> betas;
 
     // Simple case
-    hvecs.emplace_back(std::unique_ptr<Vector3D>(new Vector3D(1, 1, 1)));
-    hvecs.emplace_back(std::unique_ptr<Vector3D>(new Vector3D(1, 1, 1)));
-    hvecs.emplace_back(std::unique_ptr<Vector3D>(new Vector3D(1, 1, 1)));
-    vvecs.emplace_back(std::unique_ptr<Vector3D>(new Vector3D(1, 1, 1)));
-    vvecs.emplace_back(std::unique_ptr<Vector3D>(new Vector3D(1, 1, 1)));
-    vvecs.emplace_back(std::unique_ptr<Vector3D>(new Vector3D(1, 1, 1)));
-    zvecs.emplace_back(std::unique_ptr<Vector3D>(new Vector3D(1, 1, 1)));
-    zvecs.emplace_back(std::unique_ptr<Vector3D>(new Vector3D(1, 1, 1)));
-    zvecs.emplace_back(std::unique_ptr<Vector3D>(new Vector3D(1, 1, 1)));
+    hvecs.push_back(Vector3D(1, 1, 1));
+    hvecs.push_back(Vector3D(1, 1, 1));
+    hvecs.push_back(Vector3D(1, 1, 1));
+    vvecs.push_back(Vector3D(1, 1, 1));
+    vvecs.push_back(Vector3D(1, 1, 1));
+    vvecs.push_back(Vector3D(1, 1, 1));
+    zvecs.push_back(Vector3D(1, 1, 1));
+    zvecs.push_back(Vector3D(1, 1, 1));
+    zvecs.push_back(Vector3D(1, 1, 1));
 
     alphas.push_back(1.0);
     alphas.push_back(1.0);
@@ -61,6 +64,7 @@ namespace test {
 
     spectralLMP.updateObsBias(std::unique_ptr<Vector3D>(new Vector3D(1, 1, 1)));
     spectralLMP.multiply(pr, zz);
+    results.push_back(zz);
 
     // More complicated case
     hvecs.clear();
@@ -68,15 +72,15 @@ namespace test {
     zvecs.clear();
     alphas.clear();
     betas.clear();
-    hvecs.emplace_back(std::unique_ptr<Vector3D>(new Vector3D(10, 1, -10)));
-    hvecs.emplace_back(std::unique_ptr<Vector3D>(new Vector3D(1, 10, 100)));
-    hvecs.emplace_back(std::unique_ptr<Vector3D>(new Vector3D(-5, 5, 20)));
-    vvecs.emplace_back(std::unique_ptr<Vector3D>(new Vector3D(1, 3, 11)));
-    vvecs.emplace_back(std::unique_ptr<Vector3D>(new Vector3D(-1, 2, 100)));
-    vvecs.emplace_back(std::unique_ptr<Vector3D>(new Vector3D(6, 77, 7)));
-    zvecs.emplace_back(std::unique_ptr<Vector3D>(new Vector3D(1, 10, 1)));
-    zvecs.emplace_back(std::unique_ptr<Vector3D>(new Vector3D(1, 21, 21)));
-    zvecs.emplace_back(std::unique_ptr<Vector3D>(new Vector3D(100, 3, 70)));
+    hvecs.push_back(Vector3D(10, 1, -10));
+    hvecs.push_back(Vector3D(1, 10, 100));
+    hvecs.push_back(Vector3D(-5, 5, 20));
+    vvecs.push_back(Vector3D(1, 3, 11));
+    vvecs.push_back(Vector3D(-1, 2, 100));
+    vvecs.push_back(Vector3D(6, 77, 7));
+    zvecs.push_back(Vector3D(1, 10, 1));
+    zvecs.push_back(Vector3D(1, 21, 21));
+    zvecs.push_back(Vector3D(100, 3, 70));
 
     alphas.push_back(1000.0);
     alphas.push_back(33.0);
@@ -89,6 +93,24 @@ namespace test {
     Vector3D zz2(50, 1, 1);
 
     spectralLMP.multiply(pr2, zz2);
+    results.push_back(zz2);
+    return results;
+  }
+
+  void test_SpectralLMP(const eckit::LocalConfiguration &conf)
+  {
+    const std::vector<Vector3D> results = applySpectralLMP(conf);
+
+    // Same results when all but one of the stored vectors are paged
+    eckit::LocalConfiguration pagedConf(conf);
+    pagedConf.set("vector store.in memory", 1);
+    const std::vector<Vector3D> paged = applySpectralLMP(pagedConf);
+    EXPECT(paged.size() == results.size());
+    for (size_t jj = 0; jj < results.size(); ++jj) {
+      EXPECT(oops::is_close(paged[jj].x(), results[jj].x(), 1.0e-12));
+      EXPECT(oops::is_close(paged[jj].y(), results[jj].y(), 1.0e-12));
+      EXPECT(oops::is_close(paged[jj].z(), results[jj].z(), 1.0e-12));
+    }
   }
 
   void test_SpectralLMP_Cmat(const eckit::LocalConfiguration &conf)
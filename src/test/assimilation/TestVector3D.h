@@ -60,6 +60,24 @@ namespace test {
 
     const double dotprod = v1.dot_product_with(v2);
     EXPECT(dotprod == 32.0);
+
+    const Vector3D v3(-1.0, 0.5, 2.0);
+    const std::vector<double> dotprods = v1.dot_products_with({&v2, &v3, &v1});
+    EXPECT(dotprods.size() == 3);
+    EXPECT(dotprods[0] == 32.0 && dotprods[1] == 6.0 && dotprods[2] == 14.0);
+
+    Vector3D vMultiAxpy = v1;
+    vMultiAxpy.multi_axpy({3.0, -2.0}, {&v2, &v3});
+    EXPECT(vMultiAxpy.x() == 15.0 && vMultiAxpy.y() == 16.0 && vMultiAxpy.z() == 17.0);
+
+    std::vector<double> vals;
+    v1.serialize(vals);
+    v2.serialize(vals);
+    Vector3D vSerial(0.0, 0.0, 0.0);
+    size_t index = 3;
+    vSerial.deserialize(vals, index);
+    EXPECT(index == 6);
+    EXPECT(vSerial.x() == 4.0 && vSerial.y() == 5.0 && vSerial.z() == 6.0);
   }
 
   CASE("assimilation/TestVector3D/Vector3D") {
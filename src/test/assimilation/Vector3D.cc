@@ -7,6 +7,8 @@
 
 #include "test/assimilation/Vector3D.h"
 
+#include "eckit/exception/Exceptions.h"
+
 namespace test {
 
   Vector3D::Vector3D(const double& x,
@@ -83,6 +85,20 @@ namespace test {
     return this->x_ * rhs.x_ + this->y_ * rhs.y_ + this->z_ * rhs.z_;
   }
 
+  std::vector<double> Vector3D::dot_products_with(const std::vector<const Vector3D *>& rhs) const
+  {
+    std::vector<double> dots(rhs.size());
+    for (size_t jj = 0; jj < rhs.size(); ++jj) dots[jj] = this->dot_product_with(*rhs[jj]);
+    return dots;
+  }
+
+  void Vector3D::multi_axpy(const std::vector<double>& mult,
+                            const std::vector<const Vector3D *>& rhs)
+  {
+    ASSERT(mult.size() == rhs.size());
+    for (size_t jj = 0; jj < rhs.size(); ++jj) this->axpy(mult[jj], *rhs[jj]);
+  }
+
   void Vector3D::multiply(const Vector3D& rhs, Vector3D& lhs)
   {
     lhs.x_ = x_ * rhs.x_;
@@ -90,6 +106,21 @@ namespace test {
     lhs.z_ = z_ * rhs.z_;
   }
 
+  void Vector3D::serialize(std::vector<double>& vals) const
+  {
+    vals.push_back(x_);
+    vals.push_back(y_);
+    vals.push_back(z_);
+  }
+
+  void Vector3D::deserialize(const std::vector<double>& vals, size_t& index)
+  {
+    ASSERT(vals.size() >= index + 3);
+    x_ = vals[index++];
+    y_ = vals[index++];
+    z_ = vals[index++];
+  }
+
   void Vector3D::print(std::ostream & os) const {
     os << x_ << ", " << y_ << ", " << z_ << std::endl;
   }
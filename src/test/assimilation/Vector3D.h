@@ -8,6 +8,8 @@
 #ifndef TEST_ASSIMILATION_VECTOR3D_H_
 #define TEST_ASSIMILATION_VECTOR3D_H_
 
+#include <vector>
+
 #include "oops/util/Printable.h"
 
 namespace test {
@@ -27,7 +29,14 @@ namespace test {
     /// x -> x + mult * rhs
     void axpy(const double, const Vector3D&);
     double dot_product_with(const Vector3D&) const;
+    /// dot products with each of the others
+    std::vector<double> dot_products_with(const std::vector<const Vector3D *>&) const;
+    /// x -> x + sum_i mult[i] * rhs[i]
+    void multi_axpy(const std::vector<double>&, const std::vector<const Vector3D *>&);
     void multiply(const Vector3D&, Vector3D&);
+    /// serialization (as used by oops::VectorStore)
+    void serialize(std::vector<double>&) const;
+    void deserialize(const std::vector<double>&, size_t&);
     double x() const {return x_;}
     double y() const {return y_;}
     double z() const {return z_;}
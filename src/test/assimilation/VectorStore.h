@@ -0,0 +1,118 @@
+/*
+ * (C) Copyright 2023 UCAR
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#ifndef TEST_ASSIMILATION_VECTORSTORE_H_
+#define TEST_ASSIMILATION_VECTORSTORE_H_
+
+#include <cmath>
+#include <string>
+
+#include "eckit/config/LocalConfiguration.h"
+#include "eckit/testing/Test.h"
+#include "oops/assimilation/VectorStore.h"
+#include "oops/runs/Test.h"
+
+#include "test/assimilation/Vector3D.h"
+
+namespace test {
+
+// -----------------------------------------------------------------------------
+/// Vectors with components that are not representable in single precision
+Vector3D storedVector(const size_t jj) {
+  const double kk = static_cast<double>(jj + 1);
+  return Vector3D(kk / 3.0, -kk / 7.0, 1.0e5 + kk / 11.0);
+}
+
+// -----------------------------------------------------------------------------
+/// Fills a store with nn vectors and checks they are all read back with a relative tolerance
+void checkVectorStore(const eckit::Configuration & conf, const bool paged, const double tol) {
+  const size_t nn = 5;
+  oops::VectorStore<Vector3D> store(conf);
+  for (size_t jj = 0; jj < nn; ++jj) store.push_back(storedVector(jj));
+  EXPECT_EQUAL(store.size(), nn);
+  EXPECT_EQUAL(store.paged(), paged);
+
+  // Forward, backward and out of order accesses
+  bool exact = true;
+  for (const size_t jj : {0, 1, 2, 3, 4, 4, 3, 2, 1, 0, 3, 0, 4}) {
+    const Vector3D & vec = store[jj];
+    const Vector3D ref = storedVector(jj);
+    EXPECT(std::abs(vec.x() - ref.x()) <= tol * std::abs(ref.x()));
+    EXPECT(std::abs(vec.y() - ref.y()) <= tol * std::abs(ref.y()));
+    EXPECT(std::abs(vec.z() - ref.z()) <= tol * std::abs(ref.z()));
+    exact = exact && vec.x() == ref.x() && vec.y() == ref.y() && vec.z() == ref.z();
+  }
+  EXPECT_EQUAL(exact, tol == 0.0);
+
+  // A reference remains valid while one other paged vector is accessed
+  const Vector3D & first = store[0];
+  const Vector3D & second = store[1];
+  EXPECT_EQUAL(first.x(), store[0].x());
+  EXPECT(second.x() != first.x());
+
+  // Indices are shifted by erase_front
+  store.erase_front();
+  store.erase_front();
+  EXPECT_EQUAL(store.size(), nn - 2);
+  for (size_t jj = 0; jj < nn - 2; ++jj) {
+    EXPECT(std::abs(store[jj].x() - storedVector(jj + 2).x()) <= tol * storedVector(jj + 2).x());
+  }
+  store.push_back(storedVector(nn));
+  EXPECT_EQUAL(store[nn - 2].x(), storedVector(nn).x());
+  store.clear();
+  EXPECT(store.empty());
+  EXPECT(!store.paged());
+}
+
+// -----------------------------------------------------------------------------
+
+CASE("assimilation/VectorStore/inMemory") {
+  eckit::LocalConfiguration conf;
+  checkVectorStore(conf, false, 0.0);
+}
+
+// -----------------------------------------------------------------------------
+
+CASE("assimilation/VectorStore/pagedInMemory") {
+  eckit::LocalConfiguration conf;
+  conf.set("vector store.in memory", 2);
+  checkVectorStore(conf, true, 0.0);
+}
+
+// -----------------------------------------------------------------------------
+
+CASE("assimilation/VectorStore/pagedInMemorySinglePrecision") {
+  eckit::LocalConfiguration conf;
+  conf.set("vector store.in memory", 1);
+  conf.set("vector store.single precision", true);
+  checkVectorStore(conf, true, 1.0e-7);
+}
+
+// -----------------------------------------------------------------------------
+
+CASE("assimilation/VectorStore/pagedToFiles") {
+  eckit::LocalConfiguration conf;
+  conf.set("vector store.in memory", 1);
+  conf.set("vector store.directory", ".");
+  checkVectorStore(conf, true, 0.0);
+}
+
+// -----------------------------------------------------------------------------
+
+class VectorStore : public oops::Test {
+ private:
+  std::string testid() const override {return "test::VectorStore";}
+
+  void register_tests() const override {}
+  void clear() const override {}
+};
+
+// -----------------------------------------------------------------------------
+
+}  // namespace test
+
+#endif  // TEST_ASSIMILATION_VECTORSTORE_H_
@@ -33,6 +33,7 @@
 #include "oops/runs/Test.h"
 #include "oops/util/DateTime.h"
 #include "oops/util/dot_product.h"
+#include "oops/util/FloatCompare.h"
 #include "oops/util/Logger.h"
 #include "test/TestEnvironment.h"
 
@@ -270,6 +271,66 @@ template <typename MODEL> void testIncrementAxpy() {
 
 // -----------------------------------------------------------------------------
 
+template <typename MODEL> void testIncrementMultiVector() {
+  typedef IncrementFixture<MODEL>   Test_;
+  typedef oops::Increment<MODEL>    Increment_;
+
+  Increment_ dx(Test_::resol(), Test_::ctlvars(), Test_::time());
+  dx.random();
+  std::vector<Increment_> vecs;
+  std::vector<const Increment_ *> ptrs;
+  std::vector<double> ww;
+  const size_t nvecs = 3;
+  vecs.reserve(nvecs);
+  for (size_t jv = 0; jv < nvecs; ++jv) {
+    vecs.emplace_back(dx, false);
+    vecs.back().random();
+    ww.push_back(1.0 / (jv + 2.0));
+  }
+  for (size_t jv = 0; jv < nvecs; ++jv) ptrs.push_back(&vecs[jv]);
+
+// test block dot products against one at a time
+  const std::vector<double> dots = dx.dot_products_with(ptrs);
+  EXPECT(dots.size() == nvecs);
+  for (size_t jv = 0; jv < nvecs; ++jv) {
+    EXPECT(oops::is_close(dots[jv], dot_product(dx, vecs[jv]), Test_::tolerance()));
+  }
+
+// test pairwise dot products against one at a time
+  std::vector<const Increment_ *> lhs(nvecs, &dx);
+  lhs[0] = &vecs[1];
+  const std::vector<double> pdots = Increment_::dot_products(lhs, ptrs);
+  EXPECT(pdots.size() == nvecs);
+  for (size_t jv = 0; jv < nvecs; ++jv) {
+    EXPECT(oops::is_close(pdots[jv], dot_product(*lhs[jv], vecs[jv]), Test_::tolerance()));
+  }
+
+// test multi_axpy against axpy
+  Increment_ dx1(dx);
+  dx1.multi_axpy(ww, ptrs);
+  Increment_ dx2(dx);
+  for (size_t jv = 0; jv < nvecs; ++jv) dx2.axpy(ww[jv], vecs[jv]);
+  dx2 -= dx1;
+  EXPECT(dx2.norm() < Test_::tolerance() * dx1.norm());
+
+// test schur_accumul against schur_product_with and axpy
+  std::vector<Increment_> work(vecs);
+  std::vector<Increment_ *> wptrs;
+  for (size_t jv = 0; jv < nvecs; ++jv) wptrs.push_back(&work[jv]);
+  Increment_ dx3(dx);
+  dx3.schur_accumul(wptrs, ptrs);
+  Increment_ dx4(dx);
+  for (size_t jv = 0; jv < nvecs; ++jv) {
+    Increment_ tmp(vecs[jv]);
+    tmp.schur_product_with(vecs[jv]);
+    dx4 += tmp;
+  }
+  dx4 -= dx3;
+  EXPECT(dx4.norm() < Test_::tolerance() * dx3.norm());
+}
+
+// -----------------------------------------------------------------------------
+
 template <typename MODEL> void testIncrementAccum() {
   typedef IncrementFixture<MODEL>   Test_;
   typedef oops::Increment<MODEL>    Increment_;
@@ -500,6 +561,8 @@ class Increment : public oops::Test {
       { testIncrementDotProduct<MODEL>(); });
     ts.emplace_back(CASE("interface/Increment/testIncrementAxpy")
       { testIncrementAxpy<MODEL>(); });
+    ts.emplace_back(CASE("interface/Increment/testIncrementMultiVector")
+      { testIncrementMultiVector<MODEL>(); });
     ts.emplace_back(CASE("interface/Increment/testIncrementAccum")
       { testIncrementAccum<MODEL>(); });
     ts.emplace_back(CASE("interface/Increment/testIncrementDiff")
@@ -8,6 +8,7 @@
 #ifndef TEST_INTERFACE_OBSLOCALIZATION_H_
 #define TEST_INTERFACE_OBSLOCALIZATION_H_
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <string>
@@ -20,11 +21,13 @@
 #include "eckit/config/LocalConfiguration.h"
 #include "eckit/testing/Test.h"
 #include "oops/base/Geometry.h"
+#include "oops/base/LocalObs.h"
 #include "oops/base/ObsLocalizationBase.h"
 #include "oops/base/ObsVector.h"
 #include "oops/interface/GeometryIterator.h"
 #include "oops/mpi/mpi.h"
 #include "oops/runs/Test.h"
+#include "oops/util/FloatCompare.h"
 #include "oops/util/parameters/Parameter.h"
 #include "oops/util/parameters/Parameters.h"
 #include "oops/util/parameters/RequiredParameter.h"
@@ -178,6 +181,56 @@ template <typename MODEL, typename OBS> void testObsLocalization() {
 
 // -----------------------------------------------------------------------------
 
+/// \brief Tests ObsLocalization::computeLocalObs method.
+/// \details For localizations that support the sparse computation, tests that at every
+/// gridpoint it selects the same observations, with the same localization values, as
+/// computeLocalization.
+template <typename MODEL, typename OBS> void testObsLocalObs() {
+  typedef ObsTestsFixture<OBS>                   Test_;
+  typedef oops::Geometry<MODEL>                  Geometry_;
+  typedef oops::GeometryIterator<MODEL>          GeometryIterator_;
+  typedef oops::ObsLocalizationBase<MODEL, OBS>  ObsLocalization_;
+  typedef oops::ObsSpace<OBS>                    ObsSpace_;
+  typedef oops::ObsVector<OBS>                   ObsVector_;
+
+  const eckit::LocalConfiguration geometryConfig(TestEnvironment::config(), "geometry");
+  Geometry_ geometry(geometryConfig, oops::mpi::world());
+
+  for (size_t jj = 0; jj < Test_::obspace().size(); ++jj) {
+    const ObsSpace_ & obspace = Test_::obspace()[jj];
+    std::vector<eckit::LocalConfiguration> obsLocConfigs =
+                        Test_::config(jj).getSubConfigurations("obs localizations");
+
+    for (size_t oli = 0; oli < obsLocConfigs.size(); ++oli) {
+      ObsLocTestParameters<MODEL, OBS> params;
+      params.validateAndDeserialize(obsLocConfigs[oli]);
+      std::unique_ptr<ObsLocalization_> obsloc =
+        oops::ObsLocalizationFactory<MODEL, OBS>::create(params.obsloc.obslocParameters, obspace);
+
+      ObsVector_ locvector(obspace);
+      oops::LocalObs local;
+      for (GeometryIterator_ ii = geometry.begin(); ii != geometry.end(); ++ii) {
+        if (!obsloc->computeLocalObs(ii, local)) {
+          oops::Log::info() << "Sparse localization not supported by " << *obsloc << std::endl;
+          break;
+        }
+        EXPECT(std::is_sorted(local.indices.begin(), local.indices.end()));
+        EXPECT_EQUAL(local.indices.size(), local.values.size());
+
+        locvector.ones();
+        obsloc->computeLocalization(ii, locvector);
+        const Eigen::VectorXd dense = locvector.packEigen(locvector);
+        EXPECT_EQUAL(local.size(), static_cast<size_t>(dense.size()));
+        for (size_t jloc = 0; jloc < local.size(); ++jloc) {
+          EXPECT(oops::is_close_absolute(local.values[jloc], dense(jloc), 1.e-12));
+        }
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 template <typename MODEL, typename OBS> class ObsLocalization : public oops::Test {
   typedef ObsTestsFixture<OBS> Test_;
 
@@ -194,6 +247,8 @@ template <typename MODEL, typename OBS> class ObsLocalization : public oops::Tes
 
     ts.emplace_back(CASE("interface/ObsLocalization/testObsLocalization")
       { testObsLocalization<MODEL, OBS>(); });
+    ts.emplace_back(CASE("interface/ObsLocalization/testObsLocalObs")
+      { testObsLocalObs<MODEL, OBS>(); });
   }
 
   void clear() const override {
@@ -11,6 +11,7 @@
 #ifndef TEST_INTERFACE_OBSVECTOR_H_
 #define TEST_INTERFACE_OBSVECTOR_H_
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -186,8 +187,8 @@ template <typename OBS> void testReadWrite() {
   }
 }
 // -----------------------------------------------------------------------------
-/// \brief Tests ObsVector::mask, ObsVector::packEigen and
-///        ObsVector::packEigenSize methods.
+/// \brief Tests ObsVector::mask, ObsVector::packEigen, ObsVector::packEigenSize and
+///        ObsVector::packEigenIndices methods.
 /// \details Tests that:
 /// - mask of "nothing to mask" applied to ObsVector doesn't change its size
 ///   and content;
@@ -336,6 +337,11 @@ template <typename OBS> void testMask() {
                           with_mask_vec.size() << std::endl;
     // check that the size is consistent with reference for this MPI task
     EXPECT_EQUAL(with_mask_vec.size(), nobs_after_mask_local[Test_::comm().rank()]);
+    // check that packEigenIndices returns one ascending index per packed value
+    const std::vector<size_t> indices = test.packEigenIndices(maskvec);
+    EXPECT_EQUAL(indices.size(), test.packEigenSize(maskvec));
+    EXPECT(std::is_sorted(indices.begin(), indices.end()));
+    EXPECT(std::adjacent_find(indices.begin(), indices.end()) == indices.end());
   }
 }
 // -----------------------------------------------------------------------------
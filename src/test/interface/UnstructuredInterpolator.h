@@ -159,6 +159,30 @@ void testInterpolator(const bool testSourcePointMask) {
   std::vector<double> target_vals;
   interpolator.apply(vars, source_fields, target_vals);
 
+  // A second interpolator to the same locations (sharing the interpolation matrices if
+  // "cache interpolation matrices" is set) must give identical results
+  {
+    oops::UnstructuredInterpolator<MODEL> interpolator2(config, *geom, target_lats, target_lons);
+    std::vector<double> target_vals2;
+    interpolator2.apply(vars, source_fields, target_vals2);
+    EXPECT(target_vals2 == target_vals);
+  }
+
+  // Interpolating to a list of target points gives the same values at these points
+  {
+    const size_t ntargets = target_lats.size();
+    std::vector<size_t> targets;
+    for (size_t jj = 0; jj < ntargets; jj += 2) targets.push_back(jj);
+    std::vector<double> target_vals3;
+    interpolator.apply(vars, source_fields, targets, target_vals3);
+    EXPECT(target_vals3.size() == target_vals.size());
+    for (size_t jlev = 0; jlev < nlev; ++jlev) {
+      for (const size_t jj : targets) {
+        EXPECT(target_vals3[jj + ntargets * jlev] == target_vals[jj + ntargets * jlev]);
+      }
+    }
+  }
+
   // Get test tolerance
   const size_t my_num_target = target_lons.size();
   const double tolerance = config.getDouble("tolerance interpolation");
@@ -147,6 +147,58 @@ CASE("mpi/mpi/SendReceive") {
     oops::mpi::send(comm, sendValue, destination, tag_send);
   }
   EXPECT_EQUAL(receivedValue, expectedValue);
+
+  // Again, with the serialization buffers kept from the first exchange
+  util::DateTime receivedAgain;
+  if (rank < 3) {
+    oops::mpi::send(comm, sendValue, destination, tag_send);
+    oops::mpi::receive(comm, receivedAgain, source, tag_recv);
+  } else {
+    oops::mpi::receive(comm, receivedAgain, source, tag_recv);
+    oops::mpi::send(comm, sendValue, destination, tag_send);
+  }
+  EXPECT_EQUAL(receivedAgain, expectedValue);
+}
+// -----------------------------------------------------------------------------------------------
+CASE("mpi/mpi/serialBuffer") {
+  const double * kept = nullptr;
+  {
+    oops::mpi::SerialBuffer outer;
+    outer.get().assign(100, 1.0);
+    kept = outer.get().data();
+    {
+      // A nested buffer does not overwrite the outer one
+      oops::mpi::SerialBuffer inner;
+      EXPECT(inner.get().empty());
+      EXPECT(inner.get().data() != kept);
+      inner.get().assign(200, 2.0);
+    }
+    EXPECT_EQUAL(outer.get().size(), 100u);
+    EXPECT_EQUAL(outer.get()[99], 1.0);
+  }
+  // Released buffers are reused, empty, with their memory
+  {
+    oops::mpi::SerialBuffer first;
+    oops::mpi::SerialBuffer second;
+    EXPECT(first.get().empty());
+    EXPECT(second.get().empty());
+    EXPECT(first.get().capacity() >= 100);
+    EXPECT(second.get().capacity() >= 100);
+    EXPECT(first.get().data() == kept || second.get().data() == kept);
+  }
+  // Buffers grown beyond the threshold are not kept
+  {
+    oops::mpi::SerialBuffer first;
+    oops::mpi::SerialBuffer second;
+    first.get().resize(oops::mpi::SerialBuffer::maxKeptSize + 1);
+    second.get().resize(oops::mpi::SerialBuffer::maxKeptSize + 1);
+  }
+  {
+    oops::mpi::SerialBuffer first;
+    oops::mpi::SerialBuffer second;
+    EXPECT(first.get().capacity() <= oops::mpi::SerialBuffer::maxKeptSize);
+    EXPECT(second.get().capacity() <= oops::mpi::SerialBuffer::maxKeptSize);
+  }
 }
 // -----------------------------------------------------------------------------------------------
 CASE("mpi/mpi/gatherSerializable") {
@@ -0,0 +1,15 @@
+/*
+ * (C) Copyright 2021 UCAR
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#include "oops/runs/Run.h"
+#include "test/util/Timer.h"
+
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  test::Timer tests;
+  return run.execute(tests);
+}
@@ -0,0 +1,199 @@
+/*
+ * (C) Copyright 2021 UCAR
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#ifndef TEST_UTIL_TIMER_H_
+#define TEST_UTIL_TIMER_H_
+
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "eckit/testing/Test.h"
+#include "oops/mpi/mpi.h"
+#include "oops/runs/Test.h"
+#include "oops/util/LocalEnvironment.h"
+#include "oops/util/Timer.h"
+#include "oops/util/TimerHelper.h"
+
+namespace test {
+
+// -----------------------------------------------------------------------------
+/// Timed work, long enough for the timer to show in the statistics
+void timedWork(const std::string & name) {
+  util::Timer timer("test::Timer", name);
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+}
+
+// -----------------------------------------------------------------------------
+/// Lines of the call trees printed by TimerHelper, by thread: name (with indentation) and count
+std::vector<std::vector<std::pair<std::string, size_t>>> callTrees() {
+  std::ostringstream os;
+  util::TimerHelper::printCallTrees(os);
+  std::vector<std::vector<std::pair<std::string, size_t>>> trees;
+  std::istringstream is(os.str());
+  std::string line;
+  while (std::getline(is, line)) {
+    if (line.compare(0, 7, "Thread ") == 0) {
+      trees.emplace_back();
+    } else if (!trees.empty() && line.find(" : ") != std::string::npos) {
+      const std::string name = line.substr(0, line.find_last_not_of(' ', line.find(" : ")) + 1);
+      std::istringstream values(line.substr(line.find(" : ") + 3));
+      double total;
+      size_t count;
+      values >> total >> count;
+      trees.back().emplace_back(name, count);
+    }
+  }
+  return trees;
+}
+
+// -----------------------------------------------------------------------------
+/// Position of a line in a call tree (or the size of the tree if not found)
+size_t findLine(const std::vector<std::pair<std::string, size_t>> & tree,
+                const std::string & name) {
+  size_t jj = 0;
+  while (jj < tree.size() && tree[jj].first != name) ++jj;
+  return jj;
+}
+
+// -----------------------------------------------------------------------------
+
+CASE("util/Timer/callTrees") {
+  std::unique_ptr<util::Timer> crossThread;
+  {
+    util::Timer outer("test::Timer", "outer");
+    timedWork("inner");
+    timedWork("inner");
+    crossThread.reset(new util::Timer("test::Timer", "crossThread"));
+  }
+  std::thread worker([&crossThread]() {
+    util::Timer timer("test::Timer", "worker");
+    timedWork("inner");
+    crossThread.reset();  // destroyed on another thread than the one that created it
+  });
+  worker.join();
+
+  const std::vector<std::vector<std::pair<std::string, size_t>>> trees = callTrees();
+  EXPECT(trees.size() >= 2);
+
+// Main thread (printed first): the timers are nested under the outer timer, the timer
+// destroyed on the worker thread is in the tree of the main thread that created it
+  const std::vector<std::pair<std::string, size_t>> & mainTree = trees[0];
+  size_t jouter = 0;
+  while (jouter < mainTree.size() &&
+         mainTree[jouter].first.find("test::Timer::outer") == std::string::npos) ++jouter;
+  EXPECT(jouter < mainTree.size());
+  const std::string indent(mainTree[jouter].first.find("test::Timer::outer") + 2, ' ');
+  EXPECT_EQUAL(mainTree[jouter].second, 1u);
+  const size_t jinner = findLine(mainTree, indent + "test::Timer::inner");
+  EXPECT(jinner < mainTree.size());
+  EXPECT_EQUAL(mainTree[jinner].second, 2u);
+  const size_t jcross = findLine(mainTree, indent + "test::Timer::crossThread");
+  EXPECT(jcross < mainTree.size());
+  EXPECT_EQUAL(mainTree[jcross].second, 1u);
+
+// Worker thread: its own tree, with the worker timer at the root
+  bool found = false;
+  for (size_t jt = 1; jt < trees.size(); ++jt) {
+    const size_t jworker = findLine(trees[jt], "test::Timer::worker");
+    if (jworker == trees[jt].size()) continue;
+    found = true;
+    EXPECT_EQUAL(trees[jt][jworker].second, 1u);
+    const size_t jin = findLine(trees[jt], "  test::Timer::inner");
+    EXPECT(jin < trees[jt].size());
+    EXPECT_EQUAL(trees[jt][jin].second, 1u);
+    EXPECT(findLine(trees[jt], "  test::Timer::crossThread") == trees[jt].size());
+  }
+  EXPECT(found);
+}
+
+// -----------------------------------------------------------------------------
+
+CASE("util/Timer/trace") {
+  struct Event {
+    size_t tid;
+    double start;
+    double end;
+  };
+  std::map<std::string, std::vector<Event>> events;
+
+  {
+//  The trace is enabled when the timers are started and written when they are stopped
+    util::LocalEnvironment localEnv;
+    localEnv.set("OOPS_TIMER_TRACE", "test_util_timer_trace");
+    util::TimerHelper::stop();
+    util::TimerHelper::start();
+    {
+      util::Timer timer("test::Timer", "traced");
+      timedWork("tracedInner");
+    }
+    std::thread worker([]() {
+      util::Timer timer("test::Timer", "traced");
+      timedWork("tracedInner");
+    });
+    worker.join();
+    util::TimerHelper::stop();
+  }
+  util::TimerHelper::start();
+
+  std::ifstream trace("test_util_timer_trace_" + std::to_string(oops::mpi::world().rank())
+                      + ".json");
+  EXPECT(trace.is_open());
+  std::string line;
+  std::getline(trace, line);
+  EXPECT_EQUAL(line, "{\"traceEvents\":[");
+  const std::regex event("\\{\"name\":\"([^\"]*)\",\"ph\":\"X\",\"pid\":[0-9]+,"
+                         "\"tid\":([0-9]+),\"ts\":([0-9.]+),\"dur\":([0-9.]+)\\},?");
+  while (std::getline(trace, line)) {
+    if (line == "]}") break;
+    std::smatch match;
+    EXPECT(std::regex_match(line, match, event));
+    const double start = std::stod(match[3]);
+    events[match[1]].push_back(Event{std::stoul(match[2]), start, start + std::stod(match[4])});
+  }
+  EXPECT_EQUAL(line, "]}");
+
+// Each timer call is traced, on the thread that made it, within its calling timer
+  EXPECT_EQUAL(events["test::Timer::traced"].size(), 2u);
+  EXPECT_EQUAL(events["test::Timer::tracedInner"].size(), 2u);
+  EXPECT(events["test::Timer::traced"][0].tid != events["test::Timer::traced"][1].tid);
+  for (const Event & inner : events["test::Timer::tracedInner"]) {
+    size_t nouter = 0;
+    for (const Event & outer : events["test::Timer::traced"]) {
+      if (outer.tid == inner.tid) {
+        ++nouter;
+        EXPECT(outer.start <= inner.start);
+        EXPECT(inner.end <= outer.end + 1.0e-2);
+        EXPECT(inner.end - inner.start >= 5.0e3);  // microseconds
+      }
+    }
+    EXPECT_EQUAL(nouter, 1u);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+class Timer : public oops::Test {
+ private:
+  std::string testid() const override {return "test::Timer";}
+
+  void register_tests() const override {}
+  void clear() const override {}
+};
+
+// -----------------------------------------------------------------------------
+
+}  // namespace test
+
+#endif  // TEST_UTIL_TIMER_H_
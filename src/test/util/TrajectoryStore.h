@@ -0,0 +1,141 @@
+/*
+ * (C) Copyright 2023 UCAR
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#ifndef TEST_UTIL_TRAJECTORYSTORE_H_
+#define TEST_UTIL_TRAJECTORYSTORE_H_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "eckit/exception/Exceptions.h"
+#include "eckit/testing/Test.h"
+#include "oops/runs/Test.h"
+#include "oops/util/DateTime.h"
+#include "oops/util/TrajectoryStore.h"
+
+namespace test {
+
+// -----------------------------------------------------------------------------
+/// Trajectory step with blocks of very different ranges (and a constant block)
+std::vector<double> trajectoryStep(const size_t nn, const double shift) {
+  std::vector<double> vals(nn);
+  for (size_t jj = 0; jj < nn; ++jj) {
+    const double scale = std::pow(10.0, static_cast<double>(jj / 100) - 3.0);
+    vals[jj] = scale * std::sin(0.1 * static_cast<double>(jj) + shift) + 1.0e-2 * scale;
+  }
+  for (size_t jj = 200; jj < 300 && jj < nn; ++jj) vals[jj] = -12.5;
+  return vals;
+}
+
+// -----------------------------------------------------------------------------
+
+CASE("util/TrajectoryStore/int16") {
+  const size_t nn = 450;
+  const size_t blockSize = 100;
+  util::TrajectoryStore store("int16", blockSize);
+  const util::DateTime t1("2010-01-01T00:00:00Z");
+  const util::DateTime t2("2010-01-01T01:00:00Z");
+  const std::vector<double> vals1 = trajectoryStep(nn, 0.0);
+  const std::vector<double> vals2 = trajectoryStep(nn, 0.5);
+  store.put(t1, vals1);
+  store.put(t2, vals2);
+  EXPECT(store.has(t1));
+  EXPECT(store.has(t2));
+  EXPECT_EQUAL(store.size(), 2u);
+  EXPECT_EQUAL(store.unpackedBytes(), 2 * nn * sizeof(double));
+  EXPECT(store.storedBytes() < store.unpackedBytes() / 3);
+
+// Each value is within half a quantization step of its block (exact for constant blocks)
+  for (const util::DateTime & tt : {t1, t2}) {
+    const std::vector<double> & ref = (tt == t1) ? vals1 : vals2;
+    std::vector<double> vals;
+    store.get(tt, vals);
+    EXPECT_EQUAL(vals.size(), nn);
+    for (size_t ibgn = 0; ibgn < nn; ibgn += blockSize) {
+      const size_t iend = std::min(ibgn + blockSize, nn);
+      const auto mm = std::minmax_element(ref.begin() + ibgn, ref.begin() + iend);
+      const double tol = 0.5 * (*mm.second - *mm.first) / 65535.0 * (1.0 + 1.0e-6)
+                         + 1.0e-15 * std::max(std::abs(*mm.first), std::abs(*mm.second));
+      for (size_t jj = ibgn; jj < iend; ++jj) EXPECT(std::abs(vals[jj] - ref[jj]) <= tol);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+CASE("util/TrajectoryStore/int16NonFinite") {
+  const size_t nn = 450;
+  const size_t blockSize = 100;
+  util::TrajectoryStore store("int16", blockSize);
+  const util::DateTime tt("2010-01-01T00:00:00Z");
+  std::vector<double> ref = trajectoryStep(nn, 0.0);
+  ref[50] = std::numeric_limits<double>::quiet_NaN();
+  ref[150] = std::numeric_limits<double>::infinity();
+  ref[160] = -std::numeric_limits<double>::infinity();
+  ref[310] = 1.0e308;   // finite values with a range that overflows
+  ref[320] = -1.0e308;
+  store.put(tt, ref);
+  std::vector<double> vals;
+  store.get(tt, vals);
+  EXPECT_EQUAL(vals.size(), nn);
+
+// Blocks with non-finite values or range are exact, the others are quantized
+  for (size_t jj = 0; jj < nn; ++jj) {
+    if (jj < 200 || (jj >= 300 && jj < 400)) {
+      if (std::isnan(ref[jj])) {
+        EXPECT(std::isnan(vals[jj]));
+      } else {
+        EXPECT(vals[jj] == ref[jj]);
+      }
+    } else {
+      EXPECT(std::isfinite(vals[jj]));
+      EXPECT(std::abs(vals[jj] - ref[jj]) <= 1.0e-3 * std::max(1.0, std::abs(ref[jj])));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+CASE("util/TrajectoryStore/otherPackings") {
+  const size_t nn = 450;
+  const util::DateTime tt("2010-01-01T00:00:00Z");
+  const std::vector<double> ref = trajectoryStep(nn, 0.0);
+  for (const std::string packing : {"double", "float", "lossless"}) {
+    util::TrajectoryStore store(packing);
+    store.put(tt, ref);
+    std::vector<double> vals;
+    store.get(tt, vals);
+    EXPECT_EQUAL(vals.size(), nn);
+    for (size_t jj = 0; jj < nn; ++jj) {
+      if (packing == "float") {
+        EXPECT(std::abs(vals[jj] - ref[jj]) <= std::abs(ref[jj]) * 6.0e-8);
+      } else {
+        EXPECT(vals[jj] == ref[jj]);
+      }
+    }
+  }
+  EXPECT_THROWS_AS(util::TrajectoryStore("half"), eckit::BadValue);
+}
+
+// -----------------------------------------------------------------------------
+
+class TrajectoryStore : public oops::Test {
+ private:
+  std::string testid() const override {return "test::TrajectoryStore";}
+
+  void register_tests() const override {}
+  void clear() const override {}
+};
+
+// -----------------------------------------------------------------------------
+
+}  // namespace test
+
+#endif  // TEST_UTIL_TRAJECTORYSTORE_H_